@@ -13,21 +13,81 @@
 #include <math.h>
 #include <time.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include "temper-hum-hid-api.h"
+#include "temper-hum-hid-transport.h"
+#include "temper-hum-hid-capture.h"
+#include "temper-hum-hid-sht1x.h"
 #include <unistd.h>
 
 #define VENDOR_ID  0x1130
 #define PRODUCT_ID 0x660c
 #define INTERFACE  1
-#define DEFAULT_SENSOR_VOLTAGE 3.5
-#define DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE 14
-#define DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY 12
+#define TEMPERHUM_COMMAND_LENGTH 80
+#define TEMPERHUM_RESPONSE_LENGTH 512
+#define TEMPERHUM_TRANSFER_TIMEOUT 1000
+#define TEMPERHUM_SETTLE_TIME 400000
+#define TEMPERHUM_MAX_SETTLE_TIME 1000000
+#define TEMPERHUM_MIN_SETTLE_TIME 20000
+#define TEMPERHUM_SETTLE_LEARN_READS 8 /** good reads in a row before the settle time is shortened */
+#define TEMPERHUM_MEASURE_ATTEMPTS 3
+#define TEMPERHUM_HOTPLUG_QUEUE 64
+#define TEMPERHUM_FAILING_LIMIT 3
+#define TEMPERHUM_MAX_BACKOFF 300000000
+#define TEMPERHUM_RESET_TIMEOUT 30000000
+#define TEMPERHUM_SHM_MAGIC 0x54484d32
 
 static libusb_context *usb_context = NULL;
+static const struct temperhum_transport *temperhum_transport = &temperhum_usb_transport;
+static char temperhum_transport_options[256] = "";
+static int temperhum_transport_ready = 0;
+static double temperhum_time_scale = 1; /** replayed devices may run faster than real ones */
 
 static struct temperhum_options temperhum_options;
 static temperhum_device *temperhum_root_device = NULL;
 static FILE * debug_output;
+static int temperhum_wait_policy = TEMPERHUM_WAIT_ADAPTIVE;
+static int temperhum_scanned = 0; /** usb devices have been listed since devices were closed */
+static unsigned int temperhum_devices_generation = 0; /** changes whenever devices are added or removed */
+
+static int temperhum_hotplug_registered = 0;
+static libusb_hotplug_callback_handle temperhum_hotplug_handle;
+static struct {
+	libusb_device *device;
+	libusb_hotplug_event event;
+} temperhum_hotplug_pending[TEMPERHUM_HOTPLUG_QUEUE];
+static int temperhum_hotplug_pending_count = 0;
+
+static void temperhum_hotplug_deregister();
+static void temperhum_forget_lost();
+static int temperhum_find_resetting();
+
+static unsigned char temperhum_init_request[] = {0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static unsigned char temperhum_measure_request[] = {0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+/**
+ * Current monotonic time in microseconds
+ */
+static int64_t temperhum_monotonic_us()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * Current wall clock time in milliseconds
+ */
+static int64_t temperhum_wallclock_ms()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+
+	return (int64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
 
 /**
  * Initialize syslog
@@ -51,7 +111,7 @@ void temperhum_debug(const char* format, ...)
 	char message[128];
 
     va_start(args, format);
-    vsprintf(message, format, args);
+    vsnprintf(message, sizeof(message), format, args);
     va_end(args);
 
 	if (temperhum_options.debug) {
@@ -73,7 +133,7 @@ void temperhum_error(int exit_program, const char* format, ...)
 	char message[256];
 
     va_start(args, format);
-    vsprintf(message, format, args);
+    vsnprintf(message, sizeof(message), format, args);
     va_end(args);
 
 	fprintf(stderr, "Error: %s\n", message);
@@ -114,6 +174,35 @@ void temperhum_debug_bytes(unsigned char * data, int length)
 	temperhum_debug("  0x%02X:%s", i - 8, byte_sequence);
 }
 
+/**
+ * Release and close the usb handle of a temperhum device
+ */
+static void temperhum_usb_close(temperhum_device * d)
+{
+	if (d->handle) {
+		temperhum_debug("Releasing interface %u", d->interface_number);
+		libusb_release_interface(d->handle, d->interface_number);
+		if (d->kernel_driver_detached) {
+			temperhum_debug("Attaching kernel driver back at interface %u", d->interface_number);
+			libusb_attach_kernel_driver(d->handle, d->interface_number);
+		}
+
+		temperhum_debug("Closing usb device handle");
+		libusb_close(d->handle);
+	}
+}
+
+/**
+ * Release and close a single temperhum device
+ */
+static void temperhum_close_device(temperhum_device * d)
+{
+	if (d->handle) {
+		temperhum_transport->close(d);
+	}
+	free(d);
+}
+
 /**
  * Close temperhum root device
  */
@@ -123,21 +212,40 @@ void temperhum_close_devices()
 		temperhum_device *d = temperhum_root_device;
 		while (d) {
 			temperhum_device *next = d->next;
-
-			temperhum_debug("Releasing interface %u", d->interface_number);
-			libusb_release_interface(d->handle, d->interface_number);
-			if (d->kernel_driver_detached) {
-				temperhum_debug("Attaching kernel driver back at interface %u", d->interface_number);
-				libusb_attach_kernel_driver(d->handle, d->interface_number);
-			}
-
-			temperhum_debug("Closing usb device handle");
-			libusb_close(d->handle);
-			free(d);
+			temperhum_close_device(d);
 			d = next;
 		}
 		temperhum_root_device = NULL;
 	}
+	temperhum_scanned = 0;
+	temperhum_devices_generation++;
+}
+
+/**
+ * Starts the transport unless it is running
+ */
+static void temperhum_start_transport()
+{
+	if (!temperhum_transport_ready) {
+		if (temperhum_transport->init(temperhum_transport_options) < 0) {
+			temperhum_error(1, "Cannot init %s transport", temperhum_transport->name);
+		}
+		temperhum_transport_ready = 1;
+	}
+}
+
+/**
+ * Closes all devices and the transport
+ */
+static void temperhum_stop_transport()
+{
+	temperhum_hotplug_deregister();
+	temperhum_close_devices();
+
+	if (temperhum_transport_ready) {
+		temperhum_transport->exit();
+		temperhum_transport_ready = 0;
+	}
 }
 
 /**
@@ -159,10 +267,112 @@ void temperhum_init(int print_debug_messages, int send_debug_to_syslog, char * d
 		temperhum_init_syslog();
 	}
 
+	temperhum_start_transport();
+}
+
+/**
+ * Closes all devices and starts the transport over, they are found again
+ * by the next temperhum_find(). Debug output and syslog stay open, so
+ * other threads may keep logging meanwhile.
+ */
+void temperhum_reinit()
+{
+	temperhum_stop_transport();
+	temperhum_start_transport();
+}
+
+/**
+ * Choose the backend devices are reached through, "usb" for real devices
+ * or "sim:options" for simulated ones, see temper-hum-hid-sim.c.
+ * Has to be called before temperhum_init().
+ */
+int temperhum_set_transport(const char * spec)
+{
+	const char *options = strchr(spec, ':');
+	size_t length = options ? (size_t) (options - spec) : strlen(spec);
+
+	if (length == 3 && !strncmp(spec, "usb", 3)) {
+		temperhum_transport = &temperhum_usb_transport;
+	} else if (length == 3 && !strncmp(spec, "sim", 3)) {
+		temperhum_transport = &temperhum_sim_transport;
+	} else if (length == 6 && !strncmp(spec, "replay", 6)) {
+		temperhum_transport = &temperhum_replay_transport;
+	} else {
+		temperhum_error(0, "Unknown transport '%s'", spec);
+		return -1;
+	}
+
+	snprintf(temperhum_transport_options, sizeof(temperhum_transport_options), "%s", options ? options + 1 : "");
+	temperhum_time_scale = 1;
+
+	return 0;
+}
+
+/**
+ * Scales time waited for sensors to measure, used by transports
+ * replaying devices faster than real time
+ */
+void temperhum_transport_set_time_scale(double scale)
+{
+	temperhum_time_scale = scale;
+}
+
+/**
+ * Name of a latency in reports, 4ex. settle
+ */
+const char * temperhum_latency_name(int latency)
+{
+	static const char * names[TEMPERHUM_LATENCIES] = {"send", "settle", "receive", "fill"};
+
+	return latency >= 0 && latency < TEMPERHUM_LATENCIES ? names[latency] : "";
+}
+
+/**
+ * Name of a counter in reports, 4ex. bad-data
+ */
+const char * temperhum_counter_name(int counter)
+{
+	static const char * names[TEMPERHUM_COUNTERS] = {"transfer-errors", "timeouts", "bad-data", "resets", "reenumerations"};
+
+	return counter >= 0 && counter < TEMPERHUM_COUNTERS ? names[counter] : "";
+}
+
+/**
+ * Counts a failed transfer in given counter, TEMPERHUM_COUNTER_TIMEOUTS or
+ * TEMPERHUM_COUNTER_TRANSFER_ERRORS
+ */
+static void temperhum_count_failure(temperhum_device * device, int counter)
+{
+	device->metrics.counter[counter]++;
+}
+
+/**
+ * Counter of a synchronous transfer or a submission failed with a libusb error
+ */
+static int temperhum_error_counter(int error)
+{
+	return error == LIBUSB_ERROR_TIMEOUT ? TEMPERHUM_COUNTER_TIMEOUTS : TEMPERHUM_COUNTER_TRANSFER_ERRORS;
+}
+
+/**
+ * Counter of an asynchronous transfer failed with a libusb transfer status,
+ * the two enums overlap so they are never mixed
+ */
+static int temperhum_status_counter(int status)
+{
+	return status == LIBUSB_TRANSFER_TIMED_OUT ? TEMPERHUM_COUNTER_TIMEOUTS : TEMPERHUM_COUNTER_TRANSFER_ERRORS;
+}
+
+/**
+ * Init libusb context
+ */
+static int temperhum_usb_init(const char * options)
+{
 	if (!usb_context) {
 		temperhum_debug("Init usb context");
 		if (libusb_init(&usb_context)) {
-			temperhum_error(1, "Cannot init libusb");
+			temperhum_error(0, "Cannot init libusb");
+			return -1;
 		}
 
 		if (temperhum_options.debug) {
@@ -171,6 +381,20 @@ void temperhum_init(int print_debug_messages, int send_debug_to_syslog, char * d
 			libusb_set_debug(usb_context, 0);
 		}
 	}
+
+	return 0;
+}
+
+/**
+ * Exit libusb context
+ */
+static void temperhum_usb_exit()
+{
+	if (usb_context) {
+		temperhum_debug("Exit usb context");
+		libusb_exit(usb_context);
+		usb_context = NULL;
+	}
 }
 
 /**
@@ -182,13 +406,7 @@ void temperhum_close()
 		closelog();
 	}
 
-	temperhum_close_devices();
-	
-	if (usb_context) {
-		temperhum_debug("Exit usb context");
-		libusb_exit(usb_context);
-		usb_context = NULL;
-	}
+	temperhum_stop_transport();
 
 	if (debug_output && debug_output != stdout) {
 		fclose(debug_output);
@@ -196,516 +414,1693 @@ void temperhum_close()
 }
 
 /**
- * Finds all matching temperhum devices
+ * Builds a path of usb ports the device is plugged in, like 1-1.4 for port 4
+ * of a hub in port 1 of bus 1. Unlike the device address it survives resets
+ * and replugging into the same port.
  */
-temperhum_device * temperhum_find()
+static void temperhum_port_path(libusb_device *dev, char * path, int size)
 {
-	if (temperhum_root_device) {
-		return temperhum_root_device;
+	uint8_t ports[8];
+	int i, length;
+	int count = libusb_get_port_numbers(dev, ports, sizeof(ports));
+
+	length = snprintf(path, size, "%u", libusb_get_bus_number(dev));
+	if (count <= 0) {
+		// no port numbers for root hubs or on old platforms, fall back to the address
+		snprintf(path + length, size - length, ":%u", libusb_get_device_address(dev));
+		return;
 	}
 
-	libusb_device **devs;
-	libusb_device *dev;
+	for (i = 0; i < count && length < size; i++) {
+		length += snprintf(path + length, size - length, "%c%u", i ? '.' : '-', ports[i]);
+	}
+}
 
-	temperhum_device *current_device = NULL;
+/**
+ * Opens a usb device for a temperhum device and claims its interface
+ */
+static int temperhum_open_device(temperhum_device * d, libusb_device *dev)
+{
+	int res;
 
-	int num_devs = libusb_get_device_list(usb_context, &devs);
-	if (num_devs < 0) {
-		return NULL;
-	}
+	d->device = dev;
+	d->bus_number = libusb_get_bus_number(dev);
+	d->device_number = libusb_get_device_address(dev);
+	d->kernel_driver_detached = 0;
+	d->initialized = 0;
 
-	temperhum_debug("Found %i usb devices", num_devs);
+	temperhum_debug("Using interface %u", d->interface_number);
 
-	int i = 0, j = 0, k = 0, res;
-	while ((dev = devs[i++]) != NULL) {
-		struct libusb_device_descriptor desc;
-		struct libusb_config_descriptor *conf_desc = NULL;
+	res = libusb_open(dev, &d->handle);
+	if (res < 0) {
+		temperhum_debug("Warning: cannot open usb device at interface %u", d->interface_number);
+		d->handle = NULL;
+		d->device = NULL;
+		return res;
+	}
 
-		res = libusb_get_device_descriptor(dev, &desc);
-		if (desc.idVendor != VENDOR_ID || desc.idProduct != PRODUCT_ID) {
-			temperhum_debug("Skipping device %04x:%04x", desc.idVendor, desc.idProduct);
-			continue;
-		}
-		
-		uint8_t bus_number = libusb_get_bus_number(dev);
-		uint8_t device_number = libusb_get_device_address(dev);
-		temperhum_debug("Using device %04x:%04x @ %03u:%03u", desc.idVendor, desc.idProduct, bus_number, device_number);
+	temperhum_debug("Opened usb device");
+	d->state = TEMPERHUM_STATE_OPEN;
 
-		res = libusb_get_active_config_descriptor(dev, &conf_desc);
+	res = libusb_kernel_driver_active(d->handle, d->interface_number);
+	if (res == 1) {
+		temperhum_debug("Kernel has active driver on a device, detaching");
+		res = libusb_detach_kernel_driver(d->handle, d->interface_number);
 		if (res < 0) {
-			libusb_get_config_descriptor(dev, 0, &conf_desc);
+			temperhum_debug("Warning: cannot detach kernel driver at interface %u", d->interface_number);
+			libusb_close(d->handle);
+			d->handle = NULL;
+			d->device = NULL;
+			return res;
 		}
+		d->kernel_driver_detached = 1;
+	}
 
-		if (!conf_desc) {
-			continue;
+	res = libusb_claim_interface(d->handle, d->interface_number);
+	if (res < 0) {
+		temperhum_debug("Warning: cannot claim interface %u", d->interface_number);
+		libusb_close(d->handle);
+		d->handle = NULL;
+		d->device = NULL;
+		return res;
+	}
+
+	temperhum_debug("Claimed interface %u", d->interface_number);
+	d->state = TEMPERHUM_STATE_CLAIMED;
+
+	return 0;
+}
+
+/**
+ * Finds a device waiting to be reopened in a usb port after it was reset
+ */
+static temperhum_device * temperhum_find_slot(const char * port_path, uint8_t interface_number)
+{
+	temperhum_device *d;
+	for (d = temperhum_root_device; d; d = d->next) {
+		if (!d->handle && d->interface_number == interface_number && !strcmp(d->port_path, port_path)) {
+			return d;
 		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Opens a usb device if it is a temperhum and appends it to the list of devices.
+ * A device which comes back into the port of a device being reset takes its place.
+ */
+static int temperhum_attach(libusb_device *dev)
+{
+	struct libusb_device_descriptor desc;
+	struct libusb_config_descriptor *conf_desc = NULL;
+	temperhum_device *current_device = temperhum_root_device;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	int j = 0, k = 0, res, attached = 0;
+
+	while (current_device && current_device->next) {
+		current_device = current_device->next;
+	}
+
+	res = libusb_get_device_descriptor(dev, &desc);
+	if (desc.idVendor != VENDOR_ID || desc.idProduct != PRODUCT_ID) {
+		temperhum_debug("Skipping device %04x:%04x", desc.idVendor, desc.idProduct);
+		return 0;
+	}
+	
+	temperhum_port_path(dev, port_path, sizeof(port_path));
+	temperhum_debug("Using device %04x:%04x @ %03u:%03u, port %s", desc.idVendor, desc.idProduct, libusb_get_bus_number(dev), libusb_get_device_address(dev), port_path);
 
-		temperhum_debug("Using config %u", conf_desc->bConfigurationValue);
+	res = libusb_get_active_config_descriptor(dev, &conf_desc);
+	if (res < 0) {
+		libusb_get_config_descriptor(dev, 0, &conf_desc);
+	}
 
-		for (j = 0; j < conf_desc->bNumInterfaces; j++) {
-			const struct libusb_interface *intf = &conf_desc->interface[j];
+	if (!conf_desc) {
+		return 0;
+	}
 
-			for (k = 0; k < intf->num_altsetting; k++) {
-				const struct libusb_interface_descriptor *intf_desc = &intf->altsetting[k];
+	temperhum_debug("Using config %u", conf_desc->bConfigurationValue);
 
-				if (intf_desc->bInterfaceNumber != INTERFACE) {
-					temperhum_debug("Skipping interface %u", intf_desc->bInterfaceNumber);
-					continue;
-				}
+	for (j = 0; j < conf_desc->bNumInterfaces; j++) {
+		const struct libusb_interface *intf = &conf_desc->interface[j];
 
-				temperhum_device *tmp;
-				tmp = calloc(1, sizeof(temperhum_device));
-				tmp->next = NULL;
-				tmp->device = dev;
-				tmp->interface_number = intf_desc->bInterfaceNumber;
-				tmp->kernel_driver_detached = 0;
-				tmp->bus_number = bus_number;
-				tmp->device_number = device_number;
-
-				temperhum_debug("Using interface %u", tmp->interface_number);
-
-				res = libusb_open(dev, &tmp->handle);
-				if (res < 0) {
-					temperhum_debug("Warning: cannot open usb device at interface %u", tmp->interface_number);
-					continue;
-				}
+		for (k = 0; k < intf->num_altsetting; k++) {
+			const struct libusb_interface_descriptor *intf_desc = &intf->altsetting[k];
 
-				temperhum_debug("Opened usb device");
-
-				res = libusb_kernel_driver_active(tmp->handle, tmp->interface_number);
-				if (res == 1) {
-					temperhum_debug("Kernel has active driver on a device, detaching");
-					res = libusb_detach_kernel_driver(tmp->handle, tmp->interface_number);
-					if (res < 0) {
-						temperhum_debug("Warning: cannot detach kernel driver at interface %u", tmp->interface_number);
-						libusb_close(tmp->handle);
-						continue;
-					}
-					tmp->kernel_driver_detached = 1;
-				}
+			if (intf_desc->bInterfaceNumber != INTERFACE) {
+				temperhum_debug("Skipping interface %u", intf_desc->bInterfaceNumber);
+				continue;
+			}
 
-				res = libusb_claim_interface(tmp->handle, tmp->interface_number);
-				if (res < 0) {
-					temperhum_debug("Warning: cannot claim interface %u", tmp->interface_number);
-					libusb_close(tmp->handle);
-					continue;
+			temperhum_device *tmp = temperhum_find_slot(port_path, intf_desc->bInterfaceNumber);
+			if (tmp) {
+				temperhum_debug("Device is back in port %s after reset", port_path);
+				if (temperhum_open_device(tmp, dev) == 0) {
+					tmp->metrics.counter[TEMPERHUM_COUNTER_REENUMERATIONS]++;
+					attached++;
 				}
+				continue;
+			}
 
-				temperhum_debug("Claimed interface %u", tmp->interface_number);
+			tmp = calloc(1, sizeof(temperhum_device));
+			tmp->next = NULL;
+			tmp->interface_number = intf_desc->bInterfaceNumber;
+			strcpy(tmp->port_path, port_path);
 
-				if (current_device) {
-					current_device->next = tmp;
-				} else {
-					temperhum_root_device = tmp;
-				}
-				current_device = tmp;
+			if (temperhum_open_device(tmp, dev) < 0) {
+				free(tmp);
+				continue;
 			}
-		}
 
-		libusb_free_config_descriptor(conf_desc);
+			if (current_device) {
+				current_device->next = tmp;
+			} else {
+				temperhum_root_device = tmp;
+			}
+			current_device = tmp;
+			temperhum_devices_generation++;
+			attached++;
+		}
 	}
 
-	libusb_free_device_list(devs, 1);
-	temperhum_debug("Finished listing devices");
+	libusb_free_config_descriptor(conf_desc);
 
-	return temperhum_root_device;
+	return attached;
 }
 
 /**
- * Reset temperhum root device
+ * Adds an opened device of a transport without libusb devices to the list of devices.
+ * A device which comes back into the port of a device being reset takes its place.
  */
-void temperhum_reset_devices()
+temperhum_device * temperhum_transport_attach(uint8_t bus_number, uint8_t device_number, uint8_t interface_number, const char * port_path, void * handle)
 {
-	int res, devices_existed = 0;
-	if (!temperhum_root_device) {
-		temperhum_find();
+	temperhum_device *d = temperhum_find_slot(port_path, interface_number);
+
+	if (!d) {
+		d = calloc(1, sizeof(temperhum_device));
+		if (!d) {
+			return NULL;
+		}
+		d->interface_number = interface_number;
+		snprintf(d->port_path, sizeof(d->port_path), "%s", port_path);
+
+		temperhum_device **link = &temperhum_root_device;
+		while (*link) {
+			link = &(*link)->next;
+		}
+		*link = d;
+		temperhum_devices_generation++;
 	} else {
-		devices_existed = 1;
+		d->metrics.counter[TEMPERHUM_COUNTER_REENUMERATIONS]++;
 	}
 
-	if (temperhum_root_device) {
-		temperhum_device *d = temperhum_root_device;
-		while (d) {
-			temperhum_device *next = d->next;
+	d->bus_number = bus_number;
+	d->device_number = device_number;
+	d->handle = handle;
+	d->initialized = 0;
+	d->state = TEMPERHUM_STATE_CLAIMED;
 
-			temperhum_debug("Resetting device @ %03u:%03u", d->bus_number, d->device_number);
-			libusb_release_interface(d->handle, d->interface_number);
-			res = libusb_reset_device(d->handle);
-			if (res < 0) {
-				temperhum_debug("Warning: cannot reset device");
+	return d;
+}
+
+/**
+ * Closes all temperhum devices of a usb device and removes them from the list
+ */
+static void temperhum_detach(libusb_device *dev)
+{
+	temperhum_device **link = &temperhum_root_device;
+
+	while (*link) {
+		temperhum_device *d = *link;
+		if (d->device != dev) {
+			link = &d->next;
+		} else if (d->state == TEMPERHUM_STATE_RESETTING) {
+			// a device being reset leaves and comes back, keep its place in the list
+			temperhum_debug("Device in port %s left while resetting", d->port_path);
+			if (d->handle) {
+				libusb_close(d->handle);
 			}
-			d = next;
+			d->handle = NULL;
+			d->device = NULL;
+			link = &d->next;
+		} else {
+			temperhum_debug("Removing device @ %03u:%03u", d->bus_number, d->device_number);
+			*link = d->next;
+			temperhum_close_device(d);
+			temperhum_devices_generation++;
 		}
-		temperhum_close_devices();
-		if (devices_existed) {
-			temperhum_find();
+	}
+}
+
+/**
+ * Checks whether a usb device is already in the list of temperhum devices
+ */
+static int temperhum_attached(libusb_device *dev)
+{
+	temperhum_device *d;
+	for (d = temperhum_root_device; d; d = d->next) {
+		if (d->device == dev) {
+			return 1;
 		}
 	}
 
-	// After powerup the device needs 11ms to reach its 
-	// "sleep" state. No commands should be sent before that time. 
-	usleep(20000);
+	return 0;
 }
 
 /**
- * Send a command to temperhum device
+ * Remembers a device arrival or departure reported by libusb. Events are only
+ * queued here since libusb may report them in the middle of temperhum_fill_all(),
+ * the list of devices is updated on the next call to temperhum_find()
  */
-int temperhum_send(temperhum_device * device, unsigned char * request, int length)
+static int LIBUSB_CALL temperhum_hotplug_callback(libusb_context *ctx, libusb_device *dev, libusb_hotplug_event event, void *user_data)
 {
-	temperhum_debug("Sending %i bytes of data to interface %u of USB device at %03u:%03u:", length, device->interface_number, device->bus_number, device->device_number);
-	temperhum_debug_bytes(request, length);
-	
-	int size = libusb_control_transfer(
-		device->handle, 
-		LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_OUT,
-		0x09, // HID Set_Report
-		2 << 8, // HID output
-		device->interface_number,
-		request,
-		length,
-		1000
-	);
+	if (temperhum_hotplug_pending_count >= TEMPERHUM_HOTPLUG_QUEUE) {
+		temperhum_error(0, "Too many usb hotplug events at once, ignoring one");
+		return 0;
+	}
 
-	if (size <= 0) {
-		temperhum_error(0, "Writing to temperhum @ %03u:%03u failed: %i", device->bus_number, device->device_number, size);
+	temperhum_hotplug_pending[temperhum_hotplug_pending_count].device = libusb_ref_device(dev);
+	temperhum_hotplug_pending[temperhum_hotplug_pending_count].event = event;
+	temperhum_hotplug_pending_count++;
 
-		return -1;
-	} else if (size != length) {
-		temperhum_error(0, "Written to temperhum only %i of %i bytes", size, length);
+	return 0;
+}
 
-		return -1;
+/**
+ * Registers for arrivals and departures of temperhum devices if libusb supports it
+ */
+static void temperhum_hotplug_register()
+{
+	if (temperhum_hotplug_registered || !libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG)) {
+		return;
 	}
 
-	temperhum_debug("Written %i bytes", size);
-	return size;
+	int res = libusb_hotplug_register_callback(
+		usb_context,
+		LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+		LIBUSB_HOTPLUG_NO_FLAGS,
+		VENDOR_ID,
+		PRODUCT_ID,
+		LIBUSB_HOTPLUG_MATCH_ANY,
+		temperhum_hotplug_callback,
+		NULL,
+		&temperhum_hotplug_handle
+	);
+	if (res < 0) {
+		temperhum_debug("Warning: cannot register usb hotplug callback: %i", res);
+		return;
+	}
+
+	temperhum_debug("Registered usb hotplug callback");
+	temperhum_hotplug_registered = 1;
 }
 
 /**
- * Read data from temperhum device
+ * Stops listening for device arrivals and departures
  */
-int temperhum_recieve(temperhum_device * device, unsigned char * response, int length)
-{	
-	int size = libusb_control_transfer(
-		device->handle, 
-		LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_IN,
-		0x01, // HID Get_Report
-		3 << 8, // HID input
-		device->interface_number,
-		response,
-		length,
-		1000
-	);
+static void temperhum_hotplug_deregister()
+{
+	int i;
 
-	if (size < 0) {
+	if (temperhum_hotplug_registered) {
+		libusb_hotplug_deregister_callback(usb_context, temperhum_hotplug_handle);
+		temperhum_hotplug_registered = 0;
+	}
+
+	for (i = 0; i < temperhum_hotplug_pending_count; i++) {
+		libusb_unref_device(temperhum_hotplug_pending[i].device);
+	}
+	temperhum_hotplug_pending_count = 0;
+}
+
+/**
+ * Applies queued device arrivals and departures to the list of devices
+ */
+static void temperhum_hotplug_process()
+{
+	struct timeval tv = {0, 0};
+	int i;
+
+	// pick up events which happened while nobody was reading devices
+	libusb_handle_events_timeout_completed(usb_context, &tv, NULL);
+
+	for (i = 0; i < temperhum_hotplug_pending_count; i++) {
+		libusb_device *dev = temperhum_hotplug_pending[i].device;
+
+		if (temperhum_hotplug_pending[i].event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+			if (!temperhum_attached(dev)) {
+				temperhum_debug("Device arrived @ %03u:%03u", libusb_get_bus_number(dev), libusb_get_device_address(dev));
+				temperhum_attach(dev);
+			}
+		} else {
+			temperhum_debug("Device left @ %03u:%03u", libusb_get_bus_number(dev), libusb_get_device_address(dev));
+			temperhum_detach(dev);
+		}
+		libusb_unref_device(dev);
+	}
+	temperhum_hotplug_pending_count = 0;
+}
+
+/**
+ * Checks whether a device is waiting to be reopened after reset
+ */
+static int temperhum_find_resetting()
+{
+	temperhum_device *d;
+	for (d = temperhum_root_device; d; d = d->next) {
+		if (!d->handle) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Removes devices which did not come back in time after reset
+ */
+static void temperhum_forget_lost()
+{
+	temperhum_device **link = &temperhum_root_device;
+	int64_t now = temperhum_monotonic_us();
+
+	while (*link) {
+		temperhum_device *d = *link;
+		if (!d->handle && d->retry_at <= now) {
+			temperhum_error(0, "Device in port %s did not come back after reset", d->port_path);
+			*link = d->next;
+			temperhum_close_device(d);
+			temperhum_devices_generation++;
+		} else {
+			link = &d->next;
+		}
+	}
+}
+
+/**
+ * Whether the list of devices is kept up to date by usb hotplug events,
+ * so there is no need to reopen devices to notice changes
+ */
+int temperhum_hotplug_enabled()
+{
+	return temperhum_hotplug_registered;
+}
+
+/**
+ * Number which changes every time a device is added to or removed from
+ * the list returned by temperhum_find()
+ */
+unsigned int temperhum_generation()
+{
+	return temperhum_devices_generation;
+}
+
+/**
+ * Lists usb devices and attaches the temperhum ones which are not attached yet
+ */
+static int temperhum_usb_scan()
+{
+	// register before scanning, so devices plugged in meanwhile are not missed
+	temperhum_hotplug_register();
+
+	libusb_device **devs;
+	libusb_device *dev;
+
+	int num_devs = libusb_get_device_list(usb_context, &devs);
+	if (num_devs < 0) {
+		return -1;
+	}
+
+	temperhum_debug("Found %i usb devices", num_devs);
+
+	int i = 0;
+	while ((dev = devs[i++]) != NULL) {
+		if (!temperhum_attached(dev)) {
+			temperhum_attach(dev);
+		}
+	}
+
+	libusb_free_device_list(devs, 1);
+	temperhum_debug("Finished listing devices");
+
+	return 0;
+}
+
+/**
+ * Finds all matching temperhum devices
+ */
+temperhum_device * temperhum_find()
+{
+	if (temperhum_hotplug_registered) {
+		temperhum_hotplug_process();
+	}
+	temperhum_forget_lost();
+
+	// the bus is listed again to find devices coming back into their ports after reset
+	int resetting = temperhum_find_resetting();
+	if ((temperhum_root_device && !resetting) || (temperhum_scanned && temperhum_hotplug_registered)) {
+		return temperhum_root_device;
+	}
+
+	if (temperhum_transport->scan() < 0) {
+		return NULL;
+	}
+	temperhum_scanned = 1;
+
+	return temperhum_root_device;
+}
+
+/**
+ * Reset temperhum root device
+ */
+void temperhum_reset_devices()
+{
+	int res, devices_existed = 0;
+	if (!temperhum_root_device) {
+		temperhum_find();
+	} else {
+		devices_existed = 1;
+	}
+
+	if (temperhum_root_device) {
+		temperhum_device *d = temperhum_root_device;
+		while (d) {
+			temperhum_device *next = d->next;
+
+			temperhum_debug("Resetting device @ %03u:%03u", d->bus_number, d->device_number);
+			res = d->handle ? temperhum_transport->reset(d) : -1;
+			if (res < 0) {
+				temperhum_debug("Warning: cannot reset device");
+			}
+			d = next;
+		}
+		temperhum_close_devices();
+		if (devices_existed) {
+			temperhum_find();
+		}
+	}
+
+	// After powerup the device needs 11ms to reach its 
+	// "sleep" state. No commands should be sent before that time. 
+	usleep(20000);
+}
+
+/**
+ * Resets a usb device and claims its interface again, closes the handle
+ * if the device reenumerates or cannot be claimed
+ */
+static int temperhum_usb_reset(temperhum_device * d)
+{
+	int res;
+
+	libusb_release_interface(d->handle, d->interface_number);
+	res = libusb_reset_device(d->handle);
+	if (res == LIBUSB_ERROR_NOT_FOUND || res == LIBUSB_ERROR_NO_DEVICE) {
+		temperhum_debug("Device in port %s reenumerates after reset", d->port_path);
+	} else {
+		if (res < 0) {
+			temperhum_debug("Warning: cannot reset device");
+		}
+		res = libusb_claim_interface(d->handle, d->interface_number);
+		if (res < 0) {
+			temperhum_debug("Warning: cannot claim interface %u after reset", d->interface_number);
+		}
+	}
+
+	if (res < 0) {
+		libusb_close(d->handle);
+		d->handle = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * Resets a single failing device. If the device reenumerates it gets closed
+ * and is reopened by temperhum_find() when it shows up in the same port again.
+ */
+static void temperhum_reset_device(temperhum_device * d)
+{
+	temperhum_debug("Resetting device @ %03u:%03u, port %s", d->bus_number, d->device_number, d->port_path);
+	d->state = TEMPERHUM_STATE_RESETTING;
+	d->initialized = 0;
+	d->metrics.counter[TEMPERHUM_COUNTER_RESETS]++;
+
+	if (temperhum_transport->reset(d) < 0) {
+		// wait for the device to be found in its port again
+		d->handle = NULL;
+		d->device = NULL;
+		d->retry_at = temperhum_monotonic_us() + TEMPERHUM_RESET_TIMEOUT;
+		return;
+	}
+	d->state = TEMPERHUM_STATE_CLAIMED;
+
+	// After powerup the device needs 11ms to reach its 
+	// "sleep" state. No commands should be sent before that time. 
+	usleep(20000);
+}
+
+/**
+ * Moves a device through its health states after it has been read. A device
+ * which keeps failing is reset and then read less and less often.
+ */
+static void temperhum_update_health(temperhum_device * d)
+{
+	if (d->fill_result > 0) {
+		if (d->failures) {
+			temperhum_debug("Device in port %s recovered after %i failures", d->port_path, d->failures);
+		}
+		d->failures = 0;
+		d->state = TEMPERHUM_STATE_CLAIMED;
+		return;
+	}
+
+	d->failures++;
+	if (d->failures < TEMPERHUM_FAILING_LIMIT) {
+		d->state = TEMPERHUM_STATE_FAILING;
+		return;
+	}
+
+	temperhum_reset_device(d);
+	if (!d->handle) {
+		return;
+	}
+
+	int64_t backoff = 1000000LL << (d->failures - TEMPERHUM_FAILING_LIMIT < 16 ? d->failures - TEMPERHUM_FAILING_LIMIT : 16);
+	if (backoff > TEMPERHUM_MAX_BACKOFF) {
+		backoff = TEMPERHUM_MAX_BACKOFF;
+	}
+	d->state = TEMPERHUM_STATE_BACKED_OFF;
+	d->retry_at = temperhum_monotonic_us() + backoff;
+	temperhum_debug("Device in port %s failed %i times, next try in %lli ms", d->port_path, d->failures, (long long) backoff / 1000);
+}
+
+/**
+ * Whether a device should be read now
+ */
+static int temperhum_ready(temperhum_device * d, int64_t now)
+{
+	if (!d->handle || d->state == TEMPERHUM_STATE_RESETTING || d->state == TEMPERHUM_STATE_OPEN) {
+		return 0;
+	}
+
+	return d->state != TEMPERHUM_STATE_BACKED_OFF || d->retry_at <= now;
+}
+
+/**
+ * Synchronous HID Set_Report or Get_Report transfer to a usb device
+ */
+static int temperhum_usb_control(temperhum_device * device, int direction, unsigned char * data, int length, int timeout)
+{
+	if (direction == TEMPERHUM_TRANSFER_OUT) {
+		return libusb_control_transfer(
+			device->handle,
+			LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_OUT,
+			0x09, // HID Set_Report
+			2 << 8, // HID output
+			device->interface_number,
+			data,
+			length,
+			timeout
+		);
+	}
+
+	return libusb_control_transfer(
+		device->handle,
+		LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_IN,
+		0x01, // HID Get_Report
+		3 << 8, // HID input
+		device->interface_number,
+		data,
+		length,
+		timeout
+	);
+}
+
+/**
+ * Hands a finished usb transfer over to the api
+ */
+static void LIBUSB_CALL temperhum_usb_callback(struct libusb_transfer *transfer)
+{
+	temperhum_transport_complete(
+		transfer->user_data,
+		transfer->status == LIBUSB_TRANSFER_COMPLETED ? 0 : transfer->status,
+		libusb_control_transfer_get_data(transfer),
+		transfer->actual_length
+	);
+}
+
+/**
+ * Submits an asynchronous HID Set_Report or Get_Report transfer to a usb device,
+ * the setup packet goes into the header in front of data
+ */
+static int temperhum_usb_submit(temperhum_device * device, int direction, unsigned char * buffer, int length, int timeout, void * user_data)
+{
+	struct libusb_transfer *transfer = libusb_alloc_transfer(0);
+	if (!transfer) {
+		return LIBUSB_ERROR_NO_MEM;
+	}
+
+	if (direction == TEMPERHUM_TRANSFER_OUT) {
+		libusb_fill_control_setup(
+			buffer,
+			LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_OUT,
+			0x09, // HID Set_Report
+			2 << 8, // HID output
+			device->interface_number,
+			length
+		);
+	} else {
+		libusb_fill_control_setup(
+			buffer,
+			LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_INTERFACE | LIBUSB_ENDPOINT_IN,
+			0x01, // HID Get_Report
+			3 << 8, // HID input
+			device->interface_number,
+			length
+		);
+	}
+	libusb_fill_control_transfer(transfer, device->handle, buffer, temperhum_usb_callback, user_data, timeout);
+	transfer->flags = LIBUSB_TRANSFER_FREE_TRANSFER;
+
+	int res = libusb_submit_transfer(transfer);
+	if (res < 0) {
+		libusb_free_transfer(transfer);
+	}
+
+	return res;
+}
+
+/**
+ * Completes usb transfers, waits up to timeout us
+ */
+static int temperhum_usb_handle_events(int64_t timeout)
+{
+	struct timeval tv = {timeout / 1000000, timeout % 1000000};
+	int res = libusb_handle_events_timeout_completed(usb_context, &tv, NULL);
+
+	return res == LIBUSB_ERROR_INTERRUPTED ? 0 : res;
+}
+
+const struct temperhum_transport temperhum_usb_transport = {
+	"usb",
+	temperhum_usb_init,
+	temperhum_usb_exit,
+	temperhum_usb_scan,
+	temperhum_usb_control,
+	temperhum_usb_submit,
+	temperhum_usb_handle_events,
+	temperhum_usb_reset,
+	temperhum_usb_close
+};
+
+/**
+ * Send a command to temperhum device
+ */
+int temperhum_send(temperhum_device * device, unsigned char * request, int length)
+{
+	temperhum_debug("Sending %i bytes of data to interface %u of USB device at %03u:%03u:", length, device->interface_number, device->bus_number, device->device_number);
+	temperhum_debug_bytes(request, length);
+	
+	int64_t start = temperhum_monotonic_us();
+	int size = temperhum_transport->control(device, TEMPERHUM_TRANSFER_OUT, request, length, TEMPERHUM_TRANSFER_TIMEOUT);
+	int64_t duration = temperhum_monotonic_us() - start;
+	temperhum_capture_transfer(device, TEMPERHUM_TRANSFER_OUT, size < 0 ? size : 0, request, size, duration);
+	temperhum_histogram_record(&device->metrics.latency[TEMPERHUM_LATENCY_SEND], duration);
+
+	if (size <= 0) {
+		temperhum_error(0, "Writing to temperhum @ %03u:%03u failed: %i", device->bus_number, device->device_number, size);
+		temperhum_count_failure(device, temperhum_error_counter(size));
+
+		return -1;
+	} else if (size != length) {
+		temperhum_error(0, "Written to temperhum only %i of %i bytes", size, length);
+		temperhum_count_failure(device, TEMPERHUM_COUNTER_TRANSFER_ERRORS);
+
+		return -1;
+	}
+
+	temperhum_debug("Written %i bytes", size);
+	return size;
+}
+
+/**
+ * Read data from temperhum device
+ */
+int temperhum_recieve(temperhum_device * device, unsigned char * response, int length)
+{	
+	int64_t start = temperhum_monotonic_us();
+	int size = temperhum_transport->control(device, TEMPERHUM_TRANSFER_IN, response, length, TEMPERHUM_TRANSFER_TIMEOUT);
+	int64_t duration = temperhum_monotonic_us() - start;
+	temperhum_capture_transfer(device, TEMPERHUM_TRANSFER_IN, size < 0 ? size : 0, response, size, duration);
+	temperhum_histogram_record(&device->metrics.latency[TEMPERHUM_LATENCY_RECEIVE], duration);
+
+	if (size < 0) {
 		temperhum_error(0, "Read of data from the sensor failed at interafce %u: %i", device->interface_number, size);
+		temperhum_count_failure(device, temperhum_error_counter(size));
+
+		return size;
+	} else if (size == 0) {
+		temperhum_error(0, "No data was read from the sensor at interface %u (timeout)", device->interface_number);
+		temperhum_count_failure(device, TEMPERHUM_COUNTER_TIMEOUTS);
+
+		return -1;
+	}
+
+	if (size == length) {
+		temperhum_debug("Warning: data buffer full, may have lost some data");
+	}
+	temperhum_debug("Read %i bytes of data:", size);
+	temperhum_debug_bytes(response, size);
+
+	return size;
+}
+
+/**
+ * Build the 80 byte command sequence wrapping a request for the sensor
+ */
+static void temperhum_build_command(unsigned char * command, unsigned char * request, int request_length)
+{
+	static const unsigned char command_template[TEMPERHUM_COMMAND_LENGTH] = {
+		0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x02, 0x00, // issue a command
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // request
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // padding to clear the i2c bus as per the Philips i2c spec, x7
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x01, 0x00  // query command
+	};
+
+	memcpy(command, command_template, sizeof(command_template));
+
+	int i;
+	for (i = 0; i < request_length; i++) {
+		command[i + 8] = request[i];
+	}
+}
+
+/**
+ * Choose how long to wait between a request and reading the response
+ */
+void temperhum_set_wait_policy(int policy)
+{
+	temperhum_wait_policy = policy;
+}
+
+/**
+ * Time in us the SHT1x needs for a single measurement at given resolution
+ */
+static int temperhum_sht1x_measurement_time(int resolution)
+{
+	/**
+	 * According to Sensirion datasheet for SHT1x the time for
+	 * 8/12/14 bit measurements is 20/80/320 ms.
+	 */
+	if (resolution <= 8) {
+		return 20000;
+	} else if (resolution <= 12) {
+		return 80000;
+	}
+	return 320000;
+}
+
+/**
+ * Time in us to wait for the sensor before reading its response
+ */
+static int temperhum_settle_time(temperhum_device * device)
+{
+	if (temperhum_wait_policy == TEMPERHUM_WAIT_FIXED) {
+		return TEMPERHUM_SETTLE_TIME;
+	}
+
+	if (!device->settle_time) {
+		/**
+		 * Start from the datasheet time of both configured measurements,
+		 * one request makes the sensor measure temperature and then
+		 * humidity. temperhum_settle_backoff() makes it longer for
+		 * sensors which turn out to need more
+		 */
+		int resolution_temperature = device->measurement_resolution_temperature ? device->measurement_resolution_temperature : DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE;
+		int resolution_humidity = device->measurement_resolution_humidity ? device->measurement_resolution_humidity : DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY;
+		int time_temperature = temperhum_sht1x_measurement_time(resolution_temperature);
+		int time_humidity = temperhum_sht1x_measurement_time(resolution_humidity);
+
+		device->settle_time = time_temperature + time_humidity;
+		temperhum_debug("Initial settle time for device @ %03u:%03u: %i us", device->bus_number, device->device_number, device->settle_time);
+	}
+
+	return device->settle_time;
+}
+
+/**
+ * Make the sensor wait longer after it has returned spurious data
+ */
+static void temperhum_settle_backoff(temperhum_device * device)
+{
+	if (temperhum_wait_policy == TEMPERHUM_WAIT_FIXED) {
+		return;
+	}
+
+	int step = device->settle_time / 4;
+	if (step < 20000) {
+		step = 20000;
+	}
+	if (device->settle_time > device->settle_floor) {
+		device->settle_floor = device->settle_time;
+	}
+	device->settle_clean = 0;
+	device->settle_time += step;
+	if (device->settle_time > TEMPERHUM_MAX_SETTLE_TIME) {
+		device->settle_time = TEMPERHUM_MAX_SETTLE_TIME;
+	}
+	temperhum_debug("Settle time for device @ %03u:%03u increased to %i us", device->bus_number, device->device_number, device->settle_time);
+}
+
+/**
+ * Make the sensor wait shorter after a number of good reads, sensors are
+ * often faster than the datasheet. The time never goes down to one the
+ * sensor returned garbage after, so it settles just above the time it needs.
+ */
+static void temperhum_settle_learn(temperhum_device * device)
+{
+	if (temperhum_wait_policy == TEMPERHUM_WAIT_FIXED || ++device->settle_clean < TEMPERHUM_SETTLE_LEARN_READS) {
+		return;
+	}
+	device->settle_clean = 0;
+
+	int shorter = device->settle_time - device->settle_time / 8;
+	if (shorter < TEMPERHUM_MIN_SETTLE_TIME) {
+		shorter = TEMPERHUM_MIN_SETTLE_TIME;
+	}
+	if (shorter <= device->settle_floor || shorter == device->settle_time) {
+		return;
+	}
+	device->settle_time = shorter;
+	temperhum_debug("Settle time for device @ %03u:%03u decreased to %i us", device->bus_number, device->device_number, device->settle_time);
+}
+
+/**
+ * Issue a query to temperhum device sending a request command and reading response data
+ */
+int temperhum_request(temperhum_device * device, unsigned char * request, unsigned char * response, int request_length, int response_length)
+{
+	unsigned char command[TEMPERHUM_COMMAND_LENGTH];
+	temperhum_build_command(command, request, request_length);
+
+	int res;
+	//unsigned char subcommand[8];
+	//int size = sizeof(subcommand);
+	//for (i = 0; i < 10; i++) {
+	//	memcpy(subcommand, &command[i * size], size);
+	//	res = temperhum_send(device, subcommand, size);
+	//	if (res < 0) {
+	//		return res;
+	//	}
+	//}
+
+	res = temperhum_send(device, command, sizeof(command));
+	if (res < 0) {
+		return res;
+	}
+	
+	/** 
+	 * According to Sensirion datasheet for SHT1x the time for
+	 * 8/12/14 bit measurements is 20/80/320 ms. Trial and error
+	 * suggests that sleeping less that 400ms can produce spurious
+	 * measurements, so with the fixed policy we always sleep that
+	 * long while the adaptive one learns the time per device
+	 */
+	int64_t start = temperhum_monotonic_us();
+	usleep(temperhum_settle_time(device) * temperhum_time_scale);
+	temperhum_histogram_record(&device->metrics.latency[TEMPERHUM_LATENCY_SETTLE], temperhum_monotonic_us() - start);
+	
+	return temperhum_recieve(device, response, response_length);
+}
+
+/**
+ * Resolves sensor voltage and measurement resolutions of a device into the
+ * converter used for its readings, missing values are set to defaults.
+ * Has to be called again when the calibration of the device changes.
+ */
+int temperhum_calibrate(temperhum_device * device)
+{
+	if (!device->sensor_voltage) {
+		device->sensor_voltage = DEFAULT_SENSOR_VOLTAGE;
+	}
+	if (!device->measurement_resolution_temperature) {
+		device->measurement_resolution_temperature = DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE;
+	}
+	if (!device->measurement_resolution_humidity) {
+		device->measurement_resolution_humidity = DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY;
+	}
+
+	struct temperhum_calibration calibration = {
+		device->sensor_voltage,
+		device->measurement_resolution_temperature,
+		device->measurement_resolution_humidity
+	};
+	device->converter = temperhum_sht1x_converter(&calibration);
+
+	return device->converter ? 0 : -1;
+}
+
+/**
+ * Converter of a device, devices which were never calibrated are calibrated now
+ */
+static const struct temperhum_sht1x * temperhum_converter(temperhum_device * device)
+{
+	if (!device->converter && temperhum_calibrate(device) < 0) {
+		temperhum_error(1, "Wrong calibration of temperhum @ %03u:%03u", device->bus_number, device->device_number);
+	}
+
+	return device->converter;
+}
+
+/**
+ * Fill temperature value in a temperhum device struct when raw data is read
+ */
+void temperhum_sht1x_fill_temperature(temperhum_device * device)
+{
+	/**
+	 * This calculation is based on the FM75 datasheet, and converts
+	 * from two separate data bytes to a single integer, which is
+	 * needed for all currently supported temperature sensors.
+	 * BUT it is clarified by masterb here: http://relavak.wordpress.com/2009/10/17/temper-temperature-sensor-linux-driver/
+	 */
+	int most_significant_byte = device->raw_temperature_bytes[0] << 8;
+	int last_significant_byte = device->raw_temperature_bytes[1] & 0xFF; // makes it an unsigned int
+	device->raw_temperature = most_significant_byte + last_significant_byte;
+	temperhum_debug("Raw temperature read: %i, msb: %i, lsb: %i", device->raw_temperature, most_significant_byte, last_significant_byte);
+
+	/**
+	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
+	 * Humidity and Temperature Sensor IC:
+	 * 
+	 * The band-gap PTAT (Proportional To Absolute 
+     * Temperature) temperature sensor is very linear by design. 
+	 * Use the following formula to convert digital readout (SOT) 
+	 * to temperature value, with coefficients given in Table 8.
+	 *   T = D1 + D2 * SOT;
+	 * Table 8.1:
+	 * +---------+-------+-------+-------+-------+-------+
+	 * | VDD ->  |    5V |    4V |  3.5V |    3V |  2.5V |
+	 * +---------+-------+-------+-------+-------+-------+
+	 * | D1 (�C) | -40.1 | -39.8 | -39.7 | -39.6 | -39.4 |
+	 * +---------+-------+-------+-------+-------+-------+
+	 * | D1 (�F) | -40.2 | -39.6 | -39.5 | -39.3 | -38.9 |
+	 * +---------+-------+-------+-------+-------+-------+
+	 * Table 8.2:
+	 * +---------+-------+-------+
+	 * | SOT ->  | 14bit | 12bit |
+	 * +---------+-------+-------+
+	 * | D2 (�C) |  0.01 |  0.04 |
+	 * +---------+-------+-------+
+	 * | D2 (�F) | 0.018 | 0.072 |
+	 * +---------+-------+-------+
+	 */
+	const struct temperhum_sht1x *sht1x = temperhum_converter(device);
+#ifdef TEMPERHUM_FIXED_POINT
+	device->temperature = temperhum_sht1x_temperature_fixed(sht1x, device->raw_temperature) / 100.0;
+#else
+	device->temperature = sht1x->d1 + sht1x->d2 * device->raw_temperature;
+#endif
+	temperhum_debug("Compensated temperature: %.2f", device->temperature);
+}
+
+/**
+ * Fill humidity value in a temperhum device struct when raw data is read
+ */
+void temperhum_sht1x_fill_humidity(temperhum_device * device)
+{
+	/**
+	 * @see temperhum_sht1x_fill_temperature()
+	 */
+	int most_significant_byte = (device->raw_humidity_bytes[0] & 0xFF) << 8; // make it unsigned int and shift left 8 bits
+	int last_significant_byte = device->raw_humidity_bytes[1] & 0xFF; // make it unsigned int
+	device->raw_humidity = most_significant_byte + last_significant_byte;
+	temperhum_debug("Raw humidity read: %i, msb: %i, lsb: %i", device->raw_humidity, most_significant_byte, last_significant_byte);
+
+	/**
+	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
+	 * Humidity and Temperature Sensor IC:
+	 * 
+	 * For compensating non-linearity of the humidity sensor
+	 * and for obtaining the full accuracy of the 
+	 * sensor it is recommended to convert the humidity readout
+	 * (SORH) with the following formula with coefficients given in 
+	 * Table 6.
+	 *   RH_linear = C1 + C2 * SORH + C3 * (SORH ^ 2)
+	 * Table 6:
+	 * +---------+------------+------------+
+	 * | SORH -> |     12 bit |      8 bit |
+	 * +---------+------------+------------+
+	 * | C1      |    -2.0468 |    -2.0468 |
+	 * +---------+------------+------------+ 
+	 * | C2      |     0.0367 |     0.5872 |
+	 * +---------+------------+------------+
+	 * | C3      | -1.5955E-6 | -4.0845E-4 |
+	 * +---------+------------+------------+
+	 */
+	const struct temperhum_sht1x *sht1x = temperhum_converter(device);
+#ifdef TEMPERHUM_FIXED_POINT
+	int sorh = device->raw_humidity;
+	int32_t temperature = temperhum_sht1x_temperature_fixed(sht1x, device->raw_temperature);
+	device->humidity = temperhum_sht1x_humidity_fixed(sht1x, temperature, sorh) / 100.0;
+#else
+	// readings above the resolution can only be garbage, they take the last entry of the tables
+	int sorh = temperhum_sht1x_index(sht1x, device->raw_humidity);
+	double humidity_linear = sht1x->linear[sorh];
+	temperhum_debug("Linear humidity: %.4f", humidity_linear);
+
+	/**
+	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
+	 * Humidity and Temperature Sensor IC:
+	 * 
+	 * For temperatures significantly different from 25�C (~77�F) 
+	 * the humidity signal requires temperature compensation.
+	 * The temperature correction corresponds roughly to 
+	 * 0.12%RH/�C @ 50%RH. Coefficcients for the temperature 
+	 * compensation are given in Table 7. 
+	 *   RH = (TempC - 25) * (T1 + T2 * SORH) + RH_linear
+	 * +---------+---------+---------+
+	 * | SORH -> |  12 bit |   8 bit |
+	 * +---------+---------+---------+
+	 * | T1      |    0.01 |    0.01 |
+	 * +---------+---------+---------+ 
+	 * | T2      | 0.00008 | 0.00128 |
+	 * +---------+---------+---------+
+	 */
+	float compensation = sht1x->compensation[sorh];
+	device->humidity = (device->temperature - 25) * compensation + humidity_linear;
+#endif
+	temperhum_debug("Compensated humidity: %.4f", device->humidity);
+}
+
+/**
+ * Dew point in C for a temperature in C and a relative humidity in %
+ */
+double temperhum_dew_point(double temperature, double humidity)
+{
+	/**
+	 * SHT1x is not measuring dew point directly, however dew 
+	 * point can be derived from humidity and temperature 
+	 * readings. Since humidity and temperature are both 
+	 * measured on the same monolithic chip, the SHT1x allows 
+	 * superb dew point measurements.  
+	 * For dew point (Td) calculations there are various formulas 
+	 * to be applied, most of them quite complicated. For  the 
+	 * temperature range of -40 - 50�C the following 
+	 * approximation provides good accuracy with parameters 
+	 * given in Table 9:
+	 * +-----------------------+---------+-------+
+	 * | Temperature Range     | Tn (�C) |   m   |
+	 * +-----------------------+---------+-------+
+	 * | Above water, 0 - 50�C |  243.12 | 17.62 |
+	 * +-----------------------+---------+-------+
+	 * | Above ice, -40 - 0�C  |  272.62 | 22.46 |
+	 * +-----------------------+---------+-------+
+	 */
+	double Tn = 243.12;
+	double m = 17.62;
+	if (temperature < 0) {
+		Tn = 272.62;
+		m = 22.46;
+	}
+	double gamma = log(humidity / 100) + m * temperature / (Tn + temperature);
+
+	return Tn * gamma / (m - gamma);
+}
+
+/**
+ * Check a measurement response of the sensor for data known to be wrong
+ */
+static int temperhum_check_response(temperhum_device * device, unsigned char * response)
+{
+	int result = 1;
+
+	// If 5th - 8th bytes are FFs device reports bad data (found that trial and error)
+	if (response[4] == 0xFF) {
+		temperhum_error(0, "Returned data appears to be wrong");
+		device->metrics.counter[TEMPERHUM_COUNTER_BAD_DATA]++;
+		temperhum_settle_backoff(device);
+		device->initialized = 0;
+		result = -1;
+	} else {
+		temperhum_settle_learn(device);
+	}
+
+	// If only zeros returned that is an error
+	if (response[0] == 0x00 && response[1] == 0x00 && response[2] == 0x00 && response[3] == 0x00) {
+		temperhum_error(1, "Returned data appears to be wrong (only zeros returned)");
+	}
+
+	return result;
+}
+
+/**
+ * Convert a measurement response of the sensor into values of a temperhum device struct
+ */
+static void temperhum_parse_response(temperhum_device * device, unsigned char * response)
+{
+	device->raw_temperature_bytes[0] = response[0];
+	device->raw_temperature_bytes[1] = response[1];
+	temperhum_debug("Raw temperature bytes: {0x%02X, 0x%02X}", device->raw_temperature_bytes[0] & 0xFF, device->raw_temperature_bytes[1] & 0xFF);
+	temperhum_sht1x_fill_temperature(device);
+
+	device->raw_humidity_bytes[0] = response[2];
+	device->raw_humidity_bytes[1] = response[3];
+	temperhum_debug("Raw humidity bytes: {0x%02X, 0x%02X}", device->raw_humidity_bytes[0] & 0xFF, device->raw_humidity_bytes[1] & 0xFF);
+	temperhum_sht1x_fill_humidity(device);
+
+#ifdef TEMPERHUM_FIXED_POINT
+	int32_t temperature = temperhum_sht1x_temperature_fixed(device->converter, device->raw_temperature);
+	int32_t dew_point = temperhum_sht1x_dew_point_fixed(device->converter, temperature, device->raw_humidity);
+	device->dew_point = dew_point == TEMPERHUM_FIXED_INVALID ? NAN : dew_point / 100.0;
+#elif defined(TEMPERHUM_FAST_DEW_POINT)
+	device->dew_point = temperhum_dew_point_fast(device->temperature, device->humidity);
+#else
+	device->dew_point = temperhum_dew_point(device->temperature, device->humidity);
+#endif
+	temperhum_debug("Calculated dew point: %.2f", device->dew_point);
+}
+
+/**
+ * Marks the values parsed last as read now and adds them to the rolling statistics
+ */
+static void temperhum_sampled(temperhum_device * device)
+{
+	double values[TEMPERHUM_STATS_VALUES] = {device->temperature, device->humidity, device->dew_point};
+
+	device->sampled_at = temperhum_wallclock_ms();
+	temperhum_stats_add(&device->stats, device->sampled_at, values);
+}
+
+/**
+ * Reads a device for temperhum_fill()
+ */
+static int temperhum_fill_device(temperhum_device * device)
+{
+	unsigned char response[TEMPERHUM_RESPONSE_LENGTH];
+	unsigned char init_response[TEMPERHUM_RESPONSE_LENGTH];
+	
+	time_t rawtime;
+	struct tm * timeinfo;
+	char time_string[24];
+
+	time(&rawtime);
+	timeinfo = localtime(&rawtime);
+	strftime(time_string, 24, "%Y-%m-%d %H:%M:%S", timeinfo);
+	temperhum_debug("==== %s ====", time_string);
+
+	bzero(device->raw_temperature_bytes, sizeof(device->raw_temperature_bytes));
+	bzero(device->raw_humidity_bytes, sizeof(device->raw_humidity_bytes));
+
+	if (!device->handle) {
+		temperhum_error(0, "Device in port %s is not open", device->port_path);
+		return -1;
+	}
+
+	int res, attempts = 0;
+	while (1) {
+		// sensor keeps its initialization until it is reopened, reset or returns bad data
+		if (!device->initialized) {
+			res = temperhum_request(device, temperhum_init_request, init_response, sizeof(temperhum_init_request), sizeof(init_response));
+			if (res < 0) {
+				return res;
+			}
+			device->initialized = 1;
+		}
+
+		res = temperhum_request(device, temperhum_measure_request, response, sizeof(temperhum_measure_request), sizeof(response));
+		if (res < 0) {
+			device->initialized = 0;
+			return res;
+		}
+
+		if (temperhum_check_response(device, response) > 0 || temperhum_wait_policy == TEMPERHUM_WAIT_FIXED) {
+			break;
+		}
+		// with the adaptive policy spurious data is measured again after a longer wait
+		if (++attempts >= TEMPERHUM_MEASURE_ATTEMPTS) {
+			return -1;
+		}
+	}
+
+	temperhum_parse_response(device, response);
+	temperhum_sampled(device);
+
+	return 1;
+}
+
+/**
+ * Fill values in a temperhum device struct issuing a request command to read data from device
+ */
+int temperhum_fill(temperhum_device * device)
+{
+	int64_t start = temperhum_monotonic_us();
+	int result = temperhum_fill_device(device);
+	temperhum_histogram_record(&device->metrics.latency[TEMPERHUM_LATENCY_FILL], temperhum_monotonic_us() - start);
+
+	return result;
+}
+
+/**
+ * Stages a device passes through while it is filled asynchronously
+ */
+enum temperhum_async_stage {
+	TEMPERHUM_ASYNC_SEND_INIT,
+	TEMPERHUM_ASYNC_WAIT_INIT,
+	TEMPERHUM_ASYNC_RECIEVE_INIT,
+	TEMPERHUM_ASYNC_SEND_MEASURE,
+	TEMPERHUM_ASYNC_WAIT_MEASURE,
+	TEMPERHUM_ASYNC_RECIEVE_MEASURE,
+	TEMPERHUM_ASYNC_DONE
+};
+
+/**
+ * State of one device while all devices are being filled at once
+ */
+struct temperhum_async {
+	temperhum_device *device;
+	enum temperhum_async_stage stage;
+	int64_t deadline; /** monotonic time in us when the measurement should be ready */
+	int attempts; /** measurements which returned spurious data */
+	int64_t started; /** monotonic time in us the fill of the device started */
+	int64_t submitted; /** monotonic time in us the current transfer was submitted */
+	int64_t sent; /** monotonic time in us the last command was written */
+	unsigned char buffer[TEMPERHUM_TRANSPORT_HEADER + TEMPERHUM_RESPONSE_LENGTH];
+};
+
+/**
+ * Mark asynchronous fill of a device as finished
+ */
+static void temperhum_async_finish(struct temperhum_async *async, int result)
+{
+	temperhum_histogram_record(&async->device->metrics.latency[TEMPERHUM_LATENCY_FILL], temperhum_monotonic_us() - async->started);
+	async->device->fill_result = result;
+	if (result < 0) {
+		async->device->initialized = 0;
+	} else {
+		temperhum_sampled(async->device);
+	}
+	async->stage = TEMPERHUM_ASYNC_DONE;
+}
+
+/**
+ * Submit a Set_Report transfer carrying a request command to the device
+ */
+static void temperhum_async_send(struct temperhum_async *async, unsigned char * request, int request_length)
+{
+	temperhum_device *device = async->device;
+	unsigned char *command = async->buffer + TEMPERHUM_TRANSPORT_HEADER;
+
+	temperhum_build_command(command, request, request_length);
+	temperhum_debug("Sending %i bytes of data to interface %u of USB device at %03u:%03u:", TEMPERHUM_COMMAND_LENGTH, device->interface_number, device->bus_number, device->device_number);
+	temperhum_debug_bytes(command, TEMPERHUM_COMMAND_LENGTH);
+
+	async->submitted = temperhum_monotonic_us();
+	int res = temperhum_transport->submit(device, TEMPERHUM_TRANSFER_OUT, async->buffer, TEMPERHUM_COMMAND_LENGTH, TEMPERHUM_TRANSFER_TIMEOUT, async);
+	if (res < 0) {
+		temperhum_error(0, "Writing to temperhum @ %03u:%03u failed: %i", device->bus_number, device->device_number, res);
+		temperhum_count_failure(device, temperhum_error_counter(res));
+		temperhum_async_finish(async, -1);
+	}
+}
+
+/**
+ * Submit a Get_Report transfer reading the response of the device
+ */
+static void temperhum_async_recieve(struct temperhum_async *async)
+{
+	temperhum_device *device = async->device;
+
+	async->submitted = temperhum_monotonic_us();
+	temperhum_histogram_record(&device->metrics.latency[TEMPERHUM_LATENCY_SETTLE], async->submitted - async->sent);
+	int res = temperhum_transport->submit(device, TEMPERHUM_TRANSFER_IN, async->buffer, TEMPERHUM_RESPONSE_LENGTH, TEMPERHUM_TRANSFER_TIMEOUT, async);
+	if (res < 0) {
+		temperhum_error(0, "Read of data from the sensor failed at interafce %u: %i", device->interface_number, res);
+		temperhum_count_failure(device, temperhum_error_counter(res));
+		temperhum_async_finish(async, -1);
+	}
+}
+
+/**
+ * Start a measurement, initializing the sensor first if it has not been yet
+ */
+static void temperhum_async_start(struct temperhum_async *async)
+{
+	if (async->device->initialized) {
+		async->stage = TEMPERHUM_ASYNC_SEND_MEASURE;
+		temperhum_async_send(async, temperhum_measure_request, sizeof(temperhum_measure_request));
+	} else {
+		async->stage = TEMPERHUM_ASYNC_SEND_INIT;
+		temperhum_async_send(async, temperhum_init_request, sizeof(temperhum_init_request));
+	}
+}
+
+/**
+ * Advance a device to its next stage when a transfer completes,
+ * called by the transport with status 0 if the transfer succeeded
+ */
+void temperhum_transport_complete(void *user_data, int status, unsigned char *data, int size)
+{
+	struct temperhum_async *async = user_data;
+	temperhum_device *device = async->device;
+	int direction = async->stage == TEMPERHUM_ASYNC_SEND_INIT || async->stage == TEMPERHUM_ASYNC_SEND_MEASURE ? TEMPERHUM_TRANSFER_OUT : TEMPERHUM_TRANSFER_IN;
+
+	int64_t now = temperhum_monotonic_us();
+	temperhum_capture_transfer(device, direction, status, data, size, now - async->submitted);
+	temperhum_histogram_record(&device->metrics.latency[direction == TEMPERHUM_TRANSFER_OUT ? TEMPERHUM_LATENCY_SEND : TEMPERHUM_LATENCY_RECEIVE], now - async->submitted);
+
+	switch (async->stage) {
+	case TEMPERHUM_ASYNC_SEND_INIT:
+	case TEMPERHUM_ASYNC_SEND_MEASURE:
+		if (status || size <= 0) {
+			temperhum_error(0, "Writing to temperhum @ %03u:%03u failed: status %i", device->bus_number, device->device_number, status);
+			temperhum_count_failure(device, temperhum_status_counter(status));
+			temperhum_async_finish(async, -1);
+			return;
+		} else if (size != TEMPERHUM_COMMAND_LENGTH) {
+			temperhum_error(0, "Written to temperhum only %i of %i bytes", size, TEMPERHUM_COMMAND_LENGTH);
+			temperhum_count_failure(device, TEMPERHUM_COUNTER_TRANSFER_ERRORS);
+			temperhum_async_finish(async, -1);
+			return;
+		}
+		temperhum_debug("Written %i bytes", size);
+
+		// see temperhum_request() on why the sensor needs this time
+		async->sent = now;
+		async->deadline = now + temperhum_settle_time(device) * temperhum_time_scale;
+		async->stage++;
+		break;
+
+	case TEMPERHUM_ASYNC_RECIEVE_INIT:
+	case TEMPERHUM_ASYNC_RECIEVE_MEASURE:
+		if (status) {
+			temperhum_error(0, "Read of data from the sensor failed at interafce %u: status %i", device->interface_number, status);
+			temperhum_count_failure(device, temperhum_status_counter(status));
+			temperhum_async_finish(async, -1);
+			return;
+		} else if (size == 0) {
+			temperhum_error(0, "No data was read from the sensor at interface %u (timeout)", device->interface_number);
+			temperhum_count_failure(device, TEMPERHUM_COUNTER_TIMEOUTS);
+			temperhum_async_finish(async, -1);
+			return;
+		}
+		if (size == TEMPERHUM_RESPONSE_LENGTH) {
+			temperhum_debug("Warning: data buffer full, may have lost some data");
+		}
+		temperhum_debug("Read %i bytes of data:", size);
+		temperhum_debug_bytes(data, size);
+
+		if (async->stage == TEMPERHUM_ASYNC_RECIEVE_INIT) {
+			device->initialized = 1;
+			temperhum_async_start(async);
+		} else if (temperhum_check_response(device, data) > 0 || temperhum_wait_policy == TEMPERHUM_WAIT_FIXED) {
+			temperhum_parse_response(device, data);
+			temperhum_async_finish(async, 1);
+		} else if (++async->attempts < TEMPERHUM_MEASURE_ATTEMPTS) {
+			temperhum_async_start(async);
+		} else {
+			temperhum_async_finish(async, -1);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+ * Fill values of given devices at once. Requests are submitted
+ * to every device at the same time and completed from a single event loop,
+ * so a cycle takes as long as one device regardless of how many are attached.
+ * Result for every device is stored in its fill_result field.
+ */
+int temperhum_fill_devices(temperhum_device ** devices, int count)
+{
+	int pending, i, result = 1;
+	temperhum_device *d;
+
+	if (!count) {
+		return 1;
+	}
+
+	struct temperhum_async *asyncs = calloc(count, sizeof(struct temperhum_async));
+	if (!asyncs) {
+		temperhum_error(0, "Cannot allocate memory for %i devices", count);
+		return -1;
+	}
+
+	time_t rawtime;
+	struct tm * timeinfo;
+	char time_string[24];
+
+	time(&rawtime);
+	timeinfo = localtime(&rawtime);
+	strftime(time_string, 24, "%Y-%m-%d %H:%M:%S", timeinfo);
+	temperhum_debug("==== %s ====", time_string);
 
-		return size;
-	} else if (size == 0) {
-		temperhum_error(0, "No data was read from the sensor at interface %u (timeout)", device->interface_number);
+	int64_t start = temperhum_monotonic_us();
+	for (i = 0; i < count; i++) {
+		struct temperhum_async *async = &asyncs[i];
+		d = async->device = devices[i];
 
-		return -1;
+		if (!temperhum_ready(d, start)) {
+			d->fill_result = 0;
+			async->stage = TEMPERHUM_ASYNC_DONE;
+			continue;
+		}
+
+		bzero(d->raw_temperature_bytes, sizeof(d->raw_temperature_bytes));
+		bzero(d->raw_humidity_bytes, sizeof(d->raw_humidity_bytes));
+		async->started = start;
+		temperhum_async_start(async);
 	}
 
-	if (size == length) {
-		temperhum_debug("Warning: data buffer full, may have lost some data");
+	do {
+		int64_t now = temperhum_monotonic_us();
+		int64_t wait = 100000;
+
+		pending = 0;
+		for (i = 0; i < count; i++) {
+			struct temperhum_async *async = &asyncs[i];
+			if (async->stage == TEMPERHUM_ASYNC_WAIT_INIT || async->stage == TEMPERHUM_ASYNC_WAIT_MEASURE) {
+				if (async->deadline <= now) {
+					async->stage++;
+					temperhum_async_recieve(async);
+				} else if (async->deadline - now < wait) {
+					wait = async->deadline - now;
+				}
+			}
+			if (async->stage != TEMPERHUM_ASYNC_DONE) {
+				pending++;
+			}
+		}
+
+		if (pending) {
+			int res = temperhum_transport->handle_events(wait);
+			if (res < 0) {
+				temperhum_debug("Warning: handling %s events failed: %i", temperhum_transport->name, res);
+			}
+		}
+	} while (pending);
+
+	for (i = 0; i < count; i++) {
+		if (asyncs[i].device->fill_result < 0) {
+			result = -1;
+		}
+		if (asyncs[i].device->fill_result != 0) {
+			temperhum_update_health(asyncs[i].device);
+		}
 	}
-	temperhum_debug("Read %i bytes of data:", size);
-	temperhum_debug_bytes(response, size);
+	free(asyncs);
 
-	return size;
+	return result;
 }
 
 /**
- * Issue a query to temperhum device sending a request command and reading response data
+ * Fill values of all devices in a list at once, see temperhum_fill_devices()
  */
-int temperhum_request(temperhum_device * device, unsigned char * request, unsigned char * response, int request_length, int response_length)
+int temperhum_fill_all(temperhum_device * device)
 {
-	unsigned char command[] = {
-		0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x02, 0x00, // issue a command
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // request
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // padding to clear the i2c bus as per the Philips i2c spec, x7
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x01, 0x00  // query command
-	};
+	int count = 0, result;
+	temperhum_device *d;
 
-	int i;
-	for (i = 0; i < request_length; i++) {
-		command[i + 8] = request[i];
+	for (d = device; d; d = d->next) {
+		count++;
+	}
+	if (!count) {
+		return 1;
 	}
 
-	int res;
-	//unsigned char subcommand[8];
-	//int size = sizeof(subcommand);
-	//for (i = 0; i < 10; i++) {
-	//	memcpy(subcommand, &command[i * size], size);
-	//	res = temperhum_send(device, subcommand, size);
-	//	if (res < 0) {
-	//		return res;
-	//	}
-	//}
+	temperhum_device **devices = malloc(count * sizeof(temperhum_device *));
+	if (!devices) {
+		temperhum_error(0, "Cannot allocate memory for %i devices", count);
+		return -1;
+	}
 
-	res = temperhum_send(device, command, sizeof(command));
-	if (res < 0) {
-		return res;
+	count = 0;
+	for (d = device; d; d = d->next) {
+		devices[count++] = d;
 	}
-	
-	/** 
-	 * According to Sensirion datasheet for SHT1x the time for
-	 * 8/12/14 bit measurements is 20/80/320 ms. Trial and error
-	 * suggests that sleeping less that 400ms can produce spurious
-	 * measurements
-	 */
-	usleep(400000);
-	
-	return temperhum_recieve(device, response, response_length);
+
+	result = temperhum_fill_devices(devices, count);
+	free(devices);
+
+	return result;
 }
 
 /**
- * Fill temperature value in a temperhum device struct when raw data is read
+ * Creates the shared memory table the daemon publishes readings to
  */
-void temperhum_sht1x_fill_temperature(temperhum_device * device)
+struct temperhum_table * temperhum_table_create(const char * name)
 {
-	/**
-	 * This calculation is based on the FM75 datasheet, and converts
-	 * from two separate data bytes to a single integer, which is
-	 * needed for all currently supported temperature sensors.
-	 * BUT it is clarified by masterb here: http://relavak.wordpress.com/2009/10/17/temper-temperature-sensor-linux-driver/
-	 */
-	int most_significant_byte = device->raw_temperature_bytes[0] << 8;
-	int last_significant_byte = device->raw_temperature_bytes[1] & 0xFF; // makes it an unsigned int
-	device->raw_temperature = most_significant_byte + last_significant_byte;
-	temperhum_debug("Raw temperature read: %i, msb: %i, lsb: %i", device->raw_temperature, most_significant_byte, last_significant_byte);
-
-	/**
-	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
-	 * Humidity and Temperature Sensor IC:
-	 * 
-	 * The band-gap PTAT (Proportional To Absolute 
-     * Temperature) temperature sensor is very linear by design. 
-	 * Use the following formula to convert digital readout (SOT) 
-	 * to temperature value, with coefficients given in Table 8.
-	 *   T = D1 + D2 * SOT;
-	 * Table 8.1:
-	 * +---------+-------+-------+-------+-------+-------+
-	 * | VDD ->  |    5V |    4V |  3.5V |    3V |  2.5V |
-	 * +---------+-------+-------+-------+-------+-------+
-	 * | D1 (�C) | -40.1 | -39.8 | -39.7 | -39.6 | -39.4 |
-	 * +---------+-------+-------+-------+-------+-------+
-	 * | D1 (�F) | -40.2 | -39.6 | -39.5 | -39.3 | -38.9 |
-	 * +---------+-------+-------+-------+-------+-------+
-	 * Table 8.2:
-	 * +---------+-------+-------+
-	 * | SOT ->  | 14bit | 12bit |
-	 * +---------+-------+-------+
-	 * | D2 (�C) |  0.01 |  0.04 |
-	 * +---------+-------+-------+
-	 * | D2 (�F) | 0.018 | 0.072 |
-	 * +---------+-------+-------+
-	 */
-	float D1, D2;
-	if (!device->sensor_voltage) {
-		device->sensor_voltage = DEFAULT_SENSOR_VOLTAGE;
-	}
-	if (device->sensor_voltage == 2.5) {
-		D1 = -39.4;
-	} else if (device->sensor_voltage > 2.5 && device->sensor_voltage <= 3.0) {
-		D1 = -39.6;
-	} else if (device->sensor_voltage > 3.0 && device->sensor_voltage <= 3.5) {
-		D1 = -39.7;
-	} else if (device->sensor_voltage > 3.5 && device->sensor_voltage <= 4.0) {
-		D1 = -39.8;
-	} else if (device->sensor_voltage > 4.0 && device->sensor_voltage <= 5.0) {
-		D1 = -40.1;
-	} else {
-		temperhum_error(1, "Wrong value for sensor voltage: %.1f", device->sensor_voltage);
+	int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+	if (fd < 0) {
+		temperhum_error(0, "Cannot open shared memory '%s'", name);
+		return NULL;
 	}
 
-	if (!device->measurement_resolution_temperature) {
-		device->measurement_resolution_temperature = DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE;
+	if (ftruncate(fd, sizeof(struct temperhum_table)) < 0) {
+		temperhum_error(0, "Cannot resize shared memory '%s'", name);
+		close(fd);
+		return NULL;
 	}
-	if (device->measurement_resolution_temperature == 14) {
-		D2 = 0.01;
-	} else if (device->measurement_resolution_temperature == 12) {
-		D2 = 0.04;
-	} else {
-		temperhum_error(1, "Wrong value of measurement resolution for temperature: %i", device->measurement_resolution_temperature);
+
+	struct temperhum_table *table = mmap(NULL, sizeof(struct temperhum_table), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (table == MAP_FAILED) {
+		temperhum_error(0, "Cannot map shared memory '%s'", name);
+		return NULL;
 	}
 
-	device->temperature = D1 + D2 * device->raw_temperature;
-	temperhum_debug("Compensated temperature: %.2f", device->temperature);
+	// readers ignore the table until it has the magic, older contents are thrown away
+	__atomic_store_n(&table->magic, 0, __ATOMIC_RELEASE);
+	memset(table->reading, 0, sizeof(table->reading));
+	table->slots = TEMPERHUM_SHM_SLOTS;
+	__atomic_store_n(&table->count, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&table->magic, TEMPERHUM_SHM_MAGIC, __ATOMIC_RELEASE);
+
+	return table;
 }
 
 /**
- * Fill humidity value in a temperhum device struct when raw data is read
+ * Publishes the last reading of a device, a device keeps its slot while
+ * it stays in the same port. Returns -1 if the table is full.
  */
-void temperhum_sht1x_fill_humidity(temperhum_device * device)
+int temperhum_table_publish(struct temperhum_table * table, temperhum_device * device)
 {
-	/**
-	 * @see temperhum_sht1x_fill_temperature()
-	 */
-	int most_significant_byte = (device->raw_humidity_bytes[0] & 0xFF) << 8; // make it unsigned int and shift left 8 bits
-	int last_significant_byte = device->raw_humidity_bytes[1] & 0xFF; // make it unsigned int
-	device->raw_humidity = most_significant_byte + last_significant_byte;
-	temperhum_debug("Raw humidity read: %i, msb: %i, lsb: %i", device->raw_humidity, most_significant_byte, last_significant_byte);
+	uint32_t count = table->count, slot;
+	struct temperhum_reading *reading;
 
-	/**
-	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
-	 * Humidity and Temperature Sensor IC:
-	 * 
-	 * For compensating non-linearity of the humidity sensor
-	 * and for obtaining the full accuracy of the 
-	 * sensor it is recommended to convert the humidity readout
-	 * (SORH) with the following formula with coefficients given in 
-	 * Table 6.
-	 *   RH_linear = C1 + C2 * SORH + C3 * (SORH ^ 2)
-	 * Table 6:
-	 * +---------+------------+------------+
-	 * | SORH -> |     12 bit |      8 bit |
-	 * +---------+------------+------------+
-	 * | C1      |    -2.0468 |    -2.0468 |
-	 * +---------+------------+------------+ 
-	 * | C2      |     0.0367 |     0.5872 |
-	 * +---------+------------+------------+
-	 * | C3      | -1.5955E-6 | -4.0845E-4 |
-	 * +---------+------------+------------+
-	 */
-	double C1, C2, C3;
-	if (!device->measurement_resolution_humidity) {
-		device->measurement_resolution_humidity = DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY;
-	}
-	C1 = -2.0468;
-	if (device->measurement_resolution_humidity == 12) {
-		C2 = 0.0367;
-		C3 = -1.5955e-6;
-	} else if (device->measurement_resolution_humidity == 8) {
-		C2 = 0.5872;
-		C3 = -4.0845e-4;
-	} else {
-		temperhum_error(1, "Wrong value of measurement resolution for humidity: %i", device->measurement_resolution_humidity);
+	for (slot = 0; slot < count; slot++) {
+		reading = &table->reading[slot];
+		if (reading->interface_number == device->interface_number && !strcmp(reading->port_path, device->port_path)) {
+			break;
+		}
 	}
-
-	double humidity_linear = C1 + C2 * device->raw_humidity + C3 * device->raw_humidity * device->raw_humidity;
-	if (humidity_linear < 0) {
-		humidity_linear = 0;
+	if (slot == TEMPERHUM_SHM_SLOTS) {
+		return -1;
 	}
-	if (humidity_linear > 99) {
-		humidity_linear = 100;
+	reading = &table->reading[slot];
+
+	// summarized before the slot is locked, readers spin only for the copy
+	struct temperhum_summary stats[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES];
+	temperhum_stats_summarize(&device->stats, device->sampled_at, stats);
+
+	// seqlock, readers retry while the sequence is odd or has changed
+	uint32_t sequence = reading->sequence;
+	__atomic_store_n(&reading->sequence, sequence + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	reading->bus_number = device->bus_number;
+	reading->device_number = device->device_number;
+	reading->interface_number = device->interface_number;
+	memcpy(reading->port_path, device->port_path, TEMPERHUM_PORT_PATH_LENGTH);
+	reading->timestamp = device->sampled_at;
+	reading->temperature = device->temperature;
+	reading->humidity = device->humidity;
+	reading->dew_point = device->dew_point;
+	memcpy(reading->stats, stats, sizeof(stats));
+
+	__atomic_store_n(&reading->sequence, sequence + 2, __ATOMIC_RELEASE);
+
+	if (slot == count) {
+		__atomic_store_n(&table->count, count + 1, __ATOMIC_RELEASE);
 	}
-	temperhum_debug("Linear humidity: %.4f", humidity_linear);
 
-	/**
-	 * Datasheet SHT1x (SHT10, SHT11, SHT15)
-	 * Humidity and Temperature Sensor IC:
-	 * 
-	 * For temperatures significantly different from 25�C (~77�F) 
-	 * the humidity signal requires temperature compensation.
-	 * The temperature correction corresponds roughly to 
-	 * 0.12%RH/�C @ 50%RH. Coefficcients for the temperature 
-	 * compensation are given in Table 7. 
-	 *   RH = (TempC - 25) * (T1 + T2 * SORH) + RH_linear
-	 * +---------+---------+---------+
-	 * | SORH -> |  12 bit |   8 bit |
-	 * +---------+---------+---------+
-	 * | T1      |    0.01 |    0.01 |
-	 * +---------+---------+---------+ 
-	 * | T2      | 0.00008 | 0.00128 |
-	 * +---------+---------+---------+
-	 */
-	float T2, T1 = 0.01;
-	if (device->measurement_resolution_humidity == 12) {
-		T2 = 0.00008;
-	} else if (device->measurement_resolution_humidity == 8) {
-		T2 = 0.00128;
-	} 
-	device->humidity = (device->temperature - 25) * (T1 + T2 * device->raw_humidity) + humidity_linear;
-	temperhum_debug("Compensated humidity: %.4f", device->humidity);
+	return 0;
 }
 
 /**
- * Fill values in a temperhum device struct issuing a request command to read data from device
+ * Maps the table published by the daemon for reading, returns NULL
+ * if the daemon does not publish readings
  */
-int temperhum_fill(temperhum_device * device)
+const struct temperhum_table * temperhum_table_open(const char * name)
 {
-	unsigned char request[] = {0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-	unsigned char response[512];
-	unsigned char init_request[] = {0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-	unsigned char init_response[512];
-	
-	time_t rawtime;
-	struct tm * timeinfo;
-	char time_string[24];
-
-	time(&rawtime);
-	timeinfo = localtime(&rawtime);
-	strftime(time_string, 24, "%Y-%m-%d %H:%M:%S", timeinfo);
-	temperhum_debug("==== %s ====", time_string);
-
-	bzero(device->raw_temperature_bytes, sizeof(device->raw_temperature_bytes));
-	bzero(device->raw_humidity_bytes, sizeof(device->raw_humidity_bytes));
-
-	int res = temperhum_request(device, init_request, init_response, sizeof(init_request), sizeof(init_response));
-	if (res < 0) {
-		return res;
+	int fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0) {
+		return NULL;
 	}
 
-	res = temperhum_request(device, request, response, sizeof(request), sizeof(response));
-	if (res < 0) {
-		return res;
+	const struct temperhum_table *table = mmap(NULL, sizeof(struct temperhum_table), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (table == MAP_FAILED) {
+		return NULL;
 	}
 
-	// If 5th - 8th bytes are FFs device reports bad data (found that trial and error)
-	if (response[4] == 0xFF) {
-		temperhum_error(0, "Returned data appears to be wrong");
+	return table;
+}
+
+/**
+ * Amount of devices in the table
+ */
+int temperhum_table_count(const struct temperhum_table * table)
+{
+	if (__atomic_load_n(&table->magic, __ATOMIC_ACQUIRE) != TEMPERHUM_SHM_MAGIC) {
+		return 0;
 	}
 
-	// If only zeros returned that is an error
-	if (response[0] == 0x00 && response[1] == 0x00 && response[2] == 0x00 && response[3] == 0x00) {
-		temperhum_error(1, "Returned data appears to be wrong (only zeros returned)");
+	return __atomic_load_n(&table->count, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * Copies a consistent snapshot of one slot, no system calls are made.
+ * Returns -1 if there is no such slot.
+ */
+int temperhum_table_read(const struct temperhum_table * table, int slot, struct temperhum_reading * reading)
+{
+	if (slot < 0 || slot >= temperhum_table_count(table)) {
+		return -1;
 	}
 
-	device->raw_temperature_bytes[0] = response[0];
-	device->raw_temperature_bytes[1] = response[1];
-	temperhum_debug("Raw temperature bytes: {0x%02X, 0x%02X}", device->raw_temperature_bytes[0] & 0xFF, device->raw_temperature_bytes[1] & 0xFF);
-	temperhum_sht1x_fill_temperature(device);
+	const struct temperhum_reading *source = &table->reading[slot];
+	uint32_t before, after;
+	do {
+		before = __atomic_load_n(&source->sequence, __ATOMIC_ACQUIRE);
+		if (before & 1) {
+			continue;
+		}
+		memcpy(reading, source, sizeof(struct temperhum_reading));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		after = __atomic_load_n(&source->sequence, __ATOMIC_RELAXED);
+	} while ((before & 1) || before != after);
 
-	device->raw_humidity_bytes[0] = response[2];
-	device->raw_humidity_bytes[1] = response[3];
-	temperhum_debug("Raw humidity bytes: {0x%02X, 0x%02X}", device->raw_humidity_bytes[0] & 0xFF, device->raw_humidity_bytes[1] & 0xFF);
-	temperhum_sht1x_fill_humidity(device);
+	reading->sequence = before;
 
-	/**
-	 * SHT1x is not measuring dew point directly, however dew 
-	 * point can be derived from humidity and temperature 
-	 * readings. Since humidity and temperature are both 
-	 * measured on the same monolithic chip, the SHT1x allows 
-	 * superb dew point measurements.  
-	 * For dew point (Td) calculations there are various formulas 
-	 * to be applied, most of them quite complicated. For  the 
-	 * temperature range of -40 - 50�C the following 
-	 * approximation provides good accuracy with parameters 
-	 * given in Table 9:
-	 * +-----------------------+---------+-------+
-	 * | Temperature Range     | Tn (�C) |   m   |
-	 * +-----------------------+---------+-------+
-	 * | Above water, 0 - 50�C |  243.12 | 17.62 |
-	 * +-----------------------+---------+-------+
-	 * | Above ice, -40 - 0�C  |  272.62 | 22.46 |
-	 * +-----------------------+---------+-------+
-	 */
-	double Tn = 243.12;
-	double m = 17.62;
-	if (device->temperature < 0) {
-		Tn = 272.62;
-		m = 22.46;
-	}
-	double gamma = log(device->humidity / 100) + m * device->temperature / (Tn + device->temperature);
-	device->dew_point = Tn * gamma / (m - gamma);
-	temperhum_debug("Calculated dew point: %.2f", device->dew_point);
+	return 0;
+}
 
-	return 1;
+/**
+ * Unmaps a table opened by temperhum_table_open() or temperhum_table_create()
+ */
+void temperhum_table_close(const struct temperhum_table * table)
+{
+	munmap((void *) table, sizeof(struct temperhum_table));
 }
@@ -11,8 +11,28 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <stdint.h>
+#include <stddef.h>
 #include <sys/types.h>
 #include <libusb.h>
+#include "temper-hum-hid-stats.h"
+#include "temper-hum-hid-histogram.h"
+
+#define TEMPERHUM_WAIT_FIXED 0 /** always wait 400ms for the sensor */
+#define TEMPERHUM_WAIT_ADAPTIVE 1 /** learn how long each sensor needs */
+#define TEMPERHUM_PORT_PATH_LENGTH 40
+#define TEMPERHUM_SHM_NAME "/temper-hum-hid" /** default name of the shared memory table */
+#define TEMPERHUM_SHM_SLOTS 64
+#define TEMPERHUM_FIXED_INVALID INT32_MIN /** fixed point dew point of a humidity of 0 % or less */
+
+/**
+ * Calibration of a sensor for converting raw readings, zeros mean defaults
+ */
+struct temperhum_calibration {
+	double sensor_voltage;
+	int measurement_resolution_temperature;
+	int measurement_resolution_humidity;
+};
 
 struct temperhum_options {
 	int debug; /** print debug messages to screen */
@@ -20,15 +40,58 @@ struct temperhum_options {
 	int syslog_initialized;
 };
 
+/**
+ * Health of a temperhum device
+ */
+enum temperhum_state {
+	TEMPERHUM_STATE_OPEN, /** usb device is open, interface is not claimed yet */
+	TEMPERHUM_STATE_CLAIMED, /** interface is claimed, device is read every cycle */
+	TEMPERHUM_STATE_FAILING, /** last reads failed, still read every cycle */
+	TEMPERHUM_STATE_RESETTING, /** usb reset was issued, waiting for the device to come back */
+	TEMPERHUM_STATE_BACKED_OFF /** device keeps failing, it is read again at retry_at */
+};
+
+/**
+ * Stages of reading a device whose time is recorded, in us
+ */
+enum temperhum_latency {
+	TEMPERHUM_LATENCY_SEND, /** Set_Report transfer of a command */
+	TEMPERHUM_LATENCY_SETTLE, /** wait for the sensor between sending a command and reading its response */
+	TEMPERHUM_LATENCY_RECEIVE, /** Get_Report transfer of a response */
+	TEMPERHUM_LATENCY_FILL, /** whole read of the device, successful or not */
+	TEMPERHUM_LATENCIES
+};
+
+enum temperhum_counter {
+	TEMPERHUM_COUNTER_TRANSFER_ERRORS, /** transfers which failed or were cut short */
+	TEMPERHUM_COUNTER_TIMEOUTS, /** transfers which timed out or returned nothing */
+	TEMPERHUM_COUNTER_BAD_DATA, /** responses of 0xFF, the sensor was not done measuring */
+	TEMPERHUM_COUNTER_RESETS, /** usb resets of the failing device */
+	TEMPERHUM_COUNTER_REENUMERATIONS, /** times the device came back into its port with a new address */
+	TEMPERHUM_COUNTERS
+};
+
+/**
+ * Self metrics of a device since it was found, only changed by the thread reading devices
+ */
+struct temperhum_metrics {
+	struct temperhum_histogram latency[TEMPERHUM_LATENCIES];
+	uint64_t counter[TEMPERHUM_COUNTERS];
+};
+
+struct temperhum_sht1x;
+
 struct temperhum_device {
 	libusb_device *device;
 	libusb_device_handle *handle;
 	uint8_t bus_number;
 	uint8_t device_number;
 	uint8_t interface_number;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH]; /** usb ports the device is plugged in, like 1-1.4 */
 	double sensor_voltage;
 	int measurement_resolution_temperature;
 	int measurement_resolution_humidity;
+	const struct temperhum_sht1x *converter; /** set by temperhum_calibrate() */
 	char raw_temperature_bytes[2];
 	char raw_humidity_bytes[2];
 	int raw_temperature;
@@ -37,19 +100,86 @@ struct temperhum_device {
 	double humidity;
 	double dew_point;
 	int kernel_driver_detached;
+	int initialized; /** init command was answered since the device was opened or reset */
+	int fill_result; /** result of the last temperhum_fill_all() for this device */
+	int settle_time; /** learned time in us the sensor needs to measure, 0 if not known yet */
+	int settle_floor; /** longest settle time the sensor returned garbage after, learning never goes down to it */
+	int settle_clean; /** good reads since the settle time was changed last */
+	enum temperhum_state state;
+	int failures; /** reads failed in a row */
+	int64_t retry_at; /** monotonic time in us to read a backed off device again or to give up waiting for it after reset */
+	int interval; /** time in ms between samples of this device */
+	int64_t next_sample; /** wall clock time in ms when the device is due to be read, 0 if not scheduled yet */
+	int64_t sampled_at; /** wall clock time in ms of the last successful read, 0 if never read */
+	struct temperhum_stats stats; /** rolling statistics of successful reads */
+	struct temperhum_metrics metrics;
 	struct temperhum_device *next; /** Pointer to the next device */
 };
 
 typedef struct temperhum_device temperhum_device;
 
+/**
+ * Latest reading of a device as published in shared memory
+ */
+struct temperhum_reading {
+	uint32_t sequence; /** odd while the slot is being written */
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	int64_t timestamp; /** wall clock time in ms of the reading */
+	double temperature;
+	double humidity;
+	double dew_point;
+	struct temperhum_summary stats[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES]; /** of temperature, humidity and dew point */
+} __attribute__((aligned(64)));
+
+/**
+ * Shared memory table with the latest reading of every device, written by
+ * the daemon only, any amount of local processes may read it
+ */
+struct temperhum_table {
+	uint32_t magic;
+	uint32_t slots;
+	uint32_t count; /** slots in use */
+	struct temperhum_reading reading[TEMPERHUM_SHM_SLOTS];
+};
+
 void temperhum_debug(const char* format, ...);
 void temperhum_error(int exit_program, const char* format, ...);
 void temperhum_debug_bytes(unsigned char * data, int length);
 void temperhum_init(int print_debug_messages, int send_debug_to_syslog, char * debug_filename);
 void temperhum_close();
+void temperhum_reinit();
 void temperhum_reset_devices();
+void temperhum_set_wait_policy(int policy);
+int temperhum_set_transport(const char * spec);
+const char * temperhum_latency_name(int latency);
+const char * temperhum_counter_name(int counter);
+int temperhum_capture_start(const char * path);
+void temperhum_capture_stop();
+void temperhum_capture_flush();
 temperhum_device * temperhum_find();
+int temperhum_hotplug_enabled();
+unsigned int temperhum_generation();
+int temperhum_calibrate(temperhum_device * device);
+void temperhum_sht1x_fill_temperature(temperhum_device * device);
+void temperhum_sht1x_fill_humidity(temperhum_device * device);
+double temperhum_dew_point(double temperature, double humidity);
+double temperhum_dew_point_fast(double temperature, double humidity);
+int temperhum_sht1x_convert(const struct temperhum_calibration * calibration, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, double * temperature, double * humidity, double * dew_point);
+int temperhum_set_simd(int enabled);
+int32_t temperhum_dew_point_fixed(int32_t temperature, int32_t humidity);
+int temperhum_sht1x_convert_fixed(const struct temperhum_calibration * calibration, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, int32_t * temperature, int32_t * humidity, int32_t * dew_point);
 int temperhum_fill(temperhum_device * device);
+int temperhum_fill_devices(temperhum_device ** devices, int count);
+int temperhum_fill_all(temperhum_device * device);
+struct temperhum_table * temperhum_table_create(const char * name);
+int temperhum_table_publish(struct temperhum_table * table, temperhum_device * device);
+const struct temperhum_table * temperhum_table_open(const char * name);
+int temperhum_table_count(const struct temperhum_table * table);
+int temperhum_table_read(const struct temperhum_table * table, int slot, struct temperhum_reading * reading);
+void temperhum_table_close(const struct temperhum_table * table);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,235 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * The file is allocated in full when it is created and stays mapped, a reading
+ * updates one row per tier in place. Rows of a tier are stored in the order
+ * of their slots, so a range of a tier is read with at most 2 copies.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "temper-hum-hid-archive.h"
+
+#define TEMPERHUM_ARCHIVE_ALIGN 4096 /** tiers start at page boundaries */
+
+static const uint32_t temperhum_archive_steps[TEMPERHUM_ARCHIVE_TIERS] = {0, 60, 3600, 86400}; /** raw step is given */
+static const uint32_t temperhum_archive_spans[TEMPERHUM_ARCHIVE_TIERS] = {86400, 30 * 86400, 731 * 86400, 3653 * 86400}; /** seconds kept */
+
+/**
+ * Builds the header of a new archive, returns the file size it needs
+ */
+static size_t temperhum_archive_layout(struct temperhum_archive_header * header, const char * port_path, uint8_t interface_number, uint32_t raw_step)
+{
+	uint64_t offset = TEMPERHUM_ARCHIVE_ALIGN;
+	int i;
+
+	memset(header, 0, sizeof(struct temperhum_archive_header));
+	memcpy(header->magic, TEMPERHUM_ARCHIVE_MAGIC, 4);
+	header->version = TEMPERHUM_ARCHIVE_VERSION;
+	header->tiers = TEMPERHUM_ARCHIVE_TIERS;
+	header->interface_number = interface_number;
+	strncpy(header->port_path, port_path, TEMPERHUM_PORT_PATH_LENGTH - 1);
+
+	for (i = 0; i < TEMPERHUM_ARCHIVE_TIERS; i++) {
+		struct temperhum_archive_tier *tier = &header->tier[i];
+		tier->step = i == TEMPERHUM_ARCHIVE_RAW ? raw_step : temperhum_archive_steps[i];
+		tier->rows = temperhum_archive_spans[i] / tier->step;
+		tier->offset = offset;
+		offset += (uint64_t) tier->rows * sizeof(struct temperhum_archive_row);
+		offset = (offset + TEMPERHUM_ARCHIVE_ALIGN - 1) / TEMPERHUM_ARCHIVE_ALIGN * TEMPERHUM_ARCHIVE_ALIGN;
+	}
+
+	return offset;
+}
+
+/**
+ * Checks that the header of an existing archive describes a file of given size
+ */
+static int temperhum_archive_valid(const struct temperhum_archive_header * header, size_t size)
+{
+	int i;
+
+	if (memcmp(header->magic, TEMPERHUM_ARCHIVE_MAGIC, 4) || header->version != TEMPERHUM_ARCHIVE_VERSION || header->tiers != TEMPERHUM_ARCHIVE_TIERS) {
+		return 0;
+	}
+	for (i = 0; i < TEMPERHUM_ARCHIVE_TIERS; i++) {
+		const struct temperhum_archive_tier *tier = &header->tier[i];
+		if (!tier->step || !tier->rows || tier->offset + (uint64_t) tier->rows * sizeof(struct temperhum_archive_row) > size) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Opens the archive of a device, creating it with all its space allocated
+ * if it does not exist. The raw tier of a new archive has a row per raw_step
+ * seconds. Returns NULL if the file cannot be created or is not an archive.
+ */
+struct temperhum_archive *temperhum_archive_open(const char * path, const char * port_path, uint8_t interface_number, uint32_t raw_step)
+{
+	struct temperhum_archive_header header;
+	struct stat status;
+
+	int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		return NULL;
+	}
+	if (fstat(fd, &status) < 0) {
+		close(fd);
+		return NULL;
+	}
+
+	size_t size = status.st_size;
+	if (!size) {
+		if (raw_step < 1 || raw_step > 86400) {
+			raw_step = raw_step ? 86400 : 1;
+		}
+		size = temperhum_archive_layout(&header, port_path, interface_number, raw_step);
+		// space is taken now, so the archive never fails to grow later
+		if (posix_fallocate(fd, 0, size) != 0 || pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+			close(fd);
+			unlink(path);
+			return NULL;
+		}
+	} else if (size < sizeof(header)) {
+		close(fd);
+		return NULL;
+	}
+
+	struct temperhum_archive *archive = malloc(sizeof(struct temperhum_archive));
+	if (!archive) {
+		close(fd);
+		return NULL;
+	}
+	archive->size = size;
+	archive->header = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (archive->header == MAP_FAILED) {
+		free(archive);
+		return NULL;
+	}
+	if (!temperhum_archive_valid(archive->header, size)) {
+		munmap(archive->header, size);
+		free(archive);
+		return NULL;
+	}
+
+	return archive;
+}
+
+/**
+ * First row of a tier
+ */
+static inline struct temperhum_archive_row *temperhum_archive_rows(const struct temperhum_archive * archive, int tier)
+{
+	return (struct temperhum_archive_row *) ((char *) archive->header + archive->header->tier[tier].offset);
+}
+
+/**
+ * Adds temperature, humidity and dew point read at given wall clock time in ms
+ * to the row of its slot in every tier. A row still holding an older slot is
+ * started anew, readings older than the slot of their row are dropped.
+ */
+void temperhum_archive_update(struct temperhum_archive * archive, int64_t timestamp, const double * values)
+{
+	int64_t seconds = timestamp / 1000;
+	int i, v;
+
+	for (i = 0; i < TEMPERHUM_ARCHIVE_TIERS; i++) {
+		const struct temperhum_archive_tier *tier = &archive->header->tier[i];
+		int64_t slot = seconds / tier->step;
+		struct temperhum_archive_row *row = &temperhum_archive_rows(archive, i)[slot % tier->rows];
+
+		if (row->timestamp > slot * tier->step) {
+			continue;
+		}
+		if (row->timestamp < slot * tier->step) {
+			memset(row, 0, sizeof(struct temperhum_archive_row));
+			row->timestamp = slot * tier->step;
+		}
+
+		for (v = 0; v < TEMPERHUM_ARCHIVE_VALUES; v++) {
+			float value = values[v];
+			if (!isfinite(value)) {
+				continue;
+			}
+			uint32_t count = ++row->count[v];
+			if (count == 1) {
+				row->average[v] = row->min[v] = row->max[v] = value;
+				continue;
+			}
+			row->average[v] += (value - row->average[v]) / count;
+			if (value < row->min[v]) {
+				row->min[v] = value;
+			}
+			if (value > row->max[v]) {
+				row->max[v] = value;
+			}
+		}
+	}
+}
+
+/**
+ * Copies rows of a tier for the slots from the one holding the from time to
+ * the one holding the to time (seconds since the epoch). Rows are consecutive
+ * slots starting at rows[0].timestamp, slots without readings have zero counts.
+ * Only slots still kept by the tier are copied. Returns amount of rows copied,
+ * at most size.
+ */
+int temperhum_archive_read(const struct temperhum_archive * archive, int tier, int64_t from, int64_t to, struct temperhum_archive_row * rows, int size)
+{
+	if (tier < 0 || tier >= TEMPERHUM_ARCHIVE_TIERS || to < from || size <= 0) {
+		return 0;
+	}
+
+	const struct temperhum_archive_tier *t = &archive->header->tier[tier];
+	const struct temperhum_archive_row *source = temperhum_archive_rows(archive, tier);
+	int64_t first = from / t->step, last = to / t->step;
+
+	if (last - first >= t->rows) {
+		first = last - t->rows + 1;
+	}
+	if (last - first >= size) {
+		last = first + size - 1;
+	}
+
+	// the range wraps around the end of the tier at most once
+	int count = last - first + 1;
+	int start = first % t->rows;
+	int head = count < (int) t->rows - start ? count : (int) t->rows - start;
+	memcpy(rows, source + start, head * sizeof(struct temperhum_archive_row));
+	memcpy(rows + head, source, (count - head) * sizeof(struct temperhum_archive_row));
+
+	int i;
+	for (i = 0; i < count; i++) {
+		int64_t timestamp = (first + i) * t->step;
+		if (rows[i].timestamp != timestamp) {
+			memset(&rows[i], 0, sizeof(struct temperhum_archive_row));
+			rows[i].timestamp = timestamp;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Writes changed rows to disk and unmaps the archive
+ */
+void temperhum_archive_close(struct temperhum_archive * archive)
+{
+	if (!archive) {
+		return;
+	}
+	msync(archive->header, archive->size, MS_SYNC);
+	munmap(archive->header, archive->size);
+	free(archive);
+}
@@ -0,0 +1,77 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Round robin archive of a device: a file of fixed size with tiers of
+ * consolidated readings, the newest row of a tier overwrites the oldest one
+ */
+
+#ifndef TEMPER_HUM_HID_ARCHIVE
+#define TEMPER_HUM_HID_ARCHIVE
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "temper-hum-hid-api.h"
+
+#define TEMPERHUM_ARCHIVE_MAGIC "THRA"
+#define TEMPERHUM_ARCHIVE_VERSION 1
+#define TEMPERHUM_ARCHIVE_VALUES 3 /** temperature, humidity, dew point */
+
+/**
+ * Tiers of an archive, steps and lengths are set when the file is created
+ */
+enum temperhum_archive_tier_id {
+	TEMPERHUM_ARCHIVE_RAW, /** step of the sampling interval, 1 day */
+	TEMPERHUM_ARCHIVE_MINUTE, /** 30 days */
+	TEMPERHUM_ARCHIVE_HOUR, /** 2 years */
+	TEMPERHUM_ARCHIVE_DAY, /** 10 years */
+	TEMPERHUM_ARCHIVE_TIERS
+};
+
+struct temperhum_archive_tier {
+	uint32_t step; /** seconds a row covers */
+	uint32_t rows;
+	uint64_t offset; /** of the first row in the file */
+};
+
+struct temperhum_archive_header {
+	char magic[4];
+	uint16_t version;
+	uint16_t tiers;
+	uint8_t interface_number;
+	uint8_t reserved[7];
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	struct temperhum_archive_tier tier[TEMPERHUM_ARCHIVE_TIERS];
+};
+
+/**
+ * Readings consolidated over the step of a tier, a row belongs to the slot
+ * timestamp / step and is reused for slot + rows
+ */
+struct temperhum_archive_row {
+	int64_t timestamp; /** seconds since the epoch the slot starts, UTC aligned */
+	uint32_t count[TEMPERHUM_ARCHIVE_VALUES]; /** finite values consolidated */
+	float average[TEMPERHUM_ARCHIVE_VALUES];
+	float min[TEMPERHUM_ARCHIVE_VALUES];
+	float max[TEMPERHUM_ARCHIVE_VALUES];
+};
+
+struct temperhum_archive {
+	struct temperhum_archive_header *header; /** the whole file mapped */
+	size_t size;
+};
+
+struct temperhum_archive *temperhum_archive_open(const char * path, const char * port_path, uint8_t interface_number, uint32_t raw_step);
+void temperhum_archive_update(struct temperhum_archive * archive, int64_t timestamp, const double * values);
+int temperhum_archive_read(const struct temperhum_archive * archive, int tier, int64_t from, int64_t to, struct temperhum_archive_row * rows, int size);
+void temperhum_archive_close(struct temperhum_archive * archive);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_ARCHIVE */
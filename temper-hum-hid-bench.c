@@ -0,0 +1,1389 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-log.h"
+#include "temper-hum-hid-ring.h"
+#include "temper-hum-hid-report.h"
+#include "temper-hum-hid-sht1x.h"
+#include "temper-hum-hid-archive.h"
+#include "temper-hum-hid-store.h"
+#include "temper-hum-hid-query.h"
+
+#define DEFAULT_SAMPLES 10
+#define BENCH_POLICY_SAMPLES 32 /** reads of a simulated sensor per wait policy */
+#define DEFAULT_THRESHOLD 0.25 /** slowdown against the baseline reported as a regression */
+#define BENCH_RESULTS 64
+#define BENCH_OPS 2000000
+#define BENCH_BATCH (1 << 18) /** raw readings converted by the batch benchmark */
+#define BENCH_ROUNDS 5 /** the fastest round counts, slower ones were disturbed */
+#define BENCH_LOG_LINES 20000
+#define BENCH_LOG_DEVICES 4
+#define BENCH_SIM_CYCLES 5
+#define BENCH_CAPTURE_FILE "/tmp/temper-hum-hid-bench.thhc"
+#define BENCH_ARCHIVE_FILE "/tmp/temper-hum-hid-bench.thra"
+#define BENCH_ARCHIVE_YEAR (365 * 24) /** hours read back */
+#define BENCH_STORE_SAMPLES (1 << 16) /** readings of a sensor drifting slowly, read every second */
+#define BENCH_STORE_CHUNK 1024
+#define BENCH_QUERY_FILE "/tmp/temper-hum-hid-bench.thcs"
+#define BENCH_QUERY_SECONDS (365 * 86400L) /** readings every second stored for queries */
+#define BENCH_QUERY_START 1399939200000LL /** midnight UTC, ranges start at whole steps as those of --history */
+#define BENCH_QUERY_BUCKETS 10000
+#define BENCH_STATS_SAMPLES 2000 /** 7 s apart, longer than the longest window */
+#define BENCH_HISTOGRAM_SAMPLES 100000
+#define BENCH_STATS_START 1400000000000LL /** wall clock time in ms of the first sample */
+
+/**
+ * Result of a benchmark, kept for saving and comparing with a baseline
+ */
+struct bench_result {
+	char name[96];
+	double ns; /** time per operation */
+	double allocations; /** allocations per operation */
+};
+
+static struct bench_result bench_results[BENCH_RESULTS];
+static int bench_result_count = 0;
+static unsigned long bench_allocations = 0;
+
+static temperhum_device bench_device;
+static struct temperhum_sample bench_sample;
+static char bench_report[TEMPERHUM_REPORT_SIZE];
+static struct temperhum_stats bench_stats;
+static struct temperhum_summary bench_summary[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES];
+static struct temperhum_histogram bench_histogram;
+static struct temperhum_histogram_summary bench_histogram_summary;
+static volatile double bench_sink;
+
+/**
+ * Allocations are counted by linking with --wrap=malloc,--wrap=calloc,--wrap=realloc
+ */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+	__atomic_add_fetch(&bench_allocations, 1, __ATOMIC_RELAXED);
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+	__atomic_add_fetch(&bench_allocations, 1, __ATOMIC_RELAXED);
+	return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+	__atomic_add_fetch(&bench_allocations, 1, __ATOMIC_RELAXED);
+	return __real_realloc(pointer, size);
+}
+
+/**
+ * Current monotonic time in milliseconds
+ */
+static double bench_now_ms()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
+
+/**
+ * Amount of allocations made so far
+ */
+static unsigned long bench_allocated()
+{
+	return __atomic_load_n(&bench_allocations, __ATOMIC_RELAXED);
+}
+
+/**
+ * Prints and keeps a result, spaces in names are not allowed for the baseline file
+ */
+static void bench_record(const char * name, double ns, double allocations, const char * detail)
+{
+	printf("%-62s %14.1f ns/op %8.2f allocs/op  %s\n", name, ns, allocations, detail);
+
+	if (bench_result_count < BENCH_RESULTS) {
+		struct bench_result *result = &bench_results[bench_result_count++];
+		snprintf(result->name, sizeof(result->name), "%s", name);
+		result->ns = ns;
+		result->allocations = allocations;
+	}
+}
+
+/**
+ * Runs an operation given amount of times after a warm up and records time per run
+ */
+static void bench_ops(const char * name, void (*operation)(long), long iterations)
+{
+	long i, round_length = iterations / BENCH_ROUNDS;
+	double best = 0;
+	int round;
+
+	for (i = 0; i < iterations / 10; i++) {
+		operation(i);
+	}
+
+	unsigned long allocations = bench_allocated();
+	for (round = 0; round < BENCH_ROUNDS; round++) {
+		double start = bench_now_ms();
+		for (i = 0; i < round_length; i++) {
+			operation(i);
+		}
+		double spent = bench_now_ms() - start;
+		if (!round || spent < best) {
+			best = spent;
+		}
+	}
+
+	bench_record(name, best * 1000000 / round_length, (double) (bench_allocated() - allocations) / (round_length * BENCH_ROUNDS), "");
+}
+
+/**
+ * Raw readings sweep a realistic range so that no branch is always taken
+ */
+static void bench_op_temperature(long i)
+{
+	int sot = 5500 + i % 3000;
+	bench_device.raw_temperature_bytes[0] = sot >> 8;
+	bench_device.raw_temperature_bytes[1] = sot & 0xFF;
+	temperhum_sht1x_fill_temperature(&bench_device);
+}
+
+static void bench_op_humidity(long i)
+{
+	int sorh = 400 + i % 2800;
+	bench_device.raw_humidity_bytes[0] = sorh >> 8;
+	bench_device.raw_humidity_bytes[1] = sorh & 0xFF;
+	temperhum_sht1x_fill_humidity(&bench_device);
+}
+
+static void bench_op_dew_point(long i)
+{
+	bench_sink = temperhum_dew_point(-10 + (i % 500) * 0.1, 5 + (i % 900) * 0.1);
+}
+
+static void bench_op_dew_point_fast(long i)
+{
+	bench_sink = temperhum_dew_point_fast(-10 + (i % 500) * 0.1, 5 + (i % 900) * 0.1);
+}
+
+static void bench_op_report(long i)
+{
+	bench_sample.dew_point = (i % 300) * 0.1;
+	temperhum_format_report(&bench_sample, 0, bench_report);
+}
+
+static void bench_op_report_machine(long i)
+{
+	bench_sample.temperature = (i % 300) * 0.1;
+	temperhum_format_report(&bench_sample, 1, bench_report);
+}
+
+static void bench_op_log_line(long i)
+{
+	bench_sample.temperature = (i % 300) * 0.1;
+	temperhum_format_log(&bench_sample, bench_report, sizeof(bench_report));
+}
+
+static void bench_op_sample(long i)
+{
+	bench_device.temperature = (i % 300) * 0.1;
+	temperhum_sample_fill(&bench_sample, &bench_device);
+}
+
+static void bench_op_stats_add(long i)
+{
+	double values[TEMPERHUM_STATS_VALUES] = {20 + (i % 300) * 0.01, 40 + (i % 700) * 0.01, 10 + (i % 500) * 0.01};
+	temperhum_stats_add(&bench_stats, BENCH_STATS_START + i * 1000, values);
+}
+
+static void bench_op_stats_summarize(long i)
+{
+	temperhum_stats_summarize(&bench_device.stats, bench_device.sampled_at + i % 1000, bench_summary);
+}
+
+static void bench_op_histogram_record(long i)
+{
+	temperhum_histogram_record(&bench_histogram, 200 + (i * 7919) % 400000);
+}
+
+static void bench_op_histogram_summarize(long i)
+{
+	temperhum_histogram_summarize(&bench_histogram, &bench_histogram_summary);
+	bench_sink = bench_histogram_summary.p99 + i;
+}
+
+/**
+ * Largest difference between two arrays, NaN in both counts as equal
+ */
+static double bench_difference(const double * a, const double * b, size_t count)
+{
+	double max = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		if (isnan(a[i]) && isnan(b[i])) {
+			continue;
+		}
+		double difference = fabs(a[i] - b[i]);
+		if (isnan(difference) || difference > max) {
+			max = isnan(difference) ? INFINITY : difference;
+		}
+	}
+
+	return max;
+}
+
+/**
+ * Converts a batch of readings, records time per reading and readings per second
+ */
+static void bench_batch_run(const char * name, const struct temperhum_calibration * calibration, const uint16_t * sot, const uint16_t * sorh, size_t count, double * temperature, double * humidity, double * dew_point)
+{
+	double best = 0;
+	int round;
+
+	for (round = 0; round < BENCH_ROUNDS; round++) {
+		double start = bench_now_ms();
+		temperhum_sht1x_convert(calibration, sot, sorh, count, temperature, humidity, dew_point);
+		double spent = bench_now_ms() - start;
+		if (!round || spent < best) {
+			best = spent;
+		}
+	}
+
+	char detail[64];
+	snprintf(detail, sizeof(detail), "%.1f M samples/s", count / best / 1000);
+	bench_record(name, best * 1000000 / count, 0, detail);
+}
+
+/**
+ * Batch conversion, scalar and SIMD, against the per-device conversion it
+ * has to match: temperature and humidity exactly, dew point within 1e-9 C.
+ * Returns amount of mismatches.
+ */
+int bench_batch(size_t count)
+{
+	struct temperhum_calibration calibration = {3.5, 14, 12};
+	uint16_t *sot = malloc(count * sizeof(uint16_t));
+	uint16_t *sorh = malloc(count * sizeof(uint16_t));
+	double *expected = malloc(count * 3 * sizeof(double));
+	double *result = malloc(count * 3 * sizeof(double));
+	int mismatches = 0;
+	size_t i;
+
+	if (!sot || !sorh || !expected || !result) {
+		temperhum_error(0, "Cannot allocate memory for batch benchmark");
+		free(sot);
+		free(sorh);
+		free(expected);
+		free(result);
+		return 1;
+	}
+
+	// every 14 bit temperature and 12 bit humidity reading, in an order without patterns
+	for (i = 0; i < count; i++) {
+		sot[i] = (i * 7919) % 16384;
+		sorh[i] = (i * 104729) % 4096;
+	}
+
+	temperhum_device device;
+	memset(&device, 0, sizeof(device));
+	device.sensor_voltage = calibration.sensor_voltage;
+	device.measurement_resolution_temperature = calibration.measurement_resolution_temperature;
+	device.measurement_resolution_humidity = calibration.measurement_resolution_humidity;
+
+	double start = bench_now_ms();
+	for (i = 0; i < count; i++) {
+		device.raw_temperature_bytes[0] = sot[i] >> 8;
+		device.raw_temperature_bytes[1] = sot[i] & 0xFF;
+		device.raw_humidity_bytes[0] = sorh[i] >> 8;
+		device.raw_humidity_bytes[1] = sorh[i] & 0xFF;
+		temperhum_sht1x_fill_temperature(&device);
+		temperhum_sht1x_fill_humidity(&device);
+		expected[i] = device.temperature;
+		expected[count + i] = device.humidity;
+		expected[count * 2 + i] = temperhum_dew_point(device.temperature, device.humidity);
+	}
+	double spent = bench_now_ms() - start;
+	char detail[64];
+	snprintf(detail, sizeof(detail), "%.1f M samples/s", count / spent / 1000);
+	bench_record("batch/device", spent * 1000000 / count, 0, detail);
+
+	const char * names[] = {"batch/scalar", "batch/simd"};
+	int simd;
+	for (simd = 0; simd < 2; simd++) {
+		if (temperhum_set_simd(simd) != simd) {
+			printf("%-62s skipped, cpu has no AVX2\n", names[simd]);
+			continue;
+		}
+		bench_batch_run(names[simd], &calibration, sot, sorh, count, result, result + count, result + count * 2);
+
+		double temperature = bench_difference(expected, result, count);
+		double humidity = bench_difference(expected + count, result + count, count);
+		double dew_point = bench_difference(expected + count * 2, result + count * 2, count);
+		int matches = temperature == 0 && humidity == 0 && dew_point < 1e-9;
+		printf(
+			"%-62s max difference: temperature %g, humidity %g, dew point %g%s\n",
+			names[simd],
+			temperature,
+			humidity,
+			dew_point,
+			matches ? "" : "  MISMATCH"
+		);
+		mismatches += !matches;
+	}
+	temperhum_set_simd(1);
+
+	int32_t *fixed = malloc(count * 3 * sizeof(int32_t));
+	if (fixed) {
+		double best = 0;
+		int round;
+		for (round = 0; round < BENCH_ROUNDS; round++) {
+			start = bench_now_ms();
+			temperhum_sht1x_convert_fixed(&calibration, sot, sorh, count, fixed, fixed + count, fixed + count * 2);
+			spent = bench_now_ms() - start;
+			if (!round || spent < best) {
+				best = spent;
+			}
+		}
+		snprintf(detail, sizeof(detail), "%.1f M samples/s", count / best / 1000);
+		bench_record("batch/fixed", best * 1000000 / count, 0, detail);
+		free(fixed);
+	}
+
+	free(sot);
+	free(sorh);
+	free(expected);
+	free(result);
+
+	return mismatches;
+}
+
+/**
+ * Generated humidity tables against the formulas of the coefficients of the
+ * converters, every entry has to be exactly the same. Returns amount of
+ * calibrations with a differing entry.
+ */
+int bench_sht1x_tables()
+{
+	static const int resolutions[2] = {12, 8};
+	int h, sorh, mismatches = 0;
+
+	for (h = 0; h < 2; h++) {
+		struct temperhum_calibration calibration = {3.5, 14, resolutions[h]};
+		const struct temperhum_sht1x *sht1x = temperhum_sht1x_converter(&calibration);
+		int differing = 0;
+
+		for (sorh = 0; sht1x && sorh <= sht1x->mask; sorh++) {
+			float compensation = sht1x->t1 + sht1x->t2 * sorh;
+			if (sht1x->linear[sorh] != temperhum_sht1x_humidity_linear(sht1x, sorh) || sht1x->compensation[sorh] != compensation) {
+				differing++;
+			}
+		}
+		if (!sht1x || differing) {
+			mismatches++;
+		}
+		printf("%-62s %i of %i entries differ%s\n", resolutions[h] == 12 ? "sht1x/tables-12" : "sht1x/tables-8", differing, sht1x ? sht1x->mask + 1 : 0, !sht1x || differing ? "  MISMATCH" : "");
+	}
+
+	return mismatches;
+}
+
+/**
+ * Fixed point conversion of every 14 bit temperature and 12 bit humidity
+ * reading against the double one, readings with a humidity of 1 % or less
+ * are skipped as the dew point goes to minus infinity there.
+ * Returns 1 if any difference is above the documented bounds.
+ */
+int bench_fixed_accuracy()
+{
+	struct temperhum_calibration calibration = {3.5, 14, 12};
+	uint16_t sot[4096], sorh[4096];
+	double temperature[4096], humidity[4096], dew_point[4096];
+	int32_t fixed_temperature[4096], fixed_humidity[4096], fixed_dew_point[4096];
+	double max_temperature = 0, max_humidity = 0, max_dew_point = 0;
+	int i, j;
+
+	for (j = 0; j < 4096; j++) {
+		sorh[j] = j;
+	}
+	temperhum_set_simd(0);
+	for (i = 0; i < 16384; i++) {
+		for (j = 0; j < 4096; j++) {
+			sot[j] = i;
+		}
+		temperhum_sht1x_convert(&calibration, sot, sorh, 4096, temperature, humidity, dew_point);
+		temperhum_sht1x_convert_fixed(&calibration, sot, sorh, 4096, fixed_temperature, fixed_humidity, fixed_dew_point);
+
+		for (j = 0; j < 4096; j++) {
+			if (humidity[j] <= 1) {
+				continue;
+			}
+			double error = fabs(fixed_temperature[j] / 100.0 - temperature[j]);
+			max_temperature = error > max_temperature ? error : max_temperature;
+			error = fabs(fixed_humidity[j] / 100.0 - humidity[j]);
+			max_humidity = error > max_humidity ? error : max_humidity;
+			error = fixed_dew_point[j] == TEMPERHUM_FIXED_INVALID ? INFINITY : fabs(fixed_dew_point[j] / 100.0 - dew_point[j]);
+			max_dew_point = error > max_dew_point ? error : max_dew_point;
+		}
+	}
+	temperhum_set_simd(1);
+
+	int exceeds = max_temperature > 0.005 + 1e-6 || max_humidity > 0.006 || max_dew_point > 0.01;
+	printf(
+		"%-62s max difference: temperature %.4f, humidity %.4f, dew point %.4f%s\n",
+		"fixed/accuracy",
+		max_temperature,
+		max_humidity,
+		max_dew_point,
+		exceeds ? "  MISMATCH" : ""
+	);
+
+	return exceeds;
+}
+
+/**
+ * Fast dew point against the exact one for every hundredth of C in -40 - 50 C
+ * and every hundredth of % humidity. Returns 1 if the difference reaches 0.001 C.
+ */
+int bench_dew_point_accuracy()
+{
+	double max = 0, worst_temperature = 0, worst_humidity = 0;
+	int temperature, humidity;
+
+	for (temperature = -4000; temperature <= 5000; temperature++) {
+		for (humidity = 1; humidity <= 10000; humidity++) {
+			double error = fabs(temperhum_dew_point_fast(temperature / 100.0, humidity / 100.0) - temperhum_dew_point(temperature / 100.0, humidity / 100.0));
+			if (!(error <= max)) {
+				max = error;
+				worst_temperature = temperature / 100.0;
+				worst_humidity = humidity / 100.0;
+			}
+		}
+	}
+
+	int exceeds = !(max < 0.001);
+	printf(
+		"%-62s max difference: %.6f C at %.2f C, %.2f %%%s\n",
+		"dew-point-fast/accuracy",
+		max,
+		worst_temperature,
+		worst_humidity,
+		exceeds ? "  MISMATCH" : ""
+	);
+
+	return exceeds;
+}
+
+/**
+ * Rolling statistics against statistics computed from all samples of the windows.
+ * Returns amount of windows which do not match.
+ */
+int bench_stats_accuracy()
+{
+	static double values[BENCH_STATS_SAMPLES][TEMPERHUM_STATS_VALUES];
+	static const int64_t bucket_length[TEMPERHUM_STATS_WINDOWS] = {1000, 15000, 60000};
+	struct temperhum_stats *stats = calloc(1, sizeof(struct temperhum_stats));
+	struct temperhum_summary summary[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES];
+	int64_t now = 0;
+	double max = 0;
+	int i, w, v, mismatches = 0;
+
+	if (!stats) {
+		return 1;
+	}
+	srand(11);
+	for (i = 0; i < BENCH_STATS_SAMPLES; i++) {
+		values[i][0] = 15 + rand() % 1000 / 100.0;
+		values[i][1] = 30 + rand() % 4000 / 100.0;
+		values[i][2] = i % 50 ? 5 + rand() % 1000 / 100.0 : -INFINITY;
+		now = BENCH_STATS_START + i * 7000LL;
+		temperhum_stats_add(stats, now, values[i]);
+	}
+	temperhum_stats_summarize(stats, now, summary);
+
+	for (w = 0; w < TEMPERHUM_STATS_WINDOWS; w++) {
+		int64_t first = now / bucket_length[w] - TEMPERHUM_STATS_BUCKETS + 1;
+		for (v = 0; v < TEMPERHUM_STATS_VALUES; v++) {
+			double sum = 0, squares = 0, min = INFINITY, maximum = -INFINITY;
+			unsigned int count = 0;
+
+			for (i = 0; i < BENCH_STATS_SAMPLES; i++) {
+				if ((BENCH_STATS_START + i * 7000LL) / bucket_length[w] < first || !isfinite(values[i][v])) {
+					continue;
+				}
+				sum += values[i][v];
+				min = values[i][v] < min ? values[i][v] : min;
+				maximum = values[i][v] > maximum ? values[i][v] : maximum;
+				count++;
+			}
+			double mean = sum / count;
+			for (i = 0; i < BENCH_STATS_SAMPLES; i++) {
+				if ((BENCH_STATS_START + i * 7000LL) / bucket_length[w] >= first && isfinite(values[i][v])) {
+					squares += (values[i][v] - mean) * (values[i][v] - mean);
+				}
+			}
+			double stddev = sqrt(squares / (count - 1));
+
+			struct temperhum_summary *s = &summary[w][v];
+			double difference = fmax(fmax(fabs(s->mean - mean), fabs(s->stddev - stddev)), fmax(fabs(s->min - min), fabs(s->max - maximum)));
+			if (s->count != count || !(difference < 1e-9)) {
+				mismatches++;
+			}
+			if (!(difference <= max)) {
+				max = difference;
+			}
+		}
+	}
+	free(stats);
+
+	printf("%-62s max difference: %.3g%s\n", "stats/accuracy", max, mismatches ? "  MISMATCH" : "");
+
+	return mismatches;
+}
+
+static int bench_compare_uint32(const void * a, const void * b)
+{
+	uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ * Percentiles of a histogram against exact ones of the sorted values, spread
+ * log uniformly from 1 us to 10 s. Returns amount of percentiles off by more
+ * than the precision of a bucket.
+ */
+int bench_histogram_accuracy()
+{
+	static const double percentiles[] = {1, 10, 25, 50, 75, 90, 99, 99.9, 100};
+	struct temperhum_histogram *histogram = calloc(1, sizeof(struct temperhum_histogram));
+	struct temperhum_histogram_summary summary;
+	uint32_t *values = malloc(BENCH_HISTOGRAM_SAMPLES * sizeof(uint32_t));
+	double max = 0;
+	int i, mismatches = 0;
+
+	if (!histogram || !values) {
+		free(histogram);
+		free(values);
+		return 1;
+	}
+	srand(13);
+	for (i = 0; i < BENCH_HISTOGRAM_SAMPLES; i++) {
+		values[i] = exp(rand() / (double) RAND_MAX * log(1e7));
+		temperhum_histogram_record(histogram, values[i]);
+	}
+	qsort(values, BENCH_HISTOGRAM_SAMPLES, sizeof(uint32_t), bench_compare_uint32);
+
+	for (i = 0; i < (int) (sizeof(percentiles) / sizeof(percentiles[0])); i++) {
+		uint64_t rank = percentiles[i] / 100 * BENCH_HISTOGRAM_SAMPLES + 0.5;
+		uint32_t exact = values[(rank < 1 ? 1 : rank) - 1];
+		uint32_t value = temperhum_histogram_percentile(histogram, percentiles[i]);
+		double error = (value - (double) exact) / exact;
+
+		if (value < exact || error > 1.0 / TEMPERHUM_HISTOGRAM_SUB_BUCKETS) {
+			mismatches++;
+		}
+		if (!(fabs(error) <= max)) {
+			max = fabs(error);
+		}
+	}
+	temperhum_histogram_summarize(histogram, &summary);
+	if (summary.count != BENCH_HISTOGRAM_SAMPLES
+		|| summary.p50 != temperhum_histogram_percentile(histogram, 50)
+		|| summary.p90 != temperhum_histogram_percentile(histogram, 90)
+		|| summary.p99 != temperhum_histogram_percentile(histogram, 99)
+		|| summary.max != values[BENCH_HISTOGRAM_SAMPLES - 1]
+	) {
+		mismatches++;
+	}
+	free(histogram);
+	free(values);
+
+	printf("%-62s max relative error: %.3g%s\n", "histogram/accuracy", max, mismatches ? "  MISMATCH" : "");
+
+	return mismatches;
+}
+
+static struct temperhum_archive *bench_archive_file;
+static struct temperhum_archive_row bench_archive_rows[BENCH_ARCHIVE_YEAR];
+
+/**
+ * Values of the synthetic sensor at given second
+ */
+static void bench_archive_values(int64_t second, double * values)
+{
+	values[0] = 20 + (second / 60 % 600) * 0.01;
+	values[1] = 40 + (second / 60 % 1300) * 0.01;
+	values[2] = second % 86400 ? 10 + (second / 60 % 700) * 0.01 : -INFINITY;
+}
+
+static void bench_op_archive_update(long i)
+{
+	double values[TEMPERHUM_ARCHIVE_VALUES];
+	int64_t second = BENCH_STATS_START / 1000 + 365 * 86400LL + i;
+	bench_archive_values(second, values);
+	temperhum_archive_update(bench_archive_file, second * 1000, values);
+}
+
+static void bench_op_archive_year(long i)
+{
+	int64_t now = BENCH_STATS_START / 1000 + 365 * 86400LL;
+	bench_sink = temperhum_archive_read(bench_archive_file, TEMPERHUM_ARCHIVE_HOUR, now - BENCH_ARCHIVE_YEAR * 3600LL + (i % 2) * 3600, now, bench_archive_rows, BENCH_ARCHIVE_YEAR);
+}
+
+/**
+ * Fills an archive with a year of readings every minute and checks the hours
+ * read back against averages computed directly. Returns amount of hours which
+ * do not match.
+ */
+int bench_archive()
+{
+	int64_t start = BENCH_STATS_START / 1000 / 3600 * 3600, second;
+	int i, v, mismatches = 0;
+	double max = 0;
+
+	unlink(BENCH_ARCHIVE_FILE);
+	bench_archive_file = temperhum_archive_open(BENCH_ARCHIVE_FILE, "1-1.4", 1, 60);
+	if (!bench_archive_file) {
+		temperhum_error(0, "Cannot create archive '%s' for benchmark", BENCH_ARCHIVE_FILE);
+		return 1;
+	}
+
+	for (second = start; second < start + 365 * 86400LL; second += 60) {
+		double values[TEMPERHUM_ARCHIVE_VALUES];
+		bench_archive_values(second, values);
+		temperhum_archive_update(bench_archive_file, second * 1000, values);
+	}
+
+	int count = temperhum_archive_read(bench_archive_file, TEMPERHUM_ARCHIVE_HOUR, start, start + 365 * 86400LL - 1, bench_archive_rows, BENCH_ARCHIVE_YEAR);
+	for (i = 0; i < count; i++) {
+		const struct temperhum_archive_row *row = &bench_archive_rows[i];
+		double sum[TEMPERHUM_ARCHIVE_VALUES] = {0}, low[TEMPERHUM_ARCHIVE_VALUES], high[TEMPERHUM_ARCHIVE_VALUES];
+		uint32_t counted[TEMPERHUM_ARCHIVE_VALUES] = {0};
+
+		for (second = row->timestamp; second < row->timestamp + 3600; second += 60) {
+			double values[TEMPERHUM_ARCHIVE_VALUES];
+			bench_archive_values(second, values);
+			for (v = 0; v < TEMPERHUM_ARCHIVE_VALUES; v++) {
+				if (!isfinite(values[v])) {
+					continue;
+				}
+				low[v] = !counted[v] || values[v] < low[v] ? values[v] : low[v];
+				high[v] = !counted[v] || values[v] > high[v] ? values[v] : high[v];
+				sum[v] += values[v];
+				counted[v]++;
+			}
+		}
+		for (v = 0; v < TEMPERHUM_ARCHIVE_VALUES; v++) {
+			double difference = fmax(fabs(row->average[v] - sum[v] / counted[v]), fmax(fabs(row->min[v] - low[v]), fabs(row->max[v] - high[v])));
+			if (row->count[v] != counted[v] || !(difference < 0.001)) {
+				mismatches++;
+			}
+			if (!(difference <= max)) {
+				max = difference;
+			}
+		}
+	}
+	if (count != BENCH_ARCHIVE_YEAR) {
+		mismatches++;
+	}
+	printf("%-62s %i hours, max difference: %.6f%s\n", "archive/accuracy", count, max, mismatches ? "  MISMATCH" : "");
+
+	bench_ops("archive/update", bench_op_archive_update, BENCH_OPS);
+	bench_ops("archive/read-year-hourly", bench_op_archive_year, 2000);
+
+	temperhum_archive_close(bench_archive_file);
+	unlink(BENCH_ARCHIVE_FILE);
+
+	return mismatches;
+}
+
+static struct temperhum_store_sample *bench_store_samples;
+static struct temperhum_store_sample bench_store_decoded[BENCH_STORE_CHUNK];
+static struct temperhum_store_chunk bench_store_chunk;
+static uint8_t *bench_store_payload;
+
+static void bench_op_store_encode(long i)
+{
+	int chunk = i % (BENCH_STORE_SAMPLES / BENCH_STORE_CHUNK);
+	bench_sink = temperhum_store_encode(bench_store_samples + chunk * BENCH_STORE_CHUNK, BENCH_STORE_CHUNK, &bench_store_chunk, bench_store_payload);
+}
+
+static void bench_op_store_decode(long i)
+{
+	bench_sink = temperhum_store_decode(&bench_store_chunk, bench_store_payload, bench_store_decoded);
+}
+
+/**
+ * Compresses readings of a slowly drifting sensor read every second with some
+ * jitter, checks that they decode unchanged and compares size with the log.
+ * Returns amount of chunks which do not decode to their samples.
+ */
+int bench_store()
+{
+	static uint16_t sot[BENCH_STORE_SAMPLES], sorh[BENCH_STORE_SAMPLES];
+	static double temperature[BENCH_STORE_SAMPLES], humidity[BENCH_STORE_SAMPLES], dew_point[BENCH_STORE_SAMPLES];
+	struct temperhum_calibration calibration = {3.5, 14, 12};
+	int i, j, mismatches = 0;
+	size_t bytes = 0;
+
+	bench_store_samples = malloc(BENCH_STORE_SAMPLES * sizeof(struct temperhum_store_sample));
+	bench_store_payload = malloc(temperhum_store_bound(BENCH_STORE_CHUNK));
+	if (!bench_store_samples || !bench_store_payload) {
+		free(bench_store_samples);
+		free(bench_store_payload);
+		return 1;
+	}
+
+	srand(5);
+	sot[0] = 6150;
+	sorh[0] = 1400;
+	for (i = 1; i < BENCH_STORE_SAMPLES; i++) {
+		sot[i] = sot[i - 1] + (rand() % 8 == 0) - (rand() % 8 == 0);
+		sorh[i] = sorh[i - 1] + (rand() % 4 == 0) - (rand() % 4 == 0);
+	}
+	temperhum_sht1x_convert(&calibration, sot, sorh, BENCH_STORE_SAMPLES, temperature, humidity, dew_point);
+	for (i = 0; i < BENCH_STORE_SAMPLES; i++) {
+		struct temperhum_store_sample *sample = &bench_store_samples[i];
+		sample->timestamp = BENCH_STATS_START + i * 1000LL + rand() % 3;
+		sample->temperature = temperature[i];
+		sample->humidity = humidity[i];
+		sample->raw_temperature = sot[i];
+		sample->raw_humidity = sorh[i];
+	}
+
+	for (i = 0; i < BENCH_STORE_SAMPLES / BENCH_STORE_CHUNK; i++) {
+		bytes += sizeof(struct temperhum_store_chunk) + temperhum_store_encode(bench_store_samples + i * BENCH_STORE_CHUNK, BENCH_STORE_CHUNK, &bench_store_chunk, bench_store_payload);
+		if (temperhum_store_decode(&bench_store_chunk, bench_store_payload, bench_store_decoded) < 0) {
+			mismatches++;
+			continue;
+		}
+		for (j = 0; j < BENCH_STORE_CHUNK; j++) {
+			const struct temperhum_store_sample *a = &bench_store_decoded[j], *b = &bench_store_samples[i * BENCH_STORE_CHUNK + j];
+			if (a->timestamp != b->timestamp || a->temperature != b->temperature || a->humidity != b->humidity || a->raw_temperature != b->raw_temperature || a->raw_humidity != b->raw_humidity) {
+				mismatches++;
+				break;
+			}
+		}
+	}
+
+	// a log line of the same reading for comparison
+	temperhum_format_log(&bench_sample, bench_report, sizeof(bench_report));
+	printf(
+		"%-62s %.2f bytes per reading, log line %zu bytes%s\n",
+		"store/size",
+		(double) bytes / BENCH_STORE_SAMPLES,
+		strlen("[2014-01-01 00:00:00] TemperHum \n") + strlen(bench_report),
+		mismatches ? "  MISMATCH" : ""
+	);
+
+	char detail[64];
+	bench_ops("store/encode-chunk", bench_op_store_encode, 2000);
+	bench_ops("store/decode-chunk", bench_op_store_decode, 2000);
+	snprintf(detail, sizeof(detail), "%.0f M readings/s", BENCH_STORE_CHUNK * 1e3 / bench_results[bench_result_count - 1].ns);
+	printf("%-62s %s\n", "store/decode-rate", detail);
+
+	free(bench_store_samples);
+	free(bench_store_payload);
+
+	return mismatches;
+}
+
+static struct temperhum_query_bucket bench_query_buckets[BENCH_QUERY_BUCKETS];
+static int64_t bench_query_end;
+
+/**
+ * Readings of the query benchmark, deterministic so that they need not be kept
+ */
+static void bench_query_samples(long first, int count, struct temperhum_store_sample * samples)
+{
+	static uint16_t sot[BENCH_STORE_CHUNK], sorh[BENCH_STORE_CHUNK];
+	static double temperature[BENCH_STORE_CHUNK], humidity[BENCH_STORE_CHUNK], dew_point[BENCH_STORE_CHUNK];
+	struct temperhum_calibration calibration = {3.5, 14, 12};
+	int i;
+
+	for (i = 0; i < count; i++) {
+		long second = first + i;
+		uint32_t noise = (uint32_t) second * 2654435761u;
+		sot[i] = 6150 + lround(60 * sin(second * 2 * M_PI / 86400)) + (noise >> 31);
+		sorh[i] = 1400 + lround(150 * sin(second * 2 * M_PI / (7 * 86400))) + (noise >> 29 & 3);
+	}
+	temperhum_sht1x_convert(&calibration, sot, sorh, count, temperature, humidity, dew_point);
+	for (i = 0; i < count; i++) {
+		samples[i].timestamp = BENCH_QUERY_START + (first + i) * 1000LL + ((uint32_t) (first + i) * 2654435761u >> 16) % 3;
+		samples[i].temperature = temperature[i];
+		samples[i].humidity = humidity[i];
+		samples[i].raw_temperature = sot[i];
+		samples[i].raw_humidity = sorh[i];
+	}
+}
+
+/**
+ * Adds a reading to reference buckets of step ms starting at from
+ */
+static void bench_query_expect(struct temperhum_query_bucket * buckets, int size, int64_t from, int64_t step, const struct temperhum_store_sample * sample)
+{
+	const double values[TEMPERHUM_QUERY_VALUES] = {sample->temperature, sample->humidity};
+	int v;
+
+	if (sample->timestamp < from || (sample->timestamp - from) / step >= size) {
+		return;
+	}
+	struct temperhum_query_bucket *bucket = &buckets[(sample->timestamp - from) / step];
+	for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+		bucket->min[v] = !bucket->count || values[v] < bucket->min[v] ? values[v] : bucket->min[v];
+		bucket->max[v] = !bucket->count || values[v] > bucket->max[v] ? values[v] : bucket->max[v];
+		bucket->mean[v] += values[v];
+	}
+	bucket->count++;
+}
+
+/**
+ * Compares buckets of a query with reference ones, returns amount which differ
+ */
+static int bench_query_compare(const struct temperhum_query_bucket * buckets, const struct temperhum_query_bucket * expected, int count)
+{
+	int i, v, mismatches = 0;
+
+	for (i = 0; i < count; i++) {
+		if (buckets[i].count != expected[i].count) {
+			mismatches++;
+			continue;
+		}
+		for (v = 0; v < TEMPERHUM_QUERY_VALUES && expected[i].count; v++) {
+			double mean = expected[i].mean[v] / expected[i].count;
+			if (buckets[i].min[v] != expected[i].min[v] || buckets[i].max[v] != expected[i].max[v] || !(fabs(buckets[i].mean[v] - mean) < 1e-9)) {
+				mismatches++;
+				break;
+			}
+		}
+	}
+
+	return mismatches;
+}
+
+static void bench_op_query_day(long i)
+{
+	bench_sink = temperhum_query(BENCH_QUERY_FILE, bench_query_end - 86400000LL, bench_query_end, 60000, bench_query_buckets, BENCH_QUERY_BUCKETS, NULL);
+}
+
+static void bench_op_query_month(long i)
+{
+	bench_sink = temperhum_query(BENCH_QUERY_FILE, bench_query_end - 30 * 86400000LL, bench_query_end, 3600000, bench_query_buckets, BENCH_QUERY_BUCKETS, NULL);
+}
+
+static void bench_op_query_month_fine(long i)
+{
+	bench_sink = temperhum_query(BENCH_QUERY_FILE, bench_query_end - 30 * 86400000LL, bench_query_end, 300000, bench_query_buckets, BENCH_QUERY_BUCKETS, NULL);
+}
+
+static void bench_op_query_year(long i)
+{
+	bench_sink = temperhum_query(BENCH_QUERY_FILE, bench_query_end - 365 * 86400000LL, bench_query_end, 86400000, bench_query_buckets, BENCH_QUERY_BUCKETS, NULL);
+}
+
+/**
+ * Stores a year of readings every second and queries ranges of it, results
+ * of a month in 5 minutes and a year in days are checked against aggregates
+ * computed directly. Returns amount of buckets which do not match.
+ */
+int bench_query()
+{
+	static struct temperhum_store_sample samples[BENCH_STORE_CHUNK];
+	static struct temperhum_query_bucket month[30 * 288], year[365];
+	struct temperhum_query_stats stats;
+	int64_t month_from = BENCH_QUERY_START + (BENCH_QUERY_SECONDS - 30 * 86400L) * 1000LL;
+	long second;
+	int i, mismatches = 0;
+
+	unlink(BENCH_QUERY_FILE);
+	unlink(BENCH_QUERY_FILE TEMPERHUM_STORE_INDEX_SUFFIX);
+	unlink(BENCH_QUERY_FILE TEMPERHUM_STORE_MINUTES_SUFFIX);
+	struct temperhum_store *store = temperhum_store_open(BENCH_QUERY_FILE, "1-1.4", 1, BENCH_STORE_CHUNK);
+	if (!store) {
+		temperhum_error(0, "Cannot create store '%s' for benchmark", BENCH_QUERY_FILE);
+		return 1;
+	}
+
+	double start = bench_now_ms();
+	for (second = 0; second < BENCH_QUERY_SECONDS; second += BENCH_STORE_CHUNK) {
+		int count = BENCH_QUERY_SECONDS - second < BENCH_STORE_CHUNK ? BENCH_QUERY_SECONDS - second : BENCH_STORE_CHUNK;
+		bench_query_samples(second, count, samples);
+		for (i = 0; i < count; i++) {
+			if (temperhum_store_append(store, &samples[i]) < 0) {
+				mismatches++;
+			}
+			bench_query_expect(month, 30 * 288, month_from, 300000, &samples[i]);
+			bench_query_expect(year, 365, BENCH_QUERY_START, 86400000, &samples[i]);
+		}
+	}
+	if (temperhum_store_close(store) < 0) {
+		mismatches++;
+	}
+	printf("%-62s %.1f s\n", "query/store-year", (bench_now_ms() - start) / 1000);
+
+	bench_query_end = BENCH_QUERY_START + BENCH_QUERY_SECONDS * 1000LL;
+	int count = temperhum_query(BENCH_QUERY_FILE, month_from, bench_query_end, 300000, bench_query_buckets, BENCH_QUERY_BUCKETS, &stats);
+	if (count != 30 * 288) {
+		mismatches++;
+	}
+	mismatches += bench_query_compare(bench_query_buckets, month, count > 0 ? count : 0);
+	printf("%-62s %i buckets, %lu of %lu chunks decoded, %lu by minute%s\n", "query/accuracy-month-5m", count, stats.decoded, stats.chunks, stats.minutes, mismatches ? "  MISMATCH" : "");
+
+	count = temperhum_query(BENCH_QUERY_FILE, BENCH_QUERY_START, bench_query_end, 86400000, bench_query_buckets, BENCH_QUERY_BUCKETS, &stats);
+	if (count != 365) {
+		mismatches++;
+	}
+	mismatches += bench_query_compare(bench_query_buckets, year, count > 0 ? count : 0);
+	printf("%-62s %i buckets, %lu of %lu chunks decoded, %lu by minute%s\n", "query/accuracy-year-daily", count, stats.decoded, stats.chunks, stats.minutes, mismatches ? "  MISMATCH" : "");
+
+	// without the minutes file chunks are decoded, opening the store adds it back
+	unlink(BENCH_QUERY_FILE TEMPERHUM_STORE_MINUTES_SUFFIX);
+	count = temperhum_query(BENCH_QUERY_FILE, month_from, bench_query_end, 300000, bench_query_buckets, BENCH_QUERY_BUCKETS, &stats);
+	int rebuilt = bench_query_compare(bench_query_buckets, month, count > 0 ? count : 0) + (count != 30 * 288);
+	unsigned long decoded = stats.decoded;
+	start = bench_now_ms();
+	store = temperhum_store_open(BENCH_QUERY_FILE, "1-1.4", 1, BENCH_STORE_CHUNK);
+	if (!store || temperhum_store_close(store) < 0) {
+		rebuilt++;
+	}
+	double rebuild = bench_now_ms() - start;
+	count = temperhum_query(BENCH_QUERY_FILE, month_from, bench_query_end, 300000, bench_query_buckets, BENCH_QUERY_BUCKETS, &stats);
+	rebuilt += bench_query_compare(bench_query_buckets, month, count > 0 ? count : 0) + (count != 30 * 288) + (stats.decoded >= decoded);
+	mismatches += rebuilt;
+	printf("%-62s %lu chunks decoded before, %lu after a rebuild of %.0f ms%s\n", "query/accuracy-minutes-rebuilt", decoded, stats.decoded, rebuild, rebuilt ? "  MISMATCH" : "");
+
+	bench_ops("query/day-1m", bench_op_query_day, 100);
+	bench_ops("query/month-hourly", bench_op_query_month, 50);
+	bench_ops("query/month-5m", bench_op_query_month_fine, 50);
+	bench_ops("query/year-daily", bench_op_query_year, 50);
+
+	unlink(BENCH_QUERY_FILE);
+	unlink(BENCH_QUERY_FILE TEMPERHUM_STORE_INDEX_SUFFIX);
+	unlink(BENCH_QUERY_FILE TEMPERHUM_STORE_MINUTES_SUFFIX);
+
+	return mismatches;
+}
+
+/**
+ * Conversion of raw readings and rendering of reports done for every sample
+ */
+void bench_conversion(long iterations)
+{
+	long i;
+
+	snprintf(bench_device.port_path, sizeof(bench_device.port_path), "1-1.4");
+	bench_device.bus_number = 1;
+	bench_device.device_number = 5;
+	bench_device.interface_number = 1;
+	bench_device.sensor_voltage = 3.5;
+	bench_device.measurement_resolution_temperature = 14;
+	bench_device.measurement_resolution_humidity = 12;
+	bench_device.temperature = 21.5;
+	bench_device.raw_humidity_bytes[0] = 0x05;
+	bench_device.raw_humidity_bytes[1] = 0x76;
+	temperhum_sht1x_fill_humidity(&bench_device);
+	bench_device.dew_point = temperhum_dew_point(bench_device.temperature, bench_device.humidity);
+	// the sample carries the statistics of a device read every second for an hour
+	for (i = 0; i < 3600; i++) {
+		bench_op_stats_add(i);
+	}
+	bench_device.stats = bench_stats;
+	bench_device.sampled_at = BENCH_STATS_START + 3599 * 1000;
+	temperhum_sample_fill(&bench_sample, &bench_device);
+
+	bench_ops("convert/temperature", bench_op_temperature, iterations);
+	bench_ops("convert/humidity", bench_op_humidity, iterations);
+	bench_ops("convert/dew-point", bench_op_dew_point, iterations);
+	bench_ops("convert/dew-point-fast", bench_op_dew_point_fast, iterations);
+	bench_ops("convert/sample", bench_op_sample, iterations);
+	bench_ops("format/report", bench_op_report, iterations / 4);
+	bench_ops("format/machine", bench_op_report_machine, iterations / 4);
+	bench_ops("format/log-line", bench_op_log_line, iterations / 4);
+	bench_ops("stats/add", bench_op_stats_add, iterations);
+	bench_ops("stats/summarize", bench_op_stats_summarize, iterations / 16);
+	bench_ops("histogram/record", bench_op_histogram_record, iterations);
+	bench_ops("histogram/summarize", bench_op_histogram_summarize, iterations / 16);
+}
+
+/**
+ * Reads every device given amount of times with a wait policy and prints time spent per sample
+ */
+void bench_sample_latency(temperhum_device * device, const char * policy_name, int policy, int samples)
+{
+	temperhum_set_wait_policy(policy);
+
+	for (; device != NULL; device = device->next) {
+		double total = 0, min = 0, max = 0;
+		int i, failed = 0;
+
+		// learn the settle time from scratch for every run
+		device->settle_time = 0;
+		device->settle_floor = 0;
+		device->settle_clean = 0;
+
+		for (i = 0; i < samples; i++) {
+			double start = bench_now_ms();
+			int result = temperhum_fill(device);
+			double spent = bench_now_ms() - start;
+
+			if (result < 0) {
+				failed++;
+			}
+			total += spent;
+			if (!i || spent < min) {
+				min = spent;
+			}
+			if (spent > max) {
+				max = spent;
+			}
+		}
+
+		printf(
+			"%-8s %03u:%03u: %i samples, %i failed, per sample %.1f ms (min %.1f ms, max %.1f ms), settle time %i us\n",
+			policy_name,
+			device->bus_number,
+			device->device_number,
+			samples,
+			failed,
+			total / samples,
+			min,
+			max,
+			policy == TEMPERHUM_WAIT_FIXED ? 400000 : device->settle_time
+		);
+	}
+}
+
+/**
+ * Reads a simulated sensor with both wait policies, spec is passed to
+ * temperhum_set_transport() and sets how long the sensor measures
+ */
+void bench_policies(const char * spec, int resolution_temperature, int resolution_humidity, int samples)
+{
+	if (temperhum_set_transport(spec) < 0) {
+		return;
+	}
+	temperhum_init(0, 0, "\0");
+
+	temperhum_device * device = temperhum_find();
+	temperhum_device * d;
+	for (d = device; d != NULL; d = d->next) {
+		d->measurement_resolution_temperature = resolution_temperature;
+		d->measurement_resolution_humidity = resolution_humidity;
+		d->sensor_voltage = 3.5;
+	}
+
+	printf("%s, %i/%i bit\n", spec, resolution_temperature, resolution_humidity);
+	bench_sample_latency(device, "fixed", TEMPERHUM_WAIT_FIXED, samples);
+	bench_sample_latency(device, "adaptive", TEMPERHUM_WAIT_ADAPTIVE, samples);
+
+	temperhum_close();
+}
+
+/**
+ * Writes log lines the way the daemon did before batching: fputs and fflush for every line
+ */
+void bench_log_stdio(const char * path, const char * line, int lines)
+{
+	FILE * file = fopen(path, "a");
+	if (!file) {
+		temperhum_error(0, "Cannot open '%s' for benchmark", path);
+		return;
+	}
+
+	unsigned long allocations = bench_allocated();
+	double start = bench_now_ms();
+	int i;
+	for (i = 0; i < lines; i++) {
+		fputs(line, file);
+		fflush(file);
+	}
+	double spent = bench_now_ms() - start;
+	fclose(file);
+
+	bench_record("log/fflush", spent * 1000000 / lines, (double) (bench_allocated() - allocations) / lines, "1.00 writes, 0.00 syncs per line");
+}
+
+/**
+ * Writes log lines in cycles of BENCH_LOG_DEVICES lines with the batching log writer
+ */
+void bench_log_writer(const char * path, const char * name, const char * line, int lines, int sync)
+{
+	struct temperhum_log log;
+	if (temperhum_log_open(&log, path, 65536, 0, sync) < 0) {
+		temperhum_error(0, "Cannot open '%s' for benchmark", path);
+		return;
+	}
+
+	size_t length = strlen(line);
+	unsigned long allocations = bench_allocated();
+	double start = bench_now_ms();
+	int i;
+	for (i = 0; i < lines; i++) {
+		temperhum_log_append(&log, line, length);
+		if (i % BENCH_LOG_DEVICES == BENCH_LOG_DEVICES - 1) {
+			temperhum_log_commit(&log);
+		}
+	}
+	temperhum_log_flush(&log);
+	double spent = bench_now_ms() - start;
+
+	char result[32], detail[64];
+	snprintf(result, sizeof(result), "log/%s", name);
+	snprintf(detail, sizeof(detail), "%.2f writes, %.2f syncs per line", (double) log.writes / lines, (double) log.syncs / lines);
+	bench_record(result, spent * 1000000 / lines, (double) (bench_allocated() - allocations) / lines, detail);
+	temperhum_log_close(&log);
+}
+
+/**
+ * Compares log writing strategies, each cycle logs a line for BENCH_LOG_DEVICES devices
+ */
+void bench_log(int lines)
+{
+	char path[] = "/tmp/temper-hum-hid-bench-XXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		temperhum_error(0, "Cannot create temporary file for log benchmark");
+		return;
+	}
+	close(fd);
+
+	const char * line = "[2014-01-01 12:00:00] TemperHum 001:005-i1/driver: 1; voltage: 3.5; temperature: 21.47 (6187, {0x18, 0x2B}) @ 14bit; humidity: 43.12 (1398, {0x05, 0x76}) @ 12bit; dew point: 8.37\n";
+
+	bench_log_stdio(path, line, lines);
+	bench_log_writer(path, "batch", line, lines, TEMPERHUM_SYNC_NONE);
+	// syncing is slow on real disks, a smaller amount of lines tells enough
+	bench_log_writer(path, "batch+sync", line, lines / 10, TEMPERHUM_SYNC_BATCH);
+	bench_log_writer(path, "line+sync", line, lines / 10, TEMPERHUM_SYNC_LINE);
+
+	unlink(path);
+}
+
+/**
+ * Reads simulated or replayed devices for a few cycles and prints time spent
+ * per cycle and how many reads failed, spec is passed to temperhum_set_transport()
+ */
+void bench_simulated(const char * spec, int cycles)
+{
+	int i, failed = 0, skipped = 0, count = 0;
+
+	if (temperhum_set_transport(spec) < 0) {
+		return;
+	}
+	temperhum_init(0, 0, "\0");
+
+	temperhum_device * device = temperhum_find();
+	temperhum_device * d;
+	for (d = device; d != NULL; d = d->next) {
+		d->measurement_resolution_temperature = 14;
+		d->measurement_resolution_humidity = 12;
+		d->sensor_voltage = 3.5;
+		count++;
+	}
+
+	double total = 0, max = 0;
+	unsigned long allocations = bench_allocated();
+	for (i = 0; i < cycles; i++) {
+		double start = bench_now_ms();
+		temperhum_fill_all(device);
+		double spent = bench_now_ms() - start;
+
+		total += spent;
+		if (spent > max) {
+			max = spent;
+		}
+		for (d = device; d != NULL; d = d->next) {
+			if (d->fill_result < 0) {
+				failed++;
+			} else if (!d->fill_result) {
+				skipped++;
+			}
+		}
+	}
+
+	char name[96], detail[128];
+	snprintf(name, sizeof(name), "cycle/%s", spec);
+	snprintf(detail, sizeof(detail), "%i devices, max %.1f ms, %i of %i reads failed, %i skipped while backed off", count, max, failed, count * cycles, skipped);
+	bench_record(name, total * 1000000 / cycles, (double) (bench_allocated() - allocations) / cycles, detail);
+
+	temperhum_close();
+}
+
+/**
+ * Saves results as a baseline for later runs
+ */
+int bench_save(const char * path)
+{
+	FILE * file = fopen(path, "w");
+	if (!file) {
+		temperhum_error(0, "Cannot open baseline '%s' for writing", path);
+		return -1;
+	}
+
+	int i;
+	for (i = 0; i < bench_result_count; i++) {
+		fprintf(file, "%s %.3f %.3f\n", bench_results[i].name, bench_results[i].ns, bench_results[i].allocations);
+	}
+	fclose(file);
+	printf("Baseline saved to %s\n", path);
+
+	return 0;
+}
+
+/**
+ * Compares results with a saved baseline, returns amount of regressions:
+ * benchmarks slower than threshold allows or allocating more than before
+ */
+int bench_compare(const char * path, double threshold)
+{
+	FILE * file = fopen(path, "r");
+	if (!file) {
+		temperhum_error(0, "Cannot open baseline '%s'", path);
+		return -1;
+	}
+
+	struct bench_result base;
+	int i, regressions = 0;
+
+	printf("\nCompared with %s (threshold %.0f%%):\n", path, threshold * 100);
+	while (fscanf(file, "%95s %lf %lf", base.name, &base.ns, &base.allocations) == 3) {
+		for (i = 0; i < bench_result_count; i++) {
+			struct bench_result *result = &bench_results[i];
+			if (strcmp(result->name, base.name)) {
+				continue;
+			}
+
+			double change = base.ns > 0 ? result->ns / base.ns - 1 : 0;
+			int regressed = change > threshold || result->allocations > base.allocations * (1 + threshold) + 0.005;
+			printf(
+				"%-62s %14.1f -> %14.1f ns/op %+7.1f%%, %.2f -> %.2f allocs/op%s\n",
+				result->name,
+				base.ns,
+				result->ns,
+				change * 100,
+				base.allocations,
+				result->allocations,
+				regressed ? "  REGRESSION" : ""
+			);
+			regressions += regressed;
+		}
+	}
+	fclose(file);
+
+	return regressions;
+}
+
+/**
+ * Benchmarks the hot path, simulated and attached devices.
+ * Usage: temper-hum-hid-bench [--save=baseline] [--compare=baseline] [--threshold=0.25] [samples]
+ */
+int main(int argc, char *argv[])
+{
+	int samples = DEFAULT_SAMPLES;
+	double threshold = DEFAULT_THRESHOLD;
+	const char * save = NULL;
+	const char * compare = NULL;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (!strncmp(argv[i], "--save=", 7)) {
+			save = argv[i] + 7;
+		} else if (!strncmp(argv[i], "--compare=", 10)) {
+			compare = argv[i] + 10;
+		} else if (!strncmp(argv[i], "--threshold=", 12)) {
+			threshold = atof(argv[i] + 12);
+		} else {
+			samples = atoi(argv[i]);
+		}
+	}
+	if (samples <= 0) {
+		samples = DEFAULT_SAMPLES;
+	}
+
+	bench_conversion(BENCH_OPS);
+	int mismatches = bench_batch(BENCH_BATCH);
+	mismatches += bench_sht1x_tables();
+	mismatches += bench_fixed_accuracy();
+	mismatches += bench_dew_point_accuracy();
+	mismatches += bench_stats_accuracy();
+	mismatches += bench_histogram_accuracy();
+	mismatches += bench_archive();
+	mismatches += bench_store();
+	mismatches += bench_query();
+	bench_log(BENCH_LOG_LINES);
+
+	// cycle time should not grow with the amount of devices as all of them are read at once
+	bench_simulated("sim:devices=1", BENCH_SIM_CYCLES);
+	bench_simulated("sim:devices=10", BENCH_SIM_CYCLES);
+	bench_simulated("sim:devices=100", BENCH_SIM_CYCLES);
+	bench_simulated("sim:devices=1000", BENCH_SIM_CYCLES);
+	bench_simulated("sim:devices=100,timeout=0.02,garbage=0.05,seed=7", BENCH_SIM_CYCLES * 2);
+	bench_simulated("sim:devices=10,measure=600", BENCH_SIM_CYCLES);
+
+	// the adaptive policy learns down to a sensor faster than the datasheet and starts short at lower resolutions
+	bench_policies("sim:devices=1,latency=0,measure=250", 14, 12, BENCH_POLICY_SAMPLES);
+	bench_policies("sim:devices=1,latency=0,measure=100", 12, 8, BENCH_POLICY_SAMPLES);
+
+	// a replay fails the same reads the capture did, only faster
+	if (temperhum_capture_start(BENCH_CAPTURE_FILE) == 0) {
+		bench_simulated("sim:devices=10,timeout=0.02,garbage=0.05,seed=3", BENCH_SIM_CYCLES);
+		temperhum_capture_stop();
+		bench_simulated("replay:file=" BENCH_CAPTURE_FILE ",speed=1", BENCH_SIM_CYCLES);
+		bench_simulated("replay:file=" BENCH_CAPTURE_FILE ",speed=0", BENCH_SIM_CYCLES);
+		unlink(BENCH_CAPTURE_FILE);
+	}
+
+	int regressions = 0;
+	if (compare) {
+		regressions = bench_compare(compare, threshold);
+	}
+	if (save && bench_save(save) < 0) {
+		return 1;
+	}
+	if (mismatches) {
+		printf("%i conversions do not match the per-device one\n", mismatches);
+		return 1;
+	}
+	if (regressions) {
+		printf("%i benchmarks regressed\n", regressions);
+		return 1;
+	}
+
+	// latency of real devices depends on the hardware, it is printed but never compared
+	temperhum_set_transport("usb");
+	temperhum_init(0, 0, "\0");
+
+	temperhum_device * device = temperhum_find();
+	if (!device) {
+		temperhum_error(0, "No temperhum devices found to benchmark reading");
+		temperhum_close();
+		return 0;
+	}
+
+	temperhum_device * d;
+	for (d = device; d != NULL; d = d->next) {
+		d->measurement_resolution_temperature = 14;
+		d->measurement_resolution_humidity = 12;
+		d->sensor_voltage = 3.5;
+	}
+
+	bench_sample_latency(device, "fixed", TEMPERHUM_WAIT_FIXED, samples);
+	bench_sample_latency(device, "adaptive", TEMPERHUM_WAIT_ADAPTIVE, samples);
+
+	temperhum_close();
+	return 0;
+}
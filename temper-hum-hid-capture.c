@@ -0,0 +1,280 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Binary capture of control transfers. The file starts with "THHC", a 16 bit
+ * version and 16 reserved bits, then records follow, all numbers in host order:
+ *   'D' id:16 bus:8 address:8 interface:8 path_length:8 path    device first seen
+ *   'T' id:16 request_type:8 request:8 value:16 status:16
+ *       duration:32 timestamp:64 length:16 payload               transfer
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-transport.h"
+#include "temper-hum-hid-capture.h"
+
+#define TEMPERHUM_CAPTURE_MAGIC "THHC"
+#define TEMPERHUM_CAPTURE_VERSION 1
+#define TEMPERHUM_CAPTURE_DEVICES 256
+
+static FILE *temperhum_capture_file = NULL;
+static int64_t temperhum_capture_started;
+static struct temperhum_capture_device temperhum_capture_devices[TEMPERHUM_CAPTURE_DEVICES];
+static int temperhum_capture_device_count = 0;
+
+/**
+ * Current monotonic time in microseconds
+ */
+static int64_t temperhum_capture_now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * Starts recording every control transfer to a file
+ */
+int temperhum_capture_start(const char * path)
+{
+	uint16_t header[2] = {TEMPERHUM_CAPTURE_VERSION, 0};
+
+	temperhum_capture_stop();
+
+	temperhum_capture_file = fopen(path, "wb");
+	if (!temperhum_capture_file) {
+		temperhum_error(0, "Cannot open capture file '%s' for writing", path);
+		return -1;
+	}
+	setvbuf(temperhum_capture_file, NULL, _IOFBF, 65536);
+
+	fwrite(TEMPERHUM_CAPTURE_MAGIC, 1, 4, temperhum_capture_file);
+	fwrite(header, sizeof(header), 1, temperhum_capture_file);
+	temperhum_capture_started = temperhum_capture_now();
+	temperhum_capture_device_count = 0;
+
+	return 0;
+}
+
+/**
+ * Stops recording and closes the capture file
+ */
+void temperhum_capture_stop()
+{
+	if (temperhum_capture_file) {
+		fclose(temperhum_capture_file);
+		temperhum_capture_file = NULL;
+	}
+}
+
+/**
+ * Writes buffered records, called once per cycle so that a capture of a
+ * daemon which dies keeps the transfers leading to it
+ */
+void temperhum_capture_flush()
+{
+	if (temperhum_capture_file) {
+		fflush(temperhum_capture_file);
+	}
+}
+
+/**
+ * Id of a device in the capture, the device is written to the capture when first seen
+ */
+static int temperhum_capture_device(temperhum_device * device)
+{
+	int i;
+
+	for (i = 0; i < temperhum_capture_device_count; i++) {
+		struct temperhum_capture_device *known = &temperhum_capture_devices[i];
+		if (known->interface_number == device->interface_number && known->bus_number == device->bus_number && known->device_number == device->device_number && !strcmp(known->port_path, device->port_path)) {
+			return known->id;
+		}
+	}
+	if (temperhum_capture_device_count == TEMPERHUM_CAPTURE_DEVICES) {
+		return -1;
+	}
+
+	struct temperhum_capture_device *known = &temperhum_capture_devices[temperhum_capture_device_count];
+	known->id = temperhum_capture_device_count++;
+	known->bus_number = device->bus_number;
+	known->device_number = device->device_number;
+	known->interface_number = device->interface_number;
+	snprintf(known->port_path, sizeof(known->port_path), "%s", device->port_path);
+
+	unsigned char record[7 + TEMPERHUM_PORT_PATH_LENGTH];
+	uint8_t path_length = strlen(known->port_path);
+	record[0] = 'D';
+	memcpy(record + 1, &known->id, 2);
+	record[3] = known->bus_number;
+	record[4] = known->device_number;
+	record[5] = known->interface_number;
+	record[6] = path_length;
+	memcpy(record + 7, known->port_path, path_length);
+	fwrite(record, 7 + path_length, 1, temperhum_capture_file);
+
+	return known->id;
+}
+
+/**
+ * Records a finished control transfer if capturing, status is 0 for
+ * transfers which succeeded and size is the amount of bytes transferred
+ */
+void temperhum_capture_transfer(temperhum_device * device, int direction, int status, const unsigned char * data, int size, int64_t duration)
+{
+	if (!temperhum_capture_file) {
+		return;
+	}
+
+	int id = temperhum_capture_device(device);
+	if (id < 0) {
+		return;
+	}
+
+	struct temperhum_capture_record record;
+	record.device = id;
+	if (direction == TEMPERHUM_TRANSFER_OUT) {
+		record.request_type = 0x21; // class, interface, host to device
+		record.request = 0x09; // HID Set_Report
+		record.value = 2 << 8; // HID output
+	} else {
+		record.request_type = 0xA1; // class, interface, device to host
+		record.request = 0x01; // HID Get_Report
+		record.value = 3 << 8; // HID input
+	}
+	record.status = status;
+	record.duration = duration > 0 ? duration : 0;
+	record.timestamp = temperhum_capture_now() - temperhum_capture_started;
+	record.length = size > 0 ? size : 0;
+
+	unsigned char header[24];
+	header[0] = 'T';
+	memcpy(header + 1, &record.device, 2);
+	header[3] = record.request_type;
+	header[4] = record.request;
+	memcpy(header + 5, &record.value, 2);
+	memcpy(header + 7, &record.status, 2);
+	memcpy(header + 9, &record.duration, 4);
+	memcpy(header + 13, &record.timestamp, 8);
+	memcpy(header + 21, &record.length, 2);
+	fwrite(header, 23, 1, temperhum_capture_file);
+	if (record.length) {
+		fwrite(data, record.length, 1, temperhum_capture_file);
+	}
+}
+
+/**
+ * Reads a whole capture file into memory
+ */
+int temperhum_capture_load(const char * path, struct temperhum_capture * capture)
+{
+	FILE *file = fopen(path, "rb");
+	long size;
+
+	memset(capture, 0, sizeof(struct temperhum_capture));
+	if (!file) {
+		temperhum_error(0, "Cannot open capture file '%s'", path);
+		return -1;
+	}
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	capture->payload = malloc(size > 0 ? size : 1);
+	if (!capture->payload || fread(capture->payload, 1, size, file) != (size_t) size) {
+		fclose(file);
+		temperhum_capture_free(capture);
+		temperhum_error(0, "Cannot read capture file '%s'", path);
+		return -1;
+	}
+	fclose(file);
+
+	unsigned char *p = capture->payload, *end = capture->payload + size;
+	uint16_t version = 0;
+	if (size >= 8) {
+		memcpy(&version, p + 4, 2);
+	}
+	if (size < 8 || memcmp(p, TEMPERHUM_CAPTURE_MAGIC, 4) || version != TEMPERHUM_CAPTURE_VERSION) {
+		temperhum_capture_free(capture);
+		temperhum_error(0, "File '%s' is not a capture", path);
+		return -1;
+	}
+	p += 8;
+
+	// records are counted first so that both arrays are allocated once
+	int devices = 0, records = 0, pass;
+	for (pass = 0; pass < 2; pass++) {
+		unsigned char *q = p;
+		if (pass) {
+			capture->devices = calloc(devices + 1, sizeof(struct temperhum_capture_device));
+			capture->records = calloc(records + 1, sizeof(struct temperhum_capture_record));
+			if (!capture->devices || !capture->records) {
+				temperhum_capture_free(capture);
+				return -1;
+			}
+		}
+
+		while (q < end) {
+			if (*q == 'D' && q + 7 <= end && q + 7 + q[6] <= end) {
+				if (pass) {
+					struct temperhum_capture_device *d = &capture->devices[capture->device_count++];
+					int length = q[6] < TEMPERHUM_PORT_PATH_LENGTH ? q[6] : TEMPERHUM_PORT_PATH_LENGTH - 1;
+					memcpy(&d->id, q + 1, 2);
+					d->bus_number = q[3];
+					d->device_number = q[4];
+					d->interface_number = q[5];
+					memcpy(d->port_path, q + 7, length);
+					d->port_path[length] = 0x00;
+				} else {
+					devices++;
+				}
+				q += 7 + q[6];
+			} else if (*q == 'T' && q + 23 <= end) {
+				uint16_t length;
+				memcpy(&length, q + 21, 2);
+				if (q + 23 + length > end) {
+					break;
+				}
+				if (pass) {
+					struct temperhum_capture_record *r = &capture->records[capture->record_count++];
+					memcpy(&r->device, q + 1, 2);
+					r->request_type = q[3];
+					r->request = q[4];
+					memcpy(&r->value, q + 5, 2);
+					memcpy(&r->status, q + 7, 2);
+					memcpy(&r->duration, q + 9, 4);
+					memcpy(&r->timestamp, q + 13, 8);
+					r->length = length;
+					r->data = q + 23;
+				} else {
+					records++;
+				}
+				q += 23 + length;
+			} else {
+				// a capture cut by a crash ends with a partial record
+				break;
+			}
+		}
+	}
+
+	temperhum_debug("Loaded capture of %i devices with %i transfers", capture->device_count, capture->record_count);
+
+	return 0;
+}
+
+/**
+ * Frees a capture loaded by temperhum_capture_load()
+ */
+void temperhum_capture_free(struct temperhum_capture * capture)
+{
+	free(capture->devices);
+	free(capture->records);
+	free(capture->payload);
+	memset(capture, 0, sizeof(struct temperhum_capture));
+}
@@ -0,0 +1,61 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_CAPTURE
+#define TEMPER_HUM_HID_CAPTURE
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "temper-hum-hid-api.h"
+
+/**
+ * Device seen in a capture
+ */
+struct temperhum_capture_device {
+	uint16_t id;
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+};
+
+/**
+ * Control transfer made to a device
+ */
+struct temperhum_capture_record {
+	uint16_t device; /** id of the device */
+	uint8_t request_type; /** bmRequestType, direction is in the highest bit */
+	uint8_t request; /** bRequest */
+	uint16_t value; /** wValue */
+	int16_t status; /** 0 if the transfer succeeded */
+	uint32_t duration; /** time in us the transfer took */
+	int64_t timestamp; /** monotonic time in us since the capture started */
+	uint16_t length;
+	unsigned char *data;
+};
+
+/**
+ * Capture loaded into memory for replaying
+ */
+struct temperhum_capture {
+	struct temperhum_capture_device *devices;
+	int device_count;
+	struct temperhum_capture_record *records;
+	int record_count;
+	unsigned char *payload;
+};
+
+void temperhum_capture_transfer(temperhum_device * device, int direction, int status, const unsigned char * data, int size, int64_t duration);
+int temperhum_capture_load(const char * path, struct temperhum_capture * capture);
+void temperhum_capture_free(struct temperhum_capture * capture);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_CAPTURE */
@@ -32,14 +32,35 @@ const char *gengetopt_args_info_usage = "Usage: temper-hum-hid [OPTIONS]...";
 const char *gengetopt_args_info_description = "";
 
 const char *gengetopt_args_info_help[] = {
-  "  -h, --help                Print help and exit",
-  "  -V, --version             Print version and exit",
-  "  -v, --verbose[=filename]  Print debug messages, to standard output if no \n                              filename given  (default=`')",
-  "  -s, --syslog              Log debug messages to syslog  (default=off)",
-  "  -l, --log=filename        Log data to log file",
-  "  -o, --out=filename        Output results to a file instead of printing it on \n                              screen, can be used for creating a status file \n                              which always has latest measurments",
-  "  -r, --repeat=seconds      Constantly print results, repeat every given amount \n                              of seconds, devices will be reopened every 1 hour \n                              in this mode, 0 for no repeat  (default=`0')",
-  "  -m, --machine             Output in machine-friendly format, which is easier \n                              to be parsed by bash scripts for later use in \n                              monitoring tools, 4ex. Zabbix  (default=off)",
+  "  -h, --help                     Print help and exit",
+  "  -V, --version                  Print version and exit",
+  "  -v, --verbose[=filename]       Print debug messages, to standard output if no \n                                   filename given  (default=`')",
+  "  -s, --syslog                   Log debug messages to syslog  (default=off)",
+  "  -l, --log=filename             Log data to log file",
+  "      --log-window=milliseconds  Collect log lines for given amount of \n                                   milliseconds and write them to the log file \n                                   at once, 0 to write once per cycle \n                                   (default=`0')",
+  "      --log-buffer=bytes         Size of the log buffer, lines are written \n                                   earlier when it is full  (default=`65536')",
+  "      --log-sync=level           Durability of the log file: none, batch \n                                   (fdatasync after every write) or line (write \n                                   and fdatasync every line)  (default=`none')",
+  "  -o, --out=filename             Output results to a file instead of printing \n                                   it on screen, can be used for creating a \n                                   status file which always has latest \n                                   measurments",
+  "  -r, --repeat=seconds           Constantly print results, repeat every given \n                                   amount of seconds, devices will be reopened \n                                   every 1 hour in this mode when usb hotplug \n                                   is not supported, 0 for no repeat \n                                   (default=`0')",
+  "  -i, --interval=milliseconds    Constantly print results, repeat every given \n                                   amount of milliseconds on a grid aligned to \n                                   the wall clock, overrides --repeat",
+  "      --device-interval=list     Read some devices at their own interval, comma \n                                   separated list of port=milliseconds or \n                                   bus:device=milliseconds, 4ex. \n                                   1-1.4=2000,001:005=300000",
+  "      --shm=name                 Publish latest readings in a POSIX shared \n                                   memory table for local readers, 4ex. \n                                   /temper-hum-hid",
+  "      --metrics-port=port        Serve latest readings as Prometheus metrics on \n                                   http://address:port/metrics",
+  "      --metrics-address=address  Address to serve metrics on \n                                   (default=`127.0.0.1')",
+  "      --socket=path              Answer queries on a unix socket, with --client \n                                   ask a running daemon instead of reading \n                                   devices, 4ex. /run/temper-hum-hid.sock",
+  "      --client                   Get readings from the daemon listening on \n                                   --socket, devices are read directly if there \n                                   is no daemon  (default=off)",
+  "      --max-age=milliseconds     Readings of the daemon older than given amount \n                                   of milliseconds are read again for --client \n                                   (default=`60000')",
+  "      --simulate=options         Read simulated devices instead of usb ones, \n                                   for testing without sensors, 4ex. \n                                   devices=10,latency=1000,measure=400,timeout=0.01,garbage=0.01",
+  "      --capture=filename         Record every usb transfer to a file for \n                                   replaying it later",
+  "      --replay=filename          Read devices recorded with --capture instead \n                                   of usb ones",
+  "      --replay-speed=DOUBLE      How many times faster than recorded to replay, \n                                   0 to replay without waiting  (default=`1')",
+  "      --archive=directory        Keep a round robin archive of fixed size per \n                                   device in given directory with raw readings \n                                   of a day and averages, minimums and maximums \n                                   of minutes for 30 days, hours for 2 years \n                                   and days for 10 years",
+  "      --store=directory          Store every reading compressed in a file per \n                                   device in given directory, a few bytes per \n                                   reading instead of a log line",
+  "      --store-chunk=readings     Readings kept in memory before they are \n                                   compressed and written to --store at once, \n                                   they are lost if the daemon is killed \n                                   (default=`1024')",
+  "      --store-age=seconds        Readings kept in memory are written to --store \n                                   once the oldest of them is older than given \n                                   amount of seconds even if there are less \n                                   than --store-chunk, this bounds the readings \n                                   lost if the daemon is killed, 0 to write \n                                   full chunks only  (default=`3600')",
+  "      --history=options          Print readings of a device in --store \n                                   aggregated over steps of a range of time and \n                                   exit, 4ex. device=1-1.4-i1,last=30d,step=1h \n                                   or \n                                   device=1-1.4-i1,from=2014-05-01,to=2014-05-13T12:00,step=5m",
+  "  -m, --machine                  Output in machine-friendly format, which is \n                                   easier to be parsed by bash scripts for \n                                   later use in monitoring tools, 4ex. Zabbix \n                                   (default=off)",
+  "      --fixed-wait               Always wait 400ms for sensors to finish \n                                   measuring instead of learning the time each \n                                   sensor needs  (default=off)",
   "Usage example:\n\n  temper-hum-hid --log=/var/log/temper-hum-hid.log \n--out=/var/log/temper-hum-hid.status --repeat=60 --machine",
     0
 };
@@ -48,6 +69,7 @@ typedef enum {ARG_NO
   , ARG_FLAG
   , ARG_STRING
   , ARG_INT
+  , ARG_DOUBLE
 } cmdline_parser_arg_type;
 
 static
@@ -71,9 +93,30 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->verbose_given = 0 ;
   args_info->syslog_given = 0 ;
   args_info->log_given = 0 ;
+  args_info->log_window_given = 0 ;
+  args_info->log_buffer_given = 0 ;
+  args_info->log_sync_given = 0 ;
   args_info->out_given = 0 ;
   args_info->repeat_given = 0 ;
+  args_info->interval_given = 0 ;
+  args_info->device_interval_given = 0 ;
+  args_info->shm_given = 0 ;
+  args_info->metrics_port_given = 0 ;
+  args_info->metrics_address_given = 0 ;
+  args_info->socket_given = 0 ;
+  args_info->client_given = 0 ;
+  args_info->max_age_given = 0 ;
+  args_info->simulate_given = 0 ;
+  args_info->capture_given = 0 ;
+  args_info->replay_given = 0 ;
+  args_info->replay_speed_given = 0 ;
+  args_info->archive_given = 0 ;
+  args_info->store_given = 0 ;
+  args_info->store_chunk_given = 0 ;
+  args_info->store_age_given = 0 ;
+  args_info->history_given = 0 ;
   args_info->machine_given = 0 ;
+  args_info->fixed_wait_given = 0 ;
 }
 
 static
@@ -85,11 +128,49 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->syslog_flag = 0;
   args_info->log_arg = NULL;
   args_info->log_orig = NULL;
+  args_info->log_window_arg = 0;
+  args_info->log_window_orig = NULL;
+  args_info->log_buffer_arg = 65536;
+  args_info->log_buffer_orig = NULL;
+  args_info->log_sync_arg = gengetopt_strdup ("none");
+  args_info->log_sync_orig = NULL;
   args_info->out_arg = NULL;
   args_info->out_orig = NULL;
   args_info->repeat_arg = 0;
   args_info->repeat_orig = NULL;
+  args_info->interval_orig = NULL;
+  args_info->device_interval_arg = NULL;
+  args_info->device_interval_orig = NULL;
+  args_info->shm_arg = NULL;
+  args_info->shm_orig = NULL;
+  args_info->metrics_port_orig = NULL;
+  args_info->metrics_address_arg = gengetopt_strdup ("127.0.0.1");
+  args_info->metrics_address_orig = NULL;
+  args_info->socket_arg = NULL;
+  args_info->socket_orig = NULL;
+  args_info->client_flag = 0;
+  args_info->max_age_arg = 60000;
+  args_info->max_age_orig = NULL;
+  args_info->simulate_arg = NULL;
+  args_info->simulate_orig = NULL;
+  args_info->capture_arg = NULL;
+  args_info->capture_orig = NULL;
+  args_info->replay_arg = NULL;
+  args_info->replay_orig = NULL;
+  args_info->replay_speed_arg = 1;
+  args_info->replay_speed_orig = NULL;
+  args_info->archive_arg = NULL;
+  args_info->archive_orig = NULL;
+  args_info->store_arg = NULL;
+  args_info->store_orig = NULL;
+  args_info->store_chunk_arg = 1024;
+  args_info->store_chunk_orig = NULL;
+  args_info->store_age_arg = 3600;
+  args_info->store_age_orig = NULL;
+  args_info->history_arg = NULL;
+  args_info->history_orig = NULL;
   args_info->machine_flag = 0;
+  args_info->fixed_wait_flag = 0;
   
 }
 
@@ -103,9 +184,30 @@ void init_args_info(struct gengetopt_args_info *args_info)
   args_info->verbose_help = gengetopt_args_info_help[2] ;
   args_info->syslog_help = gengetopt_args_info_help[3] ;
   args_info->log_help = gengetopt_args_info_help[4] ;
-  args_info->out_help = gengetopt_args_info_help[5] ;
-  args_info->repeat_help = gengetopt_args_info_help[6] ;
-  args_info->machine_help = gengetopt_args_info_help[7] ;
+  args_info->log_window_help = gengetopt_args_info_help[5] ;
+  args_info->log_buffer_help = gengetopt_args_info_help[6] ;
+  args_info->log_sync_help = gengetopt_args_info_help[7] ;
+  args_info->out_help = gengetopt_args_info_help[8] ;
+  args_info->repeat_help = gengetopt_args_info_help[9] ;
+  args_info->interval_help = gengetopt_args_info_help[10] ;
+  args_info->device_interval_help = gengetopt_args_info_help[11] ;
+  args_info->shm_help = gengetopt_args_info_help[12] ;
+  args_info->metrics_port_help = gengetopt_args_info_help[13] ;
+  args_info->metrics_address_help = gengetopt_args_info_help[14] ;
+  args_info->socket_help = gengetopt_args_info_help[15] ;
+  args_info->client_help = gengetopt_args_info_help[16] ;
+  args_info->max_age_help = gengetopt_args_info_help[17] ;
+  args_info->simulate_help = gengetopt_args_info_help[18] ;
+  args_info->capture_help = gengetopt_args_info_help[19] ;
+  args_info->replay_help = gengetopt_args_info_help[20] ;
+  args_info->replay_speed_help = gengetopt_args_info_help[21] ;
+  args_info->archive_help = gengetopt_args_info_help[22] ;
+  args_info->store_help = gengetopt_args_info_help[23] ;
+  args_info->store_chunk_help = gengetopt_args_info_help[24] ;
+  args_info->store_age_help = gengetopt_args_info_help[25] ;
+  args_info->history_help = gengetopt_args_info_help[26] ;
+  args_info->machine_help = gengetopt_args_info_help[27] ;
+  args_info->fixed_wait_help = gengetopt_args_info_help[28] ;
   
 }
 
@@ -190,9 +292,39 @@ cmdline_parser_release (struct gengetopt_args_info *args_info)
   free_string_field (&(args_info->verbose_orig));
   free_string_field (&(args_info->log_arg));
   free_string_field (&(args_info->log_orig));
+  free_string_field (&(args_info->log_window_orig));
+  free_string_field (&(args_info->log_buffer_orig));
+  free_string_field (&(args_info->log_sync_arg));
+  free_string_field (&(args_info->log_sync_orig));
   free_string_field (&(args_info->out_arg));
   free_string_field (&(args_info->out_orig));
   free_string_field (&(args_info->repeat_orig));
+  free_string_field (&(args_info->interval_orig));
+  free_string_field (&(args_info->device_interval_arg));
+  free_string_field (&(args_info->device_interval_orig));
+  free_string_field (&(args_info->shm_arg));
+  free_string_field (&(args_info->shm_orig));
+  free_string_field (&(args_info->metrics_port_orig));
+  free_string_field (&(args_info->metrics_address_arg));
+  free_string_field (&(args_info->metrics_address_orig));
+  free_string_field (&(args_info->socket_arg));
+  free_string_field (&(args_info->socket_orig));
+  free_string_field (&(args_info->max_age_orig));
+  free_string_field (&(args_info->simulate_arg));
+  free_string_field (&(args_info->simulate_orig));
+  free_string_field (&(args_info->capture_arg));
+  free_string_field (&(args_info->capture_orig));
+  free_string_field (&(args_info->replay_arg));
+  free_string_field (&(args_info->replay_orig));
+  free_string_field (&(args_info->replay_speed_orig));
+  free_string_field (&(args_info->archive_arg));
+  free_string_field (&(args_info->archive_orig));
+  free_string_field (&(args_info->store_arg));
+  free_string_field (&(args_info->store_orig));
+  free_string_field (&(args_info->store_chunk_orig));
+  free_string_field (&(args_info->store_age_orig));
+  free_string_field (&(args_info->history_arg));
+  free_string_field (&(args_info->history_orig));
   
   
 
@@ -233,12 +365,54 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "syslog", 0, 0 );
   if (args_info->log_given)
     write_into_file(outfile, "log", args_info->log_orig, 0);
+  if (args_info->log_window_given)
+    write_into_file(outfile, "log-window", args_info->log_window_orig, 0);
+  if (args_info->log_buffer_given)
+    write_into_file(outfile, "log-buffer", args_info->log_buffer_orig, 0);
+  if (args_info->log_sync_given)
+    write_into_file(outfile, "log-sync", args_info->log_sync_orig, 0);
   if (args_info->out_given)
     write_into_file(outfile, "out", args_info->out_orig, 0);
   if (args_info->repeat_given)
     write_into_file(outfile, "repeat", args_info->repeat_orig, 0);
+  if (args_info->interval_given)
+    write_into_file(outfile, "interval", args_info->interval_orig, 0);
+  if (args_info->device_interval_given)
+    write_into_file(outfile, "device-interval", args_info->device_interval_orig, 0);
+  if (args_info->shm_given)
+    write_into_file(outfile, "shm", args_info->shm_orig, 0);
+  if (args_info->metrics_port_given)
+    write_into_file(outfile, "metrics-port", args_info->metrics_port_orig, 0);
+  if (args_info->metrics_address_given)
+    write_into_file(outfile, "metrics-address", args_info->metrics_address_orig, 0);
+  if (args_info->socket_given)
+    write_into_file(outfile, "socket", args_info->socket_orig, 0);
+  if (args_info->client_given)
+    write_into_file(outfile, "client", 0, 0 );
+  if (args_info->max_age_given)
+    write_into_file(outfile, "max-age", args_info->max_age_orig, 0);
+  if (args_info->simulate_given)
+    write_into_file(outfile, "simulate", args_info->simulate_orig, 0);
+  if (args_info->capture_given)
+    write_into_file(outfile, "capture", args_info->capture_orig, 0);
+  if (args_info->replay_given)
+    write_into_file(outfile, "replay", args_info->replay_orig, 0);
+  if (args_info->replay_speed_given)
+    write_into_file(outfile, "replay-speed", args_info->replay_speed_orig, 0);
+  if (args_info->archive_given)
+    write_into_file(outfile, "archive", args_info->archive_orig, 0);
+  if (args_info->store_given)
+    write_into_file(outfile, "store", args_info->store_orig, 0);
+  if (args_info->store_chunk_given)
+    write_into_file(outfile, "store-chunk", args_info->store_chunk_orig, 0);
+  if (args_info->store_age_given)
+    write_into_file(outfile, "store-age", args_info->store_age_orig, 0);
+  if (args_info->history_given)
+    write_into_file(outfile, "history", args_info->history_orig, 0);
   if (args_info->machine_given)
     write_into_file(outfile, "machine", 0, 0 );
+  if (args_info->fixed_wait_given)
+    write_into_file(outfile, "fixed-wait", 0, 0 );
   
 
   i = EXIT_SUCCESS;
@@ -411,6 +585,9 @@ int update_arg(void *field, char **orig_field,
   case ARG_INT:
     if (val) *((int *)field) = strtol (val, &stop_char, 0);
     break;
+  case ARG_DOUBLE:
+    if (val) *((double *)field) = strtod (val, &stop_char);
+    break;
   case ARG_STRING:
     if (val) {
       string_field = (char **)field;
@@ -426,6 +603,7 @@ int update_arg(void *field, char **orig_field,
   /* check numeric conversion */
   switch(arg_type) {
   case ARG_INT:
+  case ARG_DOUBLE:
     if (val && !(stop_char && *stop_char == '\0')) {
       fprintf(stderr, "%s: invalid numeric value: %s\n", package_name, val);
       return 1; /* failure */
@@ -498,13 +676,34 @@ cmdline_parser_internal (
         { "verbose",	2, NULL, 'v' },
         { "syslog",	0, NULL, 's' },
         { "log",	1, NULL, 'l' },
+        { "log-window",	1, NULL, 0 },
+        { "log-buffer",	1, NULL, 0 },
+        { "log-sync",	1, NULL, 0 },
         { "out",	1, NULL, 'o' },
         { "repeat",	1, NULL, 'r' },
+        { "interval",	1, NULL, 'i' },
+        { "device-interval",	1, NULL, 0 },
+        { "shm",	1, NULL, 0 },
+        { "metrics-port",	1, NULL, 0 },
+        { "metrics-address",	1, NULL, 0 },
+        { "socket",	1, NULL, 0 },
+        { "client",	0, NULL, 0 },
+        { "max-age",	1, NULL, 0 },
+        { "simulate",	1, NULL, 0 },
+        { "capture",	1, NULL, 0 },
+        { "replay",	1, NULL, 0 },
+        { "replay-speed",	1, NULL, 0 },
+        { "archive",	1, NULL, 0 },
+        { "store",	1, NULL, 0 },
+        { "store-chunk",	1, NULL, 0 },
+        { "store-age",	1, NULL, 0 },
+        { "history",	1, NULL, 0 },
         { "machine",	0, NULL, 'm' },
+        { "fixed-wait",	0, NULL, 0 },
         { 0,  0, 0, 0 }
       };
 
-      c = getopt_long (argc, argv, "hVv::sl:o:r:m", long_options, &option_index);
+      c = getopt_long (argc, argv, "hVv::sl:o:r:i:m", long_options, &option_index);
 
       if (c == -1) break;	/* Exit from `while (1)' loop.  */
 
@@ -566,7 +765,7 @@ cmdline_parser_internal (
             goto failure;
         
           break;
-        case 'r':	/* Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode, 0 for no repeat.  */
+        case 'r':	/* Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode when usb hotplug is not supported, 0 for no repeat.  */
         
         
           if (update_arg( (void *)&(args_info->repeat_arg), 
@@ -577,6 +776,18 @@ cmdline_parser_internal (
               additional_error))
             goto failure;
         
+          break;
+        case 'i':	/* Constantly print results, repeat every given amount of milliseconds on a grid aligned to the wall clock, overrides --repeat.  */
+        
+        
+          if (update_arg( (void *)&(args_info->interval_arg), 
+               &(args_info->interval_orig), &(args_info->interval_given),
+              &(local_args_info.interval_given), optarg, 0, 0, ARG_INT,
+              check_ambiguity, override, 0, 0,
+              "interval", 'i',
+              additional_error))
+            goto failure;
+        
           break;
         case 'm':	/* Output in machine-friendly format, which is easier to be parsed by bash scripts for later use in monitoring tools, 4ex. Zabbix.  */
         
@@ -590,6 +801,284 @@ cmdline_parser_internal (
           break;
 
         case 0:	/* Long option with no short option */
+          /* Collect log lines for given amount of milliseconds and write them to the log file at once, 0 to write once per cycle.  */
+          if (strcmp (long_options[option_index].name, "log-window") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->log_window_arg), 
+                 &(args_info->log_window_orig), &(args_info->log_window_given),
+                &(local_args_info.log_window_given), optarg, 0, "0", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "log-window", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Size of the log buffer, lines are written earlier when it is full.  */
+          else if (strcmp (long_options[option_index].name, "log-buffer") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->log_buffer_arg), 
+                 &(args_info->log_buffer_orig), &(args_info->log_buffer_given),
+                &(local_args_info.log_buffer_given), optarg, 0, "65536", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "log-buffer", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Durability of the log file: none, batch (fdatasync after every write) or line (write and fdatasync every line).  */
+          else if (strcmp (long_options[option_index].name, "log-sync") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->log_sync_arg), 
+                 &(args_info->log_sync_orig), &(args_info->log_sync_given),
+                &(local_args_info.log_sync_given), optarg, 0, "none", ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "log-sync", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Read some devices at their own interval, comma separated list of port=milliseconds or bus:device=milliseconds, 4ex. 1-1.4=2000,001:005=300000.  */
+          else if (strcmp (long_options[option_index].name, "device-interval") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->device_interval_arg), 
+                 &(args_info->device_interval_orig), &(args_info->device_interval_given),
+                &(local_args_info.device_interval_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "device-interval", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Publish latest readings in a POSIX shared memory table for local readers, 4ex. /temper-hum-hid.  */
+          else if (strcmp (long_options[option_index].name, "shm") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->shm_arg), 
+                 &(args_info->shm_orig), &(args_info->shm_given),
+                &(local_args_info.shm_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "shm", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Serve latest readings as Prometheus metrics on http://address:port/metrics.  */
+          else if (strcmp (long_options[option_index].name, "metrics-port") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->metrics_port_arg), 
+                 &(args_info->metrics_port_orig), &(args_info->metrics_port_given),
+                &(local_args_info.metrics_port_given), optarg, 0, 0, ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "metrics-port", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Address to serve metrics on.  */
+          else if (strcmp (long_options[option_index].name, "metrics-address") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->metrics_address_arg), 
+                 &(args_info->metrics_address_orig), &(args_info->metrics_address_given),
+                &(local_args_info.metrics_address_given), optarg, 0, "127.0.0.1", ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "metrics-address", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Answer queries on a unix socket, with --client ask a running daemon instead of reading devices, 4ex. /run/temper-hum-hid.sock.  */
+          else if (strcmp (long_options[option_index].name, "socket") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->socket_arg), 
+                 &(args_info->socket_orig), &(args_info->socket_given),
+                &(local_args_info.socket_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "socket", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Get readings from the daemon listening on --socket, devices are read directly if there is no daemon.  */
+          else if (strcmp (long_options[option_index].name, "client") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->client_flag), 0, &(args_info->client_given),
+                &(local_args_info.client_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "client", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Readings of the daemon older than given amount of milliseconds are read again for --client.  */
+          else if (strcmp (long_options[option_index].name, "max-age") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->max_age_arg), 
+                 &(args_info->max_age_orig), &(args_info->max_age_given),
+                &(local_args_info.max_age_given), optarg, 0, "60000", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "max-age", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Read simulated devices instead of usb ones, for testing without sensors, 4ex. devices=10,latency=1000,measure=400,timeout=0.01,garbage=0.01.  */
+          else if (strcmp (long_options[option_index].name, "simulate") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->simulate_arg), 
+                 &(args_info->simulate_orig), &(args_info->simulate_given),
+                &(local_args_info.simulate_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "simulate", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Record every usb transfer to a file for replaying it later.  */
+          else if (strcmp (long_options[option_index].name, "capture") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->capture_arg), 
+                 &(args_info->capture_orig), &(args_info->capture_given),
+                &(local_args_info.capture_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "capture", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Read devices recorded with --capture instead of usb ones.  */
+          else if (strcmp (long_options[option_index].name, "replay") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->replay_arg), 
+                 &(args_info->replay_orig), &(args_info->replay_given),
+                &(local_args_info.replay_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "replay", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* How many times faster than recorded to replay, 0 to replay without waiting.  */
+          else if (strcmp (long_options[option_index].name, "replay-speed") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->replay_speed_arg), 
+                 &(args_info->replay_speed_orig), &(args_info->replay_speed_given),
+                &(local_args_info.replay_speed_given), optarg, 0, "1", ARG_DOUBLE,
+                check_ambiguity, override, 0, 0,
+                "replay-speed", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Keep a round robin archive of fixed size per device in given directory with raw readings of a day and averages, minimums and maximums of minutes for 30 days, hours for 2 years and days for 10 years.  */
+          else if (strcmp (long_options[option_index].name, "archive") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->archive_arg), 
+                 &(args_info->archive_orig), &(args_info->archive_given),
+                &(local_args_info.archive_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "archive", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Store every reading compressed in a file per device in given directory, a few bytes per reading instead of a log line.  */
+          else if (strcmp (long_options[option_index].name, "store") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->store_arg), 
+                 &(args_info->store_orig), &(args_info->store_given),
+                &(local_args_info.store_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "store", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Readings kept in memory before they are compressed and written to --store at once, they are lost if the daemon is killed.  */
+          else if (strcmp (long_options[option_index].name, "store-chunk") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->store_chunk_arg), 
+                 &(args_info->store_chunk_orig), &(args_info->store_chunk_given),
+                &(local_args_info.store_chunk_given), optarg, 0, "1024", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "store-chunk", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Readings kept in memory are written to --store once the oldest of them is older than given amount of seconds even if there are less than --store-chunk, this bounds the readings lost if the daemon is killed, 0 to write full chunks only.  */
+          else if (strcmp (long_options[option_index].name, "store-age") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->store_age_arg), 
+                 &(args_info->store_age_orig), &(args_info->store_age_given),
+                &(local_args_info.store_age_given), optarg, 0, "3600", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "store-age", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Print readings of a device in --store aggregated over steps of a range of time and exit, 4ex. device=1-1.4-i1,last=30d,step=1h or device=1-1.4-i1,from=2014-05-01,to=2014-05-13T12:00,step=5m.  */
+          else if (strcmp (long_options[option_index].name, "history") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->history_arg), 
+                 &(args_info->history_orig), &(args_info->history_given),
+                &(local_args_info.history_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "history", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Always wait 400ms for sensors to finish measuring instead of learning the time each sensor needs.  */
+          else if (strcmp (long_options[option_index].name, "fixed-wait") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->fixed_wait_flag), 0, &(args_info->fixed_wait_given),
+                &(local_args_info.fixed_wait_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "fixed-wait", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          
+          break;
         case '?':	/* Invalid option.  */
           /* `getopt_long' already printed an error message.  */
           goto failure;
@@ -47,23 +47,105 @@ struct gengetopt_args_info
   char * log_arg;	/**< @brief Log data to log file.  */
   char * log_orig;	/**< @brief Log data to log file original value given at command line.  */
   const char *log_help; /**< @brief Log data to log file help description.  */
+  int log_window_arg;	/**< @brief Collect log lines for given amount of milliseconds and write them to the log file at once, 0 to write once per cycle (default='0').  */
+  char * log_window_orig;	/**< @brief Collect log lines for given amount of milliseconds and write them to the log file at once, 0 to write once per cycle original value given at command line.  */
+  const char *log_window_help; /**< @brief Collect log lines for given amount of milliseconds and write them to the log file at once, 0 to write once per cycle help description.  */
+  int log_buffer_arg;	/**< @brief Size of the log buffer, lines are written earlier when it is full (default='65536').  */
+  char * log_buffer_orig;	/**< @brief Size of the log buffer, lines are written earlier when it is full original value given at command line.  */
+  const char *log_buffer_help; /**< @brief Size of the log buffer, lines are written earlier when it is full help description.  */
+  char * log_sync_arg;	/**< @brief Durability of the log file: none, batch (fdatasync after every write) or line (write and fdatasync every line) (default='none').  */
+  char * log_sync_orig;	/**< @brief Durability of the log file: none, batch (fdatasync after every write) or line (write and fdatasync every line) original value given at command line.  */
+  const char *log_sync_help; /**< @brief Durability of the log file: none, batch (fdatasync after every write) or line (write and fdatasync every line) help description.  */
   char * out_arg;	/**< @brief Output results to a file instead of printing it on screen, can be used for creating a status file which always has latest measurments.  */
   char * out_orig;	/**< @brief Output results to a file instead of printing it on screen, can be used for creating a status file which always has latest measurments original value given at command line.  */
   const char *out_help; /**< @brief Output results to a file instead of printing it on screen, can be used for creating a status file which always has latest measurments help description.  */
-  int repeat_arg;	/**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode, 0 for no repeat (default='0').  */
-  char * repeat_orig;	/**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode, 0 for no repeat original value given at command line.  */
-  const char *repeat_help; /**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode, 0 for no repeat help description.  */
+  int repeat_arg;	/**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode when usb hotplug is not supported, 0 for no repeat (default='0').  */
+  char * repeat_orig;	/**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode when usb hotplug is not supported, 0 for no repeat original value given at command line.  */
+  const char *repeat_help; /**< @brief Constantly print results, repeat every given amount of seconds, devices will be reopened every 1 hour in this mode when usb hotplug is not supported, 0 for no repeat help description.  */
+  int interval_arg;	/**< @brief Constantly print results, repeat every given amount of milliseconds on a grid aligned to the wall clock, overrides --repeat.  */
+  char * interval_orig;	/**< @brief Constantly print results, repeat every given amount of milliseconds on a grid aligned to the wall clock, overrides --repeat original value given at command line.  */
+  const char *interval_help; /**< @brief Constantly print results, repeat every given amount of milliseconds on a grid aligned to the wall clock, overrides --repeat help description.  */
+  char * device_interval_arg;	/**< @brief Read some devices at their own interval, comma separated list of port=milliseconds or bus:device=milliseconds, 4ex. 1-1.4=2000,001:005=300000.  */
+  char * device_interval_orig;	/**< @brief Read some devices at their own interval, comma separated list of port=milliseconds or bus:device=milliseconds, 4ex. 1-1.4=2000,001:005=300000 original value given at command line.  */
+  const char *device_interval_help; /**< @brief Read some devices at their own interval, comma separated list of port=milliseconds or bus:device=milliseconds, 4ex. 1-1.4=2000,001:005=300000 help description.  */
+  char * shm_arg;	/**< @brief Publish latest readings in a POSIX shared memory table for local readers, 4ex. /temper-hum-hid.  */
+  char * shm_orig;	/**< @brief Publish latest readings in a POSIX shared memory table for local readers, 4ex. /temper-hum-hid original value given at command line.  */
+  const char *shm_help; /**< @brief Publish latest readings in a POSIX shared memory table for local readers, 4ex. /temper-hum-hid help description.  */
+  int metrics_port_arg;	/**< @brief Serve latest readings as Prometheus metrics on http://address:port/metrics.  */
+  char * metrics_port_orig;	/**< @brief Serve latest readings as Prometheus metrics on http://address:port/metrics original value given at command line.  */
+  const char *metrics_port_help; /**< @brief Serve latest readings as Prometheus metrics on http://address:port/metrics help description.  */
+  char * metrics_address_arg;	/**< @brief Address to serve metrics on (default='127.0.0.1').  */
+  char * metrics_address_orig;	/**< @brief Address to serve metrics on original value given at command line.  */
+  const char *metrics_address_help; /**< @brief Address to serve metrics on help description.  */
+  char * socket_arg;	/**< @brief Answer queries on a unix socket, with --client ask a running daemon instead of reading devices, 4ex. /run/temper-hum-hid.sock.  */
+  char * socket_orig;	/**< @brief Answer queries on a unix socket, with --client ask a running daemon instead of reading devices, 4ex. /run/temper-hum-hid.sock original value given at command line.  */
+  const char *socket_help; /**< @brief Answer queries on a unix socket, with --client ask a running daemon instead of reading devices, 4ex. /run/temper-hum-hid.sock help description.  */
+  int client_flag;	/**< @brief Get readings from the daemon listening on --socket, devices are read directly if there is no daemon (default=off).  */
+  const char *client_help; /**< @brief Get readings from the daemon listening on --socket, devices are read directly if there is no daemon help description.  */
+  int max_age_arg;	/**< @brief Readings of the daemon older than given amount of milliseconds are read again for --client (default='60000').  */
+  char * max_age_orig;	/**< @brief Readings of the daemon older than given amount of milliseconds are read again for --client original value given at command line.  */
+  const char *max_age_help; /**< @brief Readings of the daemon older than given amount of milliseconds are read again for --client help description.  */
+  char * simulate_arg;	/**< @brief Read simulated devices instead of usb ones, for testing without sensors, 4ex. devices=10,latency=1000,measure=400,timeout=0.01,garbage=0.01.  */
+  char * simulate_orig;	/**< @brief Read simulated devices instead of usb ones, for testing without sensors, 4ex. devices=10,latency=1000,measure=400,timeout=0.01,garbage=0.01 original value given at command line.  */
+  const char *simulate_help; /**< @brief Read simulated devices instead of usb ones, for testing without sensors, 4ex. devices=10,latency=1000,measure=400,timeout=0.01,garbage=0.01 help description.  */
+  char * capture_arg;	/**< @brief Record every usb transfer to a file for replaying it later.  */
+  char * capture_orig;	/**< @brief Record every usb transfer to a file for replaying it later original value given at command line.  */
+  const char *capture_help; /**< @brief Record every usb transfer to a file for replaying it later help description.  */
+  char * replay_arg;	/**< @brief Read devices recorded with --capture instead of usb ones.  */
+  char * replay_orig;	/**< @brief Read devices recorded with --capture instead of usb ones original value given at command line.  */
+  const char *replay_help; /**< @brief Read devices recorded with --capture instead of usb ones help description.  */
+  double replay_speed_arg;	/**< @brief How many times faster than recorded to replay, 0 to replay without waiting (default='1').  */
+  char * replay_speed_orig;	/**< @brief How many times faster than recorded to replay, 0 to replay without waiting original value given at command line.  */
+  const char *replay_speed_help; /**< @brief How many times faster than recorded to replay, 0 to replay without waiting help description.  */
+  char * archive_arg;	/**< @brief Keep a round robin archive of fixed size per device in given directory with raw readings of a day and averages, minimums and maximums of minutes for 30 days, hours for 2 years and days for 10 years.  */
+  char * archive_orig;	/**< @brief Keep a round robin archive of fixed size per device in given directory with raw readings of a day and averages, minimums and maximums of minutes for 30 days, hours for 2 years and days for 10 years original value given at command line.  */
+  const char *archive_help; /**< @brief Keep a round robin archive of fixed size per device in given directory with raw readings of a day and averages, minimums and maximums of minutes for 30 days, hours for 2 years and days for 10 years help description.  */
+  char * store_arg;	/**< @brief Store every reading compressed in a file per device in given directory, a few bytes per reading instead of a log line.  */
+  char * store_orig;	/**< @brief Store every reading compressed in a file per device in given directory, a few bytes per reading instead of a log line original value given at command line.  */
+  const char *store_help; /**< @brief Store every reading compressed in a file per device in given directory, a few bytes per reading instead of a log line help description.  */
+  int store_chunk_arg;	/**< @brief Readings kept in memory before they are compressed and written to --store at once, they are lost if the daemon is killed (default='1024').  */
+  char * store_chunk_orig;	/**< @brief Readings kept in memory before they are compressed and written to --store at once, they are lost if the daemon is killed original value given at command line.  */
+  const char *store_chunk_help; /**< @brief Readings kept in memory before they are compressed and written to --store at once, they are lost if the daemon is killed help description.  */
+  int store_age_arg;	/**< @brief Readings kept in memory are written to --store once the oldest of them is older than given amount of seconds even if there are less than --store-chunk, this bounds the readings lost if the daemon is killed, 0 to write full chunks only (default='3600').  */
+  char * store_age_orig;	/**< @brief Readings kept in memory are written to --store once the oldest of them is older than given amount of seconds even if there are less than --store-chunk, this bounds the readings lost if the daemon is killed, 0 to write full chunks only original value given at command line.  */
+  const char *store_age_help; /**< @brief Readings kept in memory are written to --store once the oldest of them is older than given amount of seconds even if there are less than --store-chunk, this bounds the readings lost if the daemon is killed, 0 to write full chunks only help description.  */
+  char * history_arg;	/**< @brief Print readings of a device in --store aggregated over steps of a range of time and exit, 4ex. device=1-1.4-i1,last=30d,step=1h or device=1-1.4-i1,from=2014-05-01,to=2014-05-13T12:00,step=5m.  */
+  char * history_orig;	/**< @brief Print readings of a device in --store aggregated over steps of a range of time and exit, 4ex. device=1-1.4-i1,last=30d,step=1h or device=1-1.4-i1,from=2014-05-01,to=2014-05-13T12:00,step=5m original value given at command line.  */
+  const char *history_help; /**< @brief Print readings of a device in --store aggregated over steps of a range of time and exit, 4ex. device=1-1.4-i1,last=30d,step=1h or device=1-1.4-i1,from=2014-05-01,to=2014-05-13T12:00,step=5m help description.  */
   int machine_flag;	/**< @brief Output in machine-friendly format, which is easier to be parsed by bash scripts for later use in monitoring tools, 4ex. Zabbix (default=off).  */
   const char *machine_help; /**< @brief Output in machine-friendly format, which is easier to be parsed by bash scripts for later use in monitoring tools, 4ex. Zabbix help description.  */
+  int fixed_wait_flag;	/**< @brief Always wait 400ms for sensors to finish measuring instead of learning the time each sensor needs (default=off).  */
+  const char *fixed_wait_help; /**< @brief Always wait 400ms for sensors to finish measuring instead of learning the time each sensor needs help description.  */
   
   unsigned int help_given ;	/**< @brief Whether help was given.  */
   unsigned int version_given ;	/**< @brief Whether version was given.  */
   unsigned int verbose_given ;	/**< @brief Whether verbose was given.  */
   unsigned int syslog_given ;	/**< @brief Whether syslog was given.  */
   unsigned int log_given ;	/**< @brief Whether log was given.  */
+  unsigned int log_window_given ;	/**< @brief Whether log-window was given.  */
+  unsigned int log_buffer_given ;	/**< @brief Whether log-buffer was given.  */
+  unsigned int log_sync_given ;	/**< @brief Whether log-sync was given.  */
   unsigned int out_given ;	/**< @brief Whether out was given.  */
   unsigned int repeat_given ;	/**< @brief Whether repeat was given.  */
+  unsigned int interval_given ;	/**< @brief Whether interval was given.  */
+  unsigned int device_interval_given ;	/**< @brief Whether device-interval was given.  */
+  unsigned int shm_given ;	/**< @brief Whether shm was given.  */
+  unsigned int metrics_port_given ;	/**< @brief Whether metrics-port was given.  */
+  unsigned int metrics_address_given ;	/**< @brief Whether metrics-address was given.  */
+  unsigned int socket_given ;	/**< @brief Whether socket was given.  */
+  unsigned int client_given ;	/**< @brief Whether client was given.  */
+  unsigned int max_age_given ;	/**< @brief Whether max-age was given.  */
+  unsigned int simulate_given ;	/**< @brief Whether simulate was given.  */
+  unsigned int capture_given ;	/**< @brief Whether capture was given.  */
+  unsigned int replay_given ;	/**< @brief Whether replay was given.  */
+  unsigned int replay_speed_given ;	/**< @brief Whether replay-speed was given.  */
+  unsigned int archive_given ;	/**< @brief Whether archive was given.  */
+  unsigned int store_given ;	/**< @brief Whether store was given.  */
+  unsigned int store_chunk_given ;	/**< @brief Whether store-chunk was given.  */
+  unsigned int store_age_given ;	/**< @brief Whether store-age was given.  */
+  unsigned int history_given ;	/**< @brief Whether history was given.  */
   unsigned int machine_given ;	/**< @brief Whether machine was given.  */
+  unsigned int fixed_wait_given ;	/**< @brief Whether fixed-wait was given.  */
 
 } ;
 
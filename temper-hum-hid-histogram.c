@@ -0,0 +1,147 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Values below 32 have a bucket each. Above, the highest set bit picks the
+ * power of 2 and the 4 bits below it the bucket within, so recording a value
+ * is a count of leading zeros and an increment.
+ */
+
+#include <string.h>
+#include "temper-hum-hid-histogram.h"
+
+/**
+ * Bucket of a value
+ */
+static inline int temperhum_histogram_bucket(uint32_t value)
+{
+	if (value < 2 * TEMPERHUM_HISTOGRAM_SUB_BUCKETS) {
+		return value;
+	}
+
+	int exponent = 31 - __builtin_clz(value);
+	int shift = exponent - TEMPERHUM_HISTOGRAM_SUB_BITS;
+
+	return (shift + 1) * TEMPERHUM_HISTOGRAM_SUB_BUCKETS + ((value >> shift) & (TEMPERHUM_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/**
+ * Adds a value, negative ones count as 0 and those above 32 bits as the largest
+ */
+void temperhum_histogram_record(struct temperhum_histogram * histogram, int64_t value)
+{
+	uint32_t clamped = value < 0 ? 0 : value > UINT32_MAX ? UINT32_MAX : value;
+
+	if (!histogram->count || clamped < histogram->min) {
+		histogram->min = clamped;
+	}
+	if (clamped > histogram->max) {
+		histogram->max = clamped;
+	}
+	histogram->count++;
+	histogram->sum += clamped;
+	histogram->bucket[temperhum_histogram_bucket(clamped)]++;
+}
+
+/**
+ * Largest value of a bucket
+ */
+uint32_t temperhum_histogram_value(int bucket)
+{
+	if (bucket < 2 * TEMPERHUM_HISTOGRAM_SUB_BUCKETS) {
+		return bucket;
+	}
+
+	int shift = bucket / TEMPERHUM_HISTOGRAM_SUB_BUCKETS - 1;
+	uint64_t lowest = (uint64_t) (TEMPERHUM_HISTOGRAM_SUB_BUCKETS + bucket % TEMPERHUM_HISTOGRAM_SUB_BUCKETS) << shift;
+
+	return lowest + ((uint64_t) 1 << shift) - 1;
+}
+
+/**
+ * Value not exceeded by given percent of the recorded ones, the largest
+ * value of its bucket but never more than the largest one recorded
+ */
+uint32_t temperhum_histogram_percentile(const struct temperhum_histogram * histogram, double percentile)
+{
+	uint64_t rank = percentile / 100 * histogram->count + 0.5, seen = 0;
+	int i;
+
+	if (!histogram->count) {
+		return 0;
+	}
+	if (rank < 1) {
+		rank = 1;
+	}
+	for (i = 0; i < TEMPERHUM_HISTOGRAM_BUCKETS; i++) {
+		seen += histogram->bucket[i];
+		if (seen >= rank) {
+			uint32_t value = temperhum_histogram_value(i);
+			return value < histogram->max ? value : histogram->max;
+		}
+	}
+
+	return histogram->max;
+}
+
+/**
+ * Takes the percentiles exported with samples in a single pass
+ */
+void temperhum_histogram_summarize(const struct temperhum_histogram * histogram, struct temperhum_histogram_summary * summary)
+{
+	static const double percentiles[3] = {50, 90, 99};
+	uint32_t *values[3] = {&summary->p50, &summary->p90, &summary->p99};
+	uint64_t seen = 0;
+	int i, p = 0;
+
+	memset(summary, 0, sizeof(struct temperhum_histogram_summary));
+	if (!histogram->count) {
+		return;
+	}
+	summary->count = histogram->count;
+	summary->max = histogram->max;
+
+	for (i = 0; i < TEMPERHUM_HISTOGRAM_BUCKETS && p < 3; i++) {
+		seen += histogram->bucket[i];
+		while (p < 3) {
+			uint64_t rank = percentiles[p] / 100 * histogram->count + 0.5;
+			if (seen < (rank < 1 ? 1 : rank)) {
+				break;
+			}
+			uint32_t value = temperhum_histogram_value(i);
+			*values[p++] = value < histogram->max ? value : histogram->max;
+		}
+	}
+}
+
+/**
+ * Writes count, mean and percentiles, then every bucket in use with its
+ * largest value and the share of values up to it. Lines start with prefix.
+ */
+void temperhum_histogram_print(const struct temperhum_histogram * histogram, FILE * output, const char * prefix)
+{
+	uint64_t seen = 0;
+	int i;
+
+	fprintf(
+		output,
+		"%s count: %llu, min: %u, mean: %.0f, p50: %u, p90: %u, p99: %u, p99.9: %u, max: %u\n",
+		prefix,
+		(unsigned long long) histogram->count,
+		histogram->min,
+		histogram->count ? (double) histogram->sum / histogram->count : 0,
+		temperhum_histogram_percentile(histogram, 50),
+		temperhum_histogram_percentile(histogram, 90),
+		temperhum_histogram_percentile(histogram, 99),
+		temperhum_histogram_percentile(histogram, 99.9),
+		histogram->max
+	);
+	for (i = 0; i < TEMPERHUM_HISTOGRAM_BUCKETS; i++) {
+		if (!histogram->bucket[i]) {
+			continue;
+		}
+		seen += histogram->bucket[i];
+		fprintf(output, "%s %10u %10u %8.4f\n", prefix, temperhum_histogram_value(i), histogram->bucket[i], (double) seen / histogram->count);
+	}
+}
@@ -0,0 +1,53 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Latency histogram in the manner of HdrHistogram: buckets are linear within
+ * every power of 2, so every recorded value is kept with the same relative
+ * precision from 1 us to over an hour in a fixed amount of memory
+ */
+
+#ifndef TEMPER_HUM_HID_HISTOGRAM
+#define TEMPER_HUM_HID_HISTOGRAM
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define TEMPERHUM_HISTOGRAM_SUB_BITS 4 /** 16 buckets per power of 2, values are off by less than 1/16 */
+#define TEMPERHUM_HISTOGRAM_SUB_BUCKETS (1 << TEMPERHUM_HISTOGRAM_SUB_BITS)
+#define TEMPERHUM_HISTOGRAM_BUCKETS ((32 - TEMPERHUM_HISTOGRAM_SUB_BITS + 1) * TEMPERHUM_HISTOGRAM_SUB_BUCKETS)
+
+struct temperhum_histogram {
+	uint64_t count;
+	uint64_t sum; /** of all values, for the mean */
+	uint32_t min;
+	uint32_t max;
+	uint32_t bucket[TEMPERHUM_HISTOGRAM_BUCKETS];
+};
+
+/**
+ * Percentiles of a histogram as exported with a sample, 0 if nothing was recorded
+ */
+struct temperhum_histogram_summary {
+	uint64_t count;
+	uint32_t p50;
+	uint32_t p90;
+	uint32_t p99;
+	uint32_t max;
+};
+
+void temperhum_histogram_record(struct temperhum_histogram * histogram, int64_t value);
+uint32_t temperhum_histogram_value(int bucket);
+uint32_t temperhum_histogram_percentile(const struct temperhum_histogram * histogram, double percentile);
+void temperhum_histogram_summarize(const struct temperhum_histogram * histogram, struct temperhum_histogram_summary * summary);
+void temperhum_histogram_print(const struct temperhum_histogram * histogram, FILE * output, const char * prefix);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_HISTOGRAM */
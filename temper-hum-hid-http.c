@@ -0,0 +1,239 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-http.h"
+
+#define TEMPERHUM_HTTP_REQUEST_LENGTH 2048
+#define TEMPERHUM_HTTP_TIMEOUT 2 /** seconds a client may take to send a request or read the answer */
+
+/**
+ * Rendered response, never changed once published. Requests being served
+ * keep a reference, so a new snapshot never waits for slow clients.
+ */
+struct temperhum_http_snapshot {
+	atomic_int references;
+	size_t length;
+	char body[];
+};
+
+static pthread_mutex_t temperhum_http_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct temperhum_http_snapshot *temperhum_http_current = NULL;
+static atomic_ulong temperhum_http_served;
+static int temperhum_http_socket = -1;
+
+/**
+ * Drops a reference to a snapshot
+ */
+static void temperhum_http_release(struct temperhum_http_snapshot *snapshot)
+{
+	if (snapshot && atomic_fetch_sub(&snapshot->references, 1) == 1) {
+		free(snapshot);
+	}
+}
+
+/**
+ * Takes a reference to the current snapshot
+ */
+static struct temperhum_http_snapshot *temperhum_http_acquire()
+{
+	pthread_mutex_lock(&temperhum_http_lock);
+	struct temperhum_http_snapshot *snapshot = temperhum_http_current;
+	if (snapshot) {
+		atomic_fetch_add(&snapshot->references, 1);
+	}
+	pthread_mutex_unlock(&temperhum_http_lock);
+
+	return snapshot;
+}
+
+/**
+ * Publishes a new metrics body, requests which arrive later get it
+ */
+int temperhum_http_update(const char * body, size_t length)
+{
+	struct temperhum_http_snapshot *snapshot = malloc(sizeof(struct temperhum_http_snapshot) + length);
+	if (!snapshot) {
+		return -1;
+	}
+	atomic_init(&snapshot->references, 1);
+	snapshot->length = length;
+	memcpy(snapshot->body, body, length);
+
+	pthread_mutex_lock(&temperhum_http_lock);
+	struct temperhum_http_snapshot *old = temperhum_http_current;
+	temperhum_http_current = snapshot;
+	pthread_mutex_unlock(&temperhum_http_lock);
+
+	temperhum_http_release(old);
+
+	return 0;
+}
+
+/**
+ * Amount of requests served since start
+ */
+unsigned long temperhum_http_requests()
+{
+	return atomic_load(&temperhum_http_served);
+}
+
+/**
+ * Sends a whole buffer, returns -1 if the client went away
+ */
+static int temperhum_http_send(int client, const char *data, size_t length)
+{
+	while (length) {
+		ssize_t sent = send(client, data, length, MSG_NOSIGNAL);
+		if (sent < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+		data += sent;
+		length -= sent;
+	}
+
+	return 0;
+}
+
+/**
+ * Answers a single request, only GET /metrics is known
+ */
+static void temperhum_http_serve(int client)
+{
+	char request[TEMPERHUM_HTTP_REQUEST_LENGTH];
+	char header[256];
+	size_t received = 0;
+
+	// headers are read up to the empty line, the body of a GET is not expected
+	while (received < sizeof(request) - 1) {
+		ssize_t result = recv(client, request + received, sizeof(request) - 1 - received, 0);
+		if (result < 0 && errno == EINTR) {
+			continue;
+		}
+		if (result <= 0) {
+			return;
+		}
+		received += result;
+		request[received] = 0x00;
+		if (strstr(request, "\r\n\r\n") || strstr(request, "\n\n")) {
+			break;
+		}
+	}
+	request[received] = 0x00;
+
+	atomic_fetch_add(&temperhum_http_served, 1);
+
+	int head = !strncmp(request, "HEAD ", 5);
+	if (strncmp(request, "GET ", 4) && !head) {
+		const char *answer = "HTTP/1.0 405 Method Not Allowed\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+		temperhum_http_send(client, answer, strlen(answer));
+		return;
+	}
+
+	char *path = request + (head ? 5 : 4);
+	if (strncmp(path, "/metrics ", 9) && strncmp(path, "/metrics?", 9)) {
+		const char *answer = "HTTP/1.0 404 Not Found\r\nContent-Type: text/plain\r\nContent-Length: 10\r\nConnection: close\r\n\r\nNot Found\n";
+		temperhum_http_send(client, answer, strlen(answer));
+		return;
+	}
+
+	struct temperhum_http_snapshot *snapshot = temperhum_http_acquire();
+	size_t length = snapshot ? snapshot->length : 0;
+	int header_length = snprintf(
+		header,
+		sizeof(header),
+		"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+		length
+	);
+
+	if (temperhum_http_send(client, header, header_length) == 0 && length && !head) {
+		temperhum_http_send(client, snapshot->body, length);
+	}
+	temperhum_http_release(snapshot);
+}
+
+/**
+ * Accepts clients one by one, answering is a copy of a ready buffer
+ * so there is no need for more threads
+ */
+static void *temperhum_http_thread(void *arg)
+{
+	struct timeval timeout = {TEMPERHUM_HTTP_TIMEOUT, 0};
+
+	while (1) {
+		int client = accept(temperhum_http_socket, NULL, NULL);
+		if (client < 0) {
+			if (errno != EINTR && errno != ECONNABORTED) {
+				temperhum_error(0, "Cannot accept metrics client, error %i", errno);
+				sleep(1);
+			}
+			continue;
+		}
+
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+		temperhum_http_serve(client);
+		close(client);
+	}
+
+	return NULL;
+}
+
+/**
+ * Starts serving metrics on given address and port in a separate thread
+ */
+int temperhum_http_start(const char * address, int port)
+{
+	struct sockaddr_in listen_address;
+	pthread_t thread;
+	int yes = 1;
+
+	memset(&listen_address, 0, sizeof(listen_address));
+	listen_address.sin_family = AF_INET;
+	listen_address.sin_port = htons(port);
+	if (inet_pton(AF_INET, address, &listen_address.sin_addr) != 1) {
+		temperhum_error(0, "Wrong metrics address '%s'", address);
+		return -1;
+	}
+
+	temperhum_http_socket = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (temperhum_http_socket < 0) {
+		temperhum_error(0, "Cannot create metrics socket");
+		return -1;
+	}
+	setsockopt(temperhum_http_socket, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+	if (bind(temperhum_http_socket, (struct sockaddr *) &listen_address, sizeof(listen_address)) < 0 || listen(temperhum_http_socket, 16) < 0) {
+		temperhum_error(0, "Cannot listen for metrics on %s:%i", address, port);
+		close(temperhum_http_socket);
+		return -1;
+	}
+
+	if (pthread_create(&thread, NULL, temperhum_http_thread, NULL) != 0) {
+		temperhum_error(0, "Cannot start metrics thread");
+		close(temperhum_http_socket);
+		return -1;
+	}
+	pthread_detach(thread);
+
+	temperhum_debug("Serving metrics on http://%s:%i/metrics", address, port);
+
+	return 0;
+}
@@ -0,0 +1,23 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_HTTP
+#define TEMPER_HUM_HID_HTTP
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+
+int temperhum_http_start(const char * address, int port);
+int temperhum_http_update(const char * body, size_t length);
+unsigned long temperhum_http_requests();
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_HTTP */
@@ -0,0 +1,587 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Imports log files written with --log into a time series per device.
+ * The log is mapped into memory and parsed in windows, every window is
+ * split at line boundaries between threads, so memory use does not grow
+ * with the size of the log.
+ *
+ * Usage: temper-hum-hid-import [--threads=N] [--csv] [--output=directory] log...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "temper-hum-hid-series.h"
+
+#define TEMPERHUM_IMPORT_CHUNK (16 << 20) /** bytes of the log a thread parses per window */
+#define TEMPERHUM_IMPORT_THREADS 64
+#define TEMPERHUM_IMPORT_DEVICES 256
+
+/**
+ * Reading parsed from a log line together with the device it belongs to
+ */
+struct temperhum_import_reading {
+	struct temperhum_series_record record;
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+};
+
+/**
+ * Part of a window parsed by one thread
+ */
+struct temperhum_import_chunk {
+	const char *start;
+	const char *end;
+	struct temperhum_import_reading *readings;
+	size_t count;
+	size_t size;
+	unsigned long lines;
+	unsigned long skipped; /** lines which are not readings */
+	int failed; /** readings did not fit into memory, the chunk is incomplete */
+	char hour[13]; /** "YYYY-MM-DD HH" of the cached hour */
+	int64_t hour_start; /** seconds since the epoch the cached hour started */
+};
+
+/**
+ * Output file of a device
+ */
+struct temperhum_import_device {
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	FILE *file;
+	unsigned long records;
+};
+
+static struct temperhum_import_device temperhum_import_devices[TEMPERHUM_IMPORT_DEVICES];
+static int temperhum_import_device_count = 0;
+static const char *temperhum_import_output = ".";
+static int temperhum_import_csv = 0;
+
+/**
+ * Current monotonic time in seconds
+ */
+static double temperhum_import_now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Skips given text, fails if it is not there
+ */
+static int temperhum_import_expect(const char ** p, const char * end, const char * text, size_t length)
+{
+	if ((size_t) (end - *p) < length || memcmp(*p, text, length)) {
+		return -1;
+	}
+	*p += length;
+
+	return 0;
+}
+
+#define TEMPERHUM_IMPORT_EXPECT(p, end, text) temperhum_import_expect(p, end, text, sizeof(text) - 1)
+
+/**
+ * Parses a decimal integer, possibly negative
+ */
+static int temperhum_import_integer(const char ** p, const char * end, int * value)
+{
+	const char *c = *p;
+	int negative = 0, result = 0;
+
+	if (c < end && *c == '-') {
+		negative = 1;
+		c++;
+	}
+	if (c == end || *c < '0' || *c > '9') {
+		return -1;
+	}
+	for (; c < end && *c >= '0' && *c <= '9'; c++) {
+		result = result * 10 + (*c - '0');
+	}
+
+	*value = negative ? -result : result;
+	*p = c;
+
+	return 0;
+}
+
+/**
+ * Parses a number with 2 decimals as written by %.2f into hundredths,
+ * nan and inf become TEMPERHUM_SERIES_INVALID
+ */
+static int temperhum_import_centi(const char ** p, const char * end, int32_t * value)
+{
+	const char *c = *p;
+	int negative = 0, whole, fraction = 0, digits = 0;
+
+	if (c < end && *c == '-') {
+		negative = 1;
+		c++;
+	}
+	if (end - c >= 3 && (!memcmp(c, "nan", 3) || !memcmp(c, "inf", 3))) {
+		*value = TEMPERHUM_SERIES_INVALID;
+		*p = c + 3;
+		return 0;
+	}
+	if (temperhum_import_integer(&c, end, &whole) < 0 || c == end || *c != '.') {
+		return -1;
+	}
+	for (c++; c < end && *c >= '0' && *c <= '9'; c++, digits++) {
+		if (digits < 2) {
+			fraction = fraction * 10 + (*c - '0');
+		}
+	}
+	if (digits == 1) {
+		fraction *= 10;
+	} else if (!digits) {
+		return -1;
+	}
+
+	*value = negative ? -(whole * 100 + fraction) : whole * 100 + fraction;
+	*p = c;
+
+	return 0;
+}
+
+/**
+ * Parses 2 digits
+ */
+static inline int temperhum_import_digits(const char * c)
+{
+	return (c[0] - '0') * 10 + (c[1] - '0');
+}
+
+/**
+ * Seconds since the epoch of a "[YYYY-MM-DD HH:MM:SS]" log time, which is local
+ * time. mktime() is only asked once per hour, as daylight saving time changes
+ * at full hours.
+ */
+static int temperhum_import_time(struct temperhum_import_chunk * chunk, const char * c, int64_t * timestamp)
+{
+	static const char pattern[] = "[0000-00-00 00:00:00]";
+	int i;
+
+	for (i = 0; i < (int) sizeof(pattern) - 1; i++) {
+		if (pattern[i] == '0' ? c[i] < '0' || c[i] > '9' : c[i] != pattern[i]) {
+			return -1;
+		}
+	}
+
+	if (memcmp(chunk->hour, c + 1, 13)) {
+		struct tm tm;
+		memset(&tm, 0, sizeof(tm));
+		tm.tm_year = temperhum_import_digits(c + 1) * 100 + temperhum_import_digits(c + 3) - 1900;
+		tm.tm_mon = temperhum_import_digits(c + 6) - 1;
+		tm.tm_mday = temperhum_import_digits(c + 9);
+		tm.tm_hour = temperhum_import_digits(c + 12);
+		tm.tm_isdst = -1;
+		chunk->hour_start = mktime(&tm);
+		memcpy(chunk->hour, c + 1, 13);
+	}
+
+	*timestamp = chunk->hour_start + temperhum_import_digits(c + 15) * 60 + temperhum_import_digits(c + 18);
+
+	return 0;
+}
+
+/**
+ * Parses a log line without its newline:
+ * [2014-01-01 12:00:00] TemperHum 001:005-i1/driver: 1; voltage: 3.5; temperature: 21.47 (6187, {0x18, 0x2B}) @ 14bit; humidity: 43.12 (1398, {0x05, 0x76}) @ 12bit; dew point: 8.37
+ */
+static int temperhum_import_line(struct temperhum_import_chunk * chunk, const char * p, const char * end, struct temperhum_import_reading * reading)
+{
+	int value, bus, device, interface, raw_temperature, raw_humidity;
+
+	if (end - p < 21 || temperhum_import_time(chunk, p, &reading->record.timestamp) < 0) {
+		return -1;
+	}
+	p += 21;
+
+	if (
+		TEMPERHUM_IMPORT_EXPECT(&p, end, " TemperHum ") < 0
+		|| temperhum_import_integer(&p, end, &bus) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, ":") < 0
+		|| temperhum_import_integer(&p, end, &device) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, "-i") < 0
+		|| temperhum_import_integer(&p, end, &interface) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, "/driver: ") < 0
+		|| temperhum_import_integer(&p, end, &value) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, "; voltage: ") < 0
+	) {
+		return -1;
+	}
+
+	// voltage is not kept, it is part of the calibration
+	while (p < end && *p != ';') {
+		p++;
+	}
+
+	if (
+		TEMPERHUM_IMPORT_EXPECT(&p, end, "; temperature: ") < 0
+		|| temperhum_import_centi(&p, end, &reading->record.temperature) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, " (") < 0
+		|| temperhum_import_integer(&p, end, &raw_temperature) < 0
+	) {
+		return -1;
+	}
+
+	// raw bytes and resolution repeat what is known already
+	while (p < end && *p != ';') {
+		p++;
+	}
+
+	if (
+		TEMPERHUM_IMPORT_EXPECT(&p, end, "; humidity: ") < 0
+		|| temperhum_import_centi(&p, end, &reading->record.humidity) < 0
+		|| TEMPERHUM_IMPORT_EXPECT(&p, end, " (") < 0
+		|| temperhum_import_integer(&p, end, &raw_humidity) < 0
+	) {
+		return -1;
+	}
+
+	while (p < end && *p != ';') {
+		p++;
+	}
+
+	if (
+		TEMPERHUM_IMPORT_EXPECT(&p, end, "; dew point: ") < 0
+		|| temperhum_import_centi(&p, end, &reading->record.dew_point) < 0
+	) {
+		return -1;
+	}
+
+	reading->record.raw_temperature = raw_temperature;
+	reading->record.raw_humidity = raw_humidity;
+	reading->bus_number = bus;
+	reading->device_number = device;
+	reading->interface_number = interface;
+
+	return 0;
+}
+
+/**
+ * Parses every line of a chunk into its readings
+ */
+static void *temperhum_import_thread(void * argument)
+{
+	struct temperhum_import_chunk *chunk = argument;
+	const char *line = chunk->start;
+
+	chunk->count = 0;
+	chunk->lines = 0;
+	chunk->skipped = 0;
+	chunk->failed = 0;
+
+	while (line < chunk->end) {
+		const char *end = memchr(line, '\n', chunk->end - line);
+		if (!end) {
+			end = chunk->end;
+		}
+
+		if (chunk->count == chunk->size) {
+			size_t size = chunk->size ? chunk->size * 2 : 65536;
+			struct temperhum_import_reading *readings = realloc(chunk->readings, size * sizeof(struct temperhum_import_reading));
+			if (!readings) {
+				chunk->failed = 1;
+				break;
+			}
+			chunk->readings = readings;
+			chunk->size = size;
+		}
+
+		chunk->lines++;
+		if (temperhum_import_line(chunk, line, end, &chunk->readings[chunk->count]) == 0) {
+			chunk->count++;
+		} else {
+			chunk->skipped++;
+		}
+		line = end + 1;
+	}
+
+	return NULL;
+}
+
+/**
+ * Output of a device, opened when the device is first seen
+ */
+static struct temperhum_import_device *temperhum_import_device(const struct temperhum_import_reading * reading)
+{
+	int i;
+
+	for (i = 0; i < temperhum_import_device_count; i++) {
+		struct temperhum_import_device *device = &temperhum_import_devices[i];
+		if (device->bus_number == reading->bus_number && device->device_number == reading->device_number && device->interface_number == reading->interface_number) {
+			return device;
+		}
+	}
+	if (temperhum_import_device_count == TEMPERHUM_IMPORT_DEVICES) {
+		return NULL;
+	}
+
+	struct temperhum_import_device *device = &temperhum_import_devices[temperhum_import_device_count];
+	char path[4096];
+	snprintf(
+		path,
+		sizeof(path),
+		"%s/%03u-%03u-i%u.%s",
+		temperhum_import_output,
+		reading->bus_number,
+		reading->device_number,
+		reading->interface_number,
+		temperhum_import_csv ? "csv" : "thts"
+	);
+
+	device->file = fopen(path, "wb");
+	if (!device->file) {
+		fprintf(stderr, "Error: Cannot open '%s' for writing: %s\n", path, strerror(errno));
+		return NULL;
+	}
+	setvbuf(device->file, NULL, _IOFBF, 1 << 20);
+	device->bus_number = reading->bus_number;
+	device->device_number = reading->device_number;
+	device->interface_number = reading->interface_number;
+	device->records = 0;
+	temperhum_import_device_count++;
+
+	if (temperhum_import_csv) {
+		fputs("timestamp,temperature,humidity,dew_point,raw_temperature,raw_humidity\n", device->file);
+	} else {
+		struct temperhum_series_header header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, TEMPERHUM_SERIES_MAGIC, 4);
+		header.version = TEMPERHUM_SERIES_VERSION;
+		header.bus_number = device->bus_number;
+		header.device_number = device->device_number;
+		header.interface_number = device->interface_number;
+		fwrite(&header, sizeof(header), 1, device->file);
+	}
+
+	return device;
+}
+
+/**
+ * Writes hundredths as a number with 2 decimals, invalid values as nan
+ */
+static char *temperhum_import_format_centi(char * p, int32_t value)
+{
+	if (value == TEMPERHUM_SERIES_INVALID) {
+		memcpy(p, "nan", 3);
+		return p + 3;
+	}
+	if (value < 0) {
+		*p++ = '-';
+		value = -value;
+	}
+
+	return p + sprintf(p, "%d.%02d", value / 100, value % 100);
+}
+
+/**
+ * Appends readings of a window to the files of their devices, in log order
+ */
+static int temperhum_import_write(const struct temperhum_import_chunk * chunk)
+{
+	struct temperhum_import_device *device = NULL;
+	size_t i;
+
+	for (i = 0; i < chunk->count; i++) {
+		const struct temperhum_import_reading *reading = &chunk->readings[i];
+
+		// lines of one device mostly follow each other
+		if (!device || device->bus_number != reading->bus_number || device->device_number != reading->device_number || device->interface_number != reading->interface_number) {
+			device = temperhum_import_device(reading);
+			if (!device) {
+				return -1;
+			}
+		}
+
+		if (temperhum_import_csv) {
+			char line[128], *p = line;
+			p += sprintf(p, "%lld,", (long long) reading->record.timestamp);
+			p = temperhum_import_format_centi(p, reading->record.temperature);
+			*p++ = ',';
+			p = temperhum_import_format_centi(p, reading->record.humidity);
+			*p++ = ',';
+			p = temperhum_import_format_centi(p, reading->record.dew_point);
+			p += sprintf(p, ",%u,%u\n", reading->record.raw_temperature, reading->record.raw_humidity);
+			fwrite(line, p - line, 1, device->file);
+		} else {
+			fwrite(&reading->record, sizeof(reading->record), 1, device->file);
+		}
+		device->records++;
+	}
+
+	return 0;
+}
+
+/**
+ * Imports a log file using two sets of chunks, returns -1 on errors
+ */
+static int temperhum_import_file(const char * path, struct temperhum_import_chunk * chunks, int threads)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Error: Cannot open log file '%s': %s\n", path, strerror(errno));
+		return -1;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) < 0) {
+		close(fd);
+		return -1;
+	}
+	if (!status.st_size) {
+		close(fd);
+		return 0;
+	}
+
+	const char *data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "Error: Cannot map log file '%s': %s\n", path, strerror(errno));
+		return -1;
+	}
+	madvise((void *) data, status.st_size, MADV_SEQUENTIAL);
+
+	const char *position = data, *end = data + status.st_size;
+	unsigned long lines = 0, skipped = 0, records = 0;
+	double start = temperhum_import_now();
+	int result = 0, i;
+
+	struct temperhum_import_chunk *parsed = NULL;
+	int parsed_count = 0, window = 0;
+
+	while ((position < end || parsed_count) && !result) {
+		struct temperhum_import_chunk *current = chunks + window * TEMPERHUM_IMPORT_THREADS;
+		pthread_t thread[TEMPERHUM_IMPORT_THREADS];
+		int threaded[TEMPERHUM_IMPORT_THREADS];
+		int started = 0;
+
+		// every thread gets a chunk ending at a line boundary
+		for (i = 0; i < threads && position < end; i++) {
+			const char *chunk_end = end - position > TEMPERHUM_IMPORT_CHUNK ? position + TEMPERHUM_IMPORT_CHUNK : end;
+			if (chunk_end < end) {
+				const char *newline = memchr(chunk_end, '\n', end - chunk_end);
+				chunk_end = newline ? newline + 1 : end;
+			}
+			current[i].start = position;
+			current[i].end = chunk_end;
+			position = chunk_end;
+
+			threaded[i] = pthread_create(&thread[i], NULL, temperhum_import_thread, &current[i]) == 0;
+			started++;
+		}
+
+		// the previous window is written while this one is parsed
+		for (i = 0; i < parsed_count; i++) {
+			lines += parsed[i].lines;
+			skipped += parsed[i].skipped;
+			records += parsed[i].count;
+			if (!result && parsed[i].failed) {
+				fprintf(stderr, "Error: Cannot allocate memory for readings of log file '%s'\n", path);
+				result = -1;
+			}
+			if (!result && temperhum_import_write(&parsed[i]) < 0) {
+				result = -1;
+			}
+		}
+
+		for (i = 0; i < started; i++) {
+			if (threaded[i]) {
+				pthread_join(thread[i], NULL);
+			} else {
+				temperhum_import_thread(&current[i]);
+			}
+		}
+
+		// pages parsed already are not needed anymore
+		madvise((void *) data, position - data, MADV_DONTNEED);
+
+		parsed = current;
+		parsed_count = started;
+		window ^= 1;
+	}
+
+	double spent = temperhum_import_now() - start;
+	munmap((void *) data, status.st_size);
+
+	printf(
+		"%s: %.1f MB, %lu lines, %lu readings, %lu skipped in %.2f s, %.2f GB/s\n",
+		path,
+		status.st_size / 1e6,
+		lines,
+		records,
+		skipped,
+		spent,
+		spent > 0 ? status.st_size / spent / 1e9 : 0
+	);
+
+	return result;
+}
+
+/**
+ * Imports log files given on the command line
+ */
+int main(int argc, char *argv[])
+{
+	static struct temperhum_import_chunk chunks[2 * TEMPERHUM_IMPORT_THREADS];
+	int threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int i, files = 0, result = 0;
+
+	for (i = 1; i < argc && !strncmp(argv[i], "--", 2); i++) {
+		if (!strncmp(argv[i], "--threads=", 10)) {
+			threads = atoi(argv[i] + 10);
+		} else if (!strcmp(argv[i], "--csv")) {
+			temperhum_import_csv = 1;
+		} else if (!strncmp(argv[i], "--output=", 9)) {
+			temperhum_import_output = argv[i] + 9;
+		} else {
+			fprintf(stderr, "Error: Unknown option '%s'\n", argv[i]);
+			return 1;
+		}
+	}
+	if (i == argc) {
+		fprintf(stderr, "Usage: %s [--threads=N] [--csv] [--output=directory] log...\n", argv[0]);
+		return 1;
+	}
+	if (threads < 1) {
+		threads = 1;
+	}
+	if (threads > TEMPERHUM_IMPORT_THREADS) {
+		threads = TEMPERHUM_IMPORT_THREADS;
+	}
+
+	for (; i < argc; i++, files++) {
+		if (temperhum_import_file(argv[i], chunks, threads) < 0) {
+			result = 1;
+		}
+	}
+
+	for (i = 0; i < temperhum_import_device_count; i++) {
+		struct temperhum_import_device *device = &temperhum_import_devices[i];
+		printf("%03u:%03u-i%u: %lu readings\n", device->bus_number, device->device_number, device->interface_number, device->records);
+		if (fclose(device->file) != 0) {
+			result = 1;
+		}
+	}
+	for (i = 0; i < 2 * TEMPERHUM_IMPORT_THREADS; i++) {
+		free(chunks[i].readings);
+	}
+
+	return result;
+}
@@ -0,0 +1,221 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include "temper-hum-hid-log.h"
+
+/**
+ * Current monotonic time in milliseconds
+ */
+static int64_t temperhum_log_now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (int64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/**
+ * Converts a durability level name to TEMPERHUM_SYNC_*, returns -1 for unknown names
+ */
+int temperhum_log_parse_sync(const char * name)
+{
+	if (!strcmp(name, "none")) {
+		return TEMPERHUM_SYNC_NONE;
+	}
+	if (!strcmp(name, "batch")) {
+		return TEMPERHUM_SYNC_BATCH;
+	}
+	if (!strcmp(name, "line")) {
+		return TEMPERHUM_SYNC_LINE;
+	}
+
+	return -1;
+}
+
+/**
+ * Opens a log file for appending
+ */
+int temperhum_log_open(struct temperhum_log * log, const char * path, size_t size, int window, int sync)
+{
+	memset(log, 0, sizeof(struct temperhum_log));
+	log->fd = -1;
+	log->size = size;
+	log->window = window;
+	log->sync = sync;
+
+	log->path = strdup(path);
+	log->buffer = malloc(size);
+	if (!log->path || !log->buffer) {
+		temperhum_log_close(log);
+		return -1;
+	}
+
+	return temperhum_log_reopen(log);
+}
+
+/**
+ * Reopens the log file, 4ex. after it was rotated. Buffered lines are kept.
+ */
+int temperhum_log_reopen(struct temperhum_log * log)
+{
+	if (log->fd >= 0) {
+		close(log->fd);
+	}
+
+	log->fd = open(log->path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+
+	return log->fd < 0 ? -1 : 0;
+}
+
+/**
+ * Backs off after a failed write, the wait is doubled with every failure in a row
+ */
+static int temperhum_log_failed(struct temperhum_log * log)
+{
+	if (!log->retry) {
+		log->retry = log->window > TEMPERHUM_LOG_RETRY_MIN ? log->window : TEMPERHUM_LOG_RETRY_MIN;
+	} else if (log->retry < TEMPERHUM_LOG_RETRY_MAX / 2) {
+		log->retry *= 2;
+	} else {
+		log->retry = TEMPERHUM_LOG_RETRY_MAX;
+	}
+	log->retry_at = temperhum_log_now() + log->retry;
+	log->failures++;
+
+	return -1;
+}
+
+/**
+ * Writes all buffered lines with a single write, returns -1 on failure,
+ * in which case lines stay in the buffer
+ */
+int temperhum_log_flush(struct temperhum_log * log)
+{
+	size_t written = 0;
+
+	if (!log->used) {
+		return 0;
+	}
+	if (log->fd < 0) {
+		return temperhum_log_failed(log);
+	}
+
+	while (written < log->used) {
+		ssize_t result = write(log->fd, log->buffer + written, log->used - written);
+		log->writes++;
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			memmove(log->buffer, log->buffer + written, log->used - written);
+			log->used -= written;
+			return temperhum_log_failed(log);
+		}
+		written += result;
+	}
+	log->used = 0;
+
+	if (log->sync != TEMPERHUM_SYNC_NONE) {
+		log->syncs++;
+		if (fdatasync(log->fd) < 0) {
+			return temperhum_log_failed(log);
+		}
+	}
+	log->retry = 0;
+
+	return 0;
+}
+
+/**
+ * Adds a line to the batch. The batch is written first if the line
+ * does not fit, with TEMPERHUM_SYNC_LINE the line is written at once.
+ */
+int temperhum_log_append(struct temperhum_log * log, const char * line, size_t length)
+{
+	int result = 0;
+
+	if (log->used + length > log->size) {
+		result = temperhum_log_flush(log);
+	}
+
+	if (log->used + length > log->size) {
+		// line is longer than the buffer or the file cannot be written, oldest lines are lost
+		if (length > log->size) {
+			length = log->size;
+		}
+		log->used = 0;
+	}
+
+	if (!log->used) {
+		log->first_line = temperhum_log_now();
+	}
+	memcpy(log->buffer + log->used, line, length);
+	log->used += length;
+	log->lines++;
+
+	if (log->sync == TEMPERHUM_SYNC_LINE) {
+		return temperhum_log_flush(log);
+	}
+
+	return result;
+}
+
+/**
+ * Called after a batch of lines was added, writes the buffer
+ * unless lines may still wait for the time window or a failed
+ * write is not to be retried yet
+ */
+int temperhum_log_commit(struct temperhum_log * log)
+{
+	int64_t now = temperhum_log_now();
+
+	if (!log->used || (log->window > 0 && now < log->first_line + log->window) || (log->retry && now < log->retry_at)) {
+		return 0;
+	}
+
+	return temperhum_log_flush(log);
+}
+
+/**
+ * Time in ms until buffered lines have to be written,
+ * -1 if the buffer is empty
+ */
+int temperhum_log_timeout(struct temperhum_log * log)
+{
+	if (!log->used) {
+		return -1;
+	}
+
+	int64_t due = log->first_line + log->window;
+	if (log->retry && log->retry_at > due) {
+		due = log->retry_at;
+	}
+	int64_t left = due - temperhum_log_now();
+
+	return left > 0 ? (int) left : 0;
+}
+
+/**
+ * Writes remaining lines and closes the log file
+ */
+void temperhum_log_close(struct temperhum_log * log)
+{
+	temperhum_log_flush(log);
+	if (log->fd >= 0) {
+		close(log->fd);
+	}
+	free(log->path);
+	free(log->buffer);
+	log->fd = -1;
+	log->path = NULL;
+	log->buffer = NULL;
+}
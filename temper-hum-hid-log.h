@@ -0,0 +1,55 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_LOG
+#define TEMPER_HUM_HID_LOG
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEMPERHUM_SYNC_NONE 0 /** leave writing to disk to the kernel */
+#define TEMPERHUM_SYNC_BATCH 1 /** fdatasync after every batch written */
+#define TEMPERHUM_SYNC_LINE 2 /** write and fdatasync every line */
+#define TEMPERHUM_LOG_RETRY_MIN 100 /** ms before the first retry of a failed write */
+#define TEMPERHUM_LOG_RETRY_MAX 60000 /** retries are doubled up to this many ms */
+
+/**
+ * Log file writer which collects lines and writes them with one system call
+ */
+struct temperhum_log {
+	int fd;
+	char *path;
+	char *buffer;
+	size_t size; /** batch is written once it would grow over this size */
+	size_t used;
+	int window; /** time in ms lines may wait in the buffer, 0 to write at every flush */
+	int sync; /** one of TEMPERHUM_SYNC_* */
+	int64_t first_line; /** monotonic time in ms the oldest buffered line was added */
+	unsigned long lines; /** lines added */
+	unsigned long writes; /** write system calls made */
+	unsigned long syncs; /** fdatasync system calls made */
+	unsigned long failures; /** writes or syncs which failed */
+	int retry; /** ms waited after the last failure, 0 while writes succeed */
+	int64_t retry_at; /** monotonic time in ms a failed write is tried again */
+};
+
+int temperhum_log_parse_sync(const char * name);
+int temperhum_log_open(struct temperhum_log * log, const char * path, size_t size, int window, int sync);
+int temperhum_log_append(struct temperhum_log * log, const char * line, size_t length);
+int temperhum_log_flush(struct temperhum_log * log);
+int temperhum_log_commit(struct temperhum_log * log);
+int temperhum_log_timeout(struct temperhum_log * log);
+int temperhum_log_reopen(struct temperhum_log * log);
+void temperhum_log_close(struct temperhum_log * log);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_LOG */
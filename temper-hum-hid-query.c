@@ -0,0 +1,331 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * The index of a store is searched for the first chunk of a range, chunks
+ * within a single bucket take their count, minimums, maximums and sums from
+ * the index and are not read at all. Chunks crossing an edge of a bucket take
+ * them from their aggregates per minute when the range starts and the step is
+ * a whole minute, steps shorter than a chunk (1024 readings are 17 minutes at
+ * 1 Hz) are answered without decoding as well. Only the remaining chunks are
+ * decoded, their values are aggregated a span of a bucket at a time, with an
+ * AVX2 kernel where the cpu supports it.
+ *
+ * Chunks are expected in the order of time, a clock set back makes the
+ * index search miss chunks written before the clock caught up again.
+ * Readings waiting in the memory of the daemon are not seen.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "temper-hum-hid-store.h"
+#include "temper-hum-hid-query.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEMPERHUM_QUERY_AVX2 1
+#include <immintrin.h>
+#else
+#define TEMPERHUM_QUERY_AVX2 0
+#endif
+
+static int temperhum_query_simd = -1;
+
+/**
+ * Maps a whole file for reading, flags are added to those of mmap(). Returns
+ * NULL if it cannot be read or is empty.
+ */
+static void *temperhum_query_map(const char * path, int flags, size_t * size)
+{
+	struct stat status;
+
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return NULL;
+	}
+	if (fstat(fd, &status) < 0 || !status.st_size) {
+		close(fd);
+		return NULL;
+	}
+
+	void *data = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED | flags, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return NULL;
+	}
+	*size = status.st_size;
+
+	return data;
+}
+
+/**
+ * Adds values to a minimum, a maximum and a sum
+ */
+static void temperhum_query_span_scalar(const double * values, int count, double * min, double * max, double * sum)
+{
+	double low = *min, high = *max, total = 0;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		low = values[i] < low ? values[i] : low;
+		high = values[i] > high ? values[i] : high;
+		total += values[i];
+	}
+	*min = low;
+	*max = high;
+	*sum += total;
+}
+
+#if TEMPERHUM_QUERY_AVX2
+/**
+ * temperhum_query_span_scalar() for 4 values at once, sums differ from the
+ * scalar ones in the order of additions only
+ */
+__attribute__((target("avx2")))
+static void temperhum_query_span_avx2(const double * values, int count, double * min, double * max, double * sum)
+{
+	__m256d low = _mm256_set1_pd(*min), high = _mm256_set1_pd(*max), total = _mm256_setzero_pd();
+	double lows[4], highs[4], totals[4];
+	int i;
+
+	for (i = 0; i + 4 <= count; i += 4) {
+		__m256d value = _mm256_loadu_pd(values + i);
+		low = _mm256_min_pd(low, value);
+		high = _mm256_max_pd(high, value);
+		total = _mm256_add_pd(total, value);
+	}
+	_mm256_storeu_pd(lows, low);
+	_mm256_storeu_pd(highs, high);
+	_mm256_storeu_pd(totals, total);
+
+	*min = fmin(fmin(lows[0], lows[1]), fmin(lows[2], lows[3]));
+	*max = fmax(fmax(highs[0], highs[1]), fmax(highs[2], highs[3]));
+	*sum += (totals[0] + totals[1]) + (totals[2] + totals[3]);
+
+	temperhum_query_span_scalar(values + i, count - i, min, max, sum);
+}
+#endif
+
+/**
+ * Adds values of a span of a bucket to it
+ */
+static inline void temperhum_query_span(struct temperhum_query_bucket * bucket, const double * const * values, int count)
+{
+	int v;
+
+	bucket->count += count;
+	for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+#if TEMPERHUM_QUERY_AVX2
+		if (temperhum_query_simd) {
+			temperhum_query_span_avx2(values[v], count, &bucket->min[v], &bucket->max[v], &bucket->mean[v]);
+			continue;
+		}
+#endif
+		temperhum_query_span_scalar(values[v], count, &bucket->min[v], &bucket->max[v], &bucket->mean[v]);
+	}
+}
+
+/**
+ * Aggregates readings of the store in given file from the from time to the to
+ * time (wall clock time in ms, to excluded) into buckets of step ms starting at
+ * from. Fills at most size buckets, also for steps without readings, and
+ * returns their amount or -1 if the store or its index cannot be read.
+ * stats may be NULL.
+ */
+int temperhum_query(const char * path, int64_t from, int64_t to, int64_t step, struct temperhum_query_bucket * buckets, int size, struct temperhum_query_stats * stats)
+{
+	struct temperhum_query_stats unused;
+	char index_path[4096], minutes_path[4096];
+	size_t store_size, index_size, minutes_size = 0;
+	int i, v;
+
+	if (!stats) {
+		stats = &unused;
+	}
+	memset(stats, 0, sizeof(struct temperhum_query_stats));
+	if (step <= 0 || to <= from || size <= 0) {
+		return 0;
+	}
+	if ((to - from - 1) / step >= size) {
+		to = from + size * step;
+	}
+	int count = (to - from - 1) / step + 1;
+
+#if TEMPERHUM_QUERY_AVX2
+	if (temperhum_query_simd < 0) {
+		__builtin_cpu_init();
+		temperhum_query_simd = __builtin_cpu_supports("avx2");
+	}
+#else
+	temperhum_query_simd = 0;
+#endif
+
+	if (snprintf(index_path, sizeof(index_path), "%s" TEMPERHUM_STORE_INDEX_SUFFIX, path) >= (int) sizeof(index_path)
+			|| snprintf(minutes_path, sizeof(minutes_path), "%s" TEMPERHUM_STORE_MINUTES_SUFFIX, path) >= (int) sizeof(minutes_path)) {
+		return -1;
+	}
+	const uint8_t *store = temperhum_query_map(path, 0, &store_size);
+	if (!store) {
+		return -1;
+	}
+	// every entry up to the end of the range is read, pages of the store only for decoded chunks
+	const uint8_t *index = temperhum_query_map(index_path, MAP_POPULATE, &index_size);
+	// an index of an older version is rebuilt once the daemon opens the store
+	if (!index || index_size < sizeof(struct temperhum_store_index_header) || memcmp(index, TEMPERHUM_STORE_INDEX_MAGIC, 4)
+			|| ((const struct temperhum_store_index_header *) index)->version != TEMPERHUM_STORE_INDEX_VERSION) {
+		if (index) {
+			munmap((void *) index, index_size);
+		}
+		munmap((void *) store, store_size);
+		return -1;
+	}
+	// chunks are decoded instead if there are no aggregates per minute
+	const uint8_t *minutes = temperhum_query_map(minutes_path, 0, &minutes_size);
+	int by_minute = minutes && from % TEMPERHUM_STORE_MINUTE == 0 && step % TEMPERHUM_STORE_MINUTE == 0;
+
+	for (i = 0; i < count; i++) {
+		struct temperhum_query_bucket *bucket = &buckets[i];
+		bucket->start = from + i * step;
+		bucket->count = 0;
+		for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+			bucket->min[v] = INFINITY;
+			bucket->max[v] = -INFINITY;
+			bucket->mean[v] = 0; // sum until all readings are added
+		}
+	}
+
+	const struct temperhum_store_index *entries = (const struct temperhum_store_index *) (index + sizeof(struct temperhum_store_index_header));
+	int entry_count = (index_size - sizeof(struct temperhum_store_index_header)) / sizeof(struct temperhum_store_index);
+
+	// first chunk ending in the range
+	int low = 0, high = entry_count;
+	while (low < high) {
+		int middle = low + (high - low) / 2;
+		if (entries[middle].last < from) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	int64_t *timestamps = NULL;
+	double *columns[TEMPERHUM_QUERY_VALUES] = {NULL, NULL};
+	uint32_t capacity = 0;
+
+	for (i = low; i < entry_count && entries[i].first < to; i++) {
+		const struct temperhum_store_index *entry = &entries[i];
+		struct temperhum_store_chunk chunk;
+
+		if (entry->last < from) {
+			continue;
+		}
+		// the index is ahead of a store cut by a crash until the daemon opens it again
+		if (entry->offset < (int64_t) sizeof(struct temperhum_store_header) || (uint64_t) entry->offset + sizeof(chunk) > store_size) {
+			break;
+		}
+		stats->chunks++;
+
+		int64_t first = (entry->first - from) / step;
+		if (entry->first >= from && entry->last < to && first == (entry->last - from) / step) {
+			struct temperhum_query_bucket *bucket = &buckets[first];
+			bucket->count += entry->count;
+			for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+				bucket->min[v] = entry->min[v] < bucket->min[v] ? entry->min[v] : bucket->min[v];
+				bucket->max[v] = entry->max[v] > bucket->max[v] ? entry->max[v] : bucket->max[v];
+				bucket->mean[v] += entry->sum[v];
+			}
+			continue;
+		}
+		// minutes crossing the end of the range would count readings after it
+		if (by_minute && entry->minutes && (entry->last < to || to % TEMPERHUM_STORE_MINUTE == 0)
+				&& entry->minute >= 0 && (uint64_t) entry->minute + entry->minutes * sizeof(struct temperhum_store_minute) <= minutes_size) {
+			const struct temperhum_store_minute *minute = (const struct temperhum_store_minute *) (minutes + entry->minute);
+			uint32_t j;
+
+			for (j = 0; j < entry->minutes; j++, minute++) {
+				if (minute->start < from || minute->start >= to) {
+					continue;
+				}
+				struct temperhum_query_bucket *bucket = &buckets[(minute->start - from) / step];
+				bucket->count += minute->count;
+				for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+					bucket->min[v] = minute->min[v] < bucket->min[v] ? minute->min[v] : bucket->min[v];
+					bucket->max[v] = minute->max[v] > bucket->max[v] ? minute->max[v] : bucket->max[v];
+					bucket->mean[v] += minute->sum[v];
+				}
+			}
+			stats->minutes++;
+			continue;
+		}
+
+		memcpy(&chunk, store + entry->offset, sizeof(chunk));
+		if (chunk.count != entry->count || (uint64_t) entry->offset + sizeof(chunk) + chunk.size > store_size) {
+			continue;
+		}
+		if (chunk.count > capacity) {
+			capacity = chunk.count;
+			free(timestamps);
+			timestamps = malloc(capacity * sizeof(int64_t));
+			for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+				free(columns[v]);
+				columns[v] = malloc(capacity * sizeof(double));
+			}
+			if (!timestamps || !columns[0] || !columns[1]) {
+				count = -1;
+				break;
+			}
+		}
+		if (temperhum_store_decode_columns(&chunk, store + entry->offset + sizeof(chunk), timestamps, columns[0], columns[1]) < 0) {
+			continue;
+		}
+		stats->decoded++;
+
+		// readings of a bucket are next to each other, they are added a span at a time
+		uint32_t j = 0;
+		while (j < chunk.count) {
+			if (timestamps[j] < from || timestamps[j] >= to) {
+				j++;
+				continue;
+			}
+			int64_t bucket = (timestamps[j] - from) / step;
+			int64_t start = from + bucket * step, end = start + step < to ? start + step : to;
+			uint32_t k = j + 1;
+			while (k < chunk.count && timestamps[k] >= start && timestamps[k] < end) {
+				k++;
+			}
+			const double *values[TEMPERHUM_QUERY_VALUES] = {columns[0] + j, columns[1] + j};
+			temperhum_query_span(&buckets[bucket], values, k - j);
+			j = k;
+		}
+	}
+
+	free(timestamps);
+	for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+		free(columns[v]);
+	}
+	if (minutes) {
+		munmap((void *) minutes, minutes_size);
+	}
+	munmap((void *) index, index_size);
+	munmap((void *) store, store_size);
+
+	for (i = 0; i < count; i++) {
+		struct temperhum_query_bucket *bucket = &buckets[i];
+		stats->readings += bucket->count;
+		for (v = 0; v < TEMPERHUM_QUERY_VALUES; v++) {
+			if (!bucket->count) {
+				bucket->min[v] = bucket->max[v] = bucket->mean[v] = NAN;
+				continue;
+			}
+			bucket->mean[v] /= bucket->count;
+		}
+	}
+
+	return count;
+}
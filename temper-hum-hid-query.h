@@ -0,0 +1,44 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Range queries over the store of a device: readings of a time range
+ * aggregated into buckets of a fixed step
+ */
+
+#ifndef TEMPER_HUM_HID_QUERY
+#define TEMPER_HUM_HID_QUERY
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#define TEMPERHUM_QUERY_VALUES 2 /** temperature, humidity */
+
+/**
+ * Readings of a step, values are NaN for buckets without readings
+ */
+struct temperhum_query_bucket {
+	int64_t start; /** wall clock time in ms the bucket starts */
+	uint32_t count;
+	double min[TEMPERHUM_QUERY_VALUES];
+	double max[TEMPERHUM_QUERY_VALUES];
+	double mean[TEMPERHUM_QUERY_VALUES];
+};
+
+struct temperhum_query_stats {
+	unsigned long chunks; /** overlapping the range */
+	unsigned long minutes; /** chunks answered from their aggregates per minute */
+	unsigned long decoded; /** chunks the index could not answer */
+	uint64_t readings;
+};
+
+int temperhum_query(const char * path, int64_t from, int64_t to, int64_t step, struct temperhum_query_bucket * buckets, int size, struct temperhum_query_stats * stats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_QUERY */
@@ -0,0 +1,121 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Text rendering of samples shared by stdout, the socket server and the log
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "temper-hum-hid-report.h"
+
+/**
+ * Builds a report of a sample, human readable or in machine-friendly format
+ */
+void temperhum_format_report(struct temperhum_sample * sample, int machine, char * report)
+{
+	char report_line[128];
+
+	report[0] = 0x00;
+	if (!machine) {
+		sprintf(report_line, "Temperhum device @ %03u:%03u:\n", sample->bus_number, sample->device_number);
+		strcat(report, report_line);
+		sprintf(report_line, "  Port: %s\n", sample->port_path);
+		strcat(report, report_line);
+		sprintf(report_line, "  Temperature: %.2f C\n", sample->temperature);
+		strcat(report, report_line);
+		sprintf(report_line, "  Relative humidity: %.2f %%\n", sample->humidity);
+		strcat(report, report_line);
+		sprintf(report_line, "  Dew point: %.2f C\n", sample->dew_point);
+		strcat(report, report_line);
+
+		/**
+		 * Calculate Human perception for this dew point according to Wikipedia table
+		 * @see http://en.wikipedia.org/wiki/Dew_point
+		 */
+		char * perception;
+		if (sample->dew_point < 10) {
+			perception = "A bit dry for some";
+		} else if (10 <= sample->dew_point && sample->dew_point < 12.5) {
+			perception = "Very comfortable";
+		} else if (12.5 <= sample->dew_point && sample->dew_point < 16) {
+			perception = "Comfortable";
+		} else if (16 <= sample->dew_point && sample->dew_point < 18) {
+			perception = "OK for most, but all perceive the humidity at upper edge";
+		} else if (18 <= sample->dew_point && sample->dew_point < 21) {
+			perception = "Somewhat uncomfortable for most people at upper edge";
+		} else if (21 <= sample->dew_point && sample->dew_point < 24) {
+			perception = "Very humid, quite uncomfortable";
+		} else if (24 <= sample->dew_point && sample->dew_point < 26) {
+			perception = "Extremely uncomfortable, fairly oppressive";
+		} else {
+			perception = "Severely high! Even deadly for asthma related illnesses";
+		}
+		sprintf(report_line, "  Human perception: %s\n", perception);
+		strcat(report, report_line);
+
+		if ((sample->temperature - 2) < sample->dew_point && sample->dew_point < (sample->temperature + 2)) {
+			strcat(report, "\n  Warning! Dew point almost same as current temperature.\n  Humid air may condense into liquid water!\n");
+		}
+	} else {
+		sprintf(report_line, "%03u-%03u-i%u-temp: %.2f\n", sample->bus_number, sample->device_number, sample->interface_number, sample->temperature);
+		strcat(report, report_line);
+		sprintf(report_line, "%03u-%03u-i%u-hum: %.2f\n", sample->bus_number, sample->device_number, sample->interface_number, sample->humidity);
+		strcat(report, report_line);
+		sprintf(report_line, "%03u-%03u-i%u-dew: %.2f\n", sample->bus_number, sample->device_number, sample->interface_number, sample->dew_point);
+		strcat(report, report_line);
+
+		// rolling statistics, 4ex. 001-004-i1-temp-15m-max
+		static const char * names[TEMPERHUM_STATS_VALUES] = {"temp", "hum", "dew"};
+		char * end = report + strlen(report);
+		int w, v;
+		for (w = 0; w < TEMPERHUM_STATS_WINDOWS; w++) {
+			for (v = 0; v < TEMPERHUM_STATS_VALUES; v++) {
+				struct temperhum_summary * s = &sample->stats[w][v];
+				char key[32];
+				snprintf(key, sizeof(key), "%03u-%03u-i%u-%s-%s", sample->bus_number, sample->device_number, sample->interface_number, names[v], temperhum_stats_window_name(w));
+				end += sprintf(end, "%s-min: %.2f\n%s-max: %.2f\n%s-mean: %.2f\n%s-stddev: %.2f\n", key, s->min, key, s->max, key, s->mean, key, s->stddev);
+			}
+		}
+
+		// latencies in us and counters of reads, 4ex. 001-004-i1-settle-p99 and 001-004-i1-timeouts
+		for (v = 0; v < TEMPERHUM_LATENCIES; v++) {
+			struct temperhum_histogram_summary * l = &sample->latency[v];
+			char key[32];
+			snprintf(key, sizeof(key), "%03u-%03u-i%u-%s", sample->bus_number, sample->device_number, sample->interface_number, temperhum_latency_name(v));
+			end += sprintf(end, "%s-count: %llu\n%s-p50: %u\n%s-p90: %u\n%s-p99: %u\n%s-max: %u\n", key, (unsigned long long) l->count, key, l->p50, key, l->p90, key, l->p99, key, l->max);
+		}
+		for (v = 0; v < TEMPERHUM_COUNTERS; v++) {
+			end += sprintf(end, "%03u-%03u-i%u-%s: %llu\n", sample->bus_number, sample->device_number, sample->interface_number, temperhum_counter_name(v), (unsigned long long) sample->counter[v]);
+		}
+	}
+}
+
+/**
+ * Builds the log line of a sample without time and trailing newline, returns its length
+ */
+int temperhum_format_log(struct temperhum_sample * sample, char * line, size_t size)
+{
+	return snprintf(
+		line,
+		size,
+		"%03u:%03u-i%u/driver: %i; voltage: %.1f; temperature: %.2f (%i, {0x%02X, 0x%02X}) @ %ibit; humidity: %.2f (%i, {0x%02X, 0x%02X}) @ %ibit; dew point: %.2f",
+		sample->bus_number,
+		sample->device_number,
+		sample->interface_number,
+		sample->kernel_driver_detached,
+		sample->sensor_voltage,
+		sample->temperature,
+		sample->raw_temperature,
+		sample->raw_temperature_bytes[0] & 0xFF,
+		sample->raw_temperature_bytes[1] & 0xFF,
+		sample->measurement_resolution_temperature,
+		sample->humidity,
+		sample->raw_humidity,
+		sample->raw_humidity_bytes[0] & 0xFF,
+		sample->raw_humidity_bytes[1] & 0xFF,
+		sample->measurement_resolution_humidity,
+		sample->dew_point
+	);
+}
@@ -0,0 +1,25 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_REPORT
+#define TEMPER_HUM_HID_REPORT
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include "temper-hum-hid-ring.h"
+
+#define TEMPERHUM_REPORT_SIZE 4096 /** enough for the report of one sample */
+
+void temperhum_format_report(struct temperhum_sample * sample, int machine, char * report);
+int temperhum_format_log(struct temperhum_sample * sample, char * line, size_t size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_REPORT */
@@ -0,0 +1,128 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "temper-hum-hid-ring.h"
+
+/**
+ * Copies the last reading of a device into a sample
+ */
+void temperhum_sample_fill(struct temperhum_sample * sample, temperhum_device * device)
+{
+	sample->timestamp = device->sampled_at;
+	sample->bus_number = device->bus_number;
+	sample->device_number = device->device_number;
+	sample->interface_number = device->interface_number;
+	memcpy(sample->port_path, device->port_path, TEMPERHUM_PORT_PATH_LENGTH);
+	sample->interval = device->interval;
+	sample->kernel_driver_detached = device->kernel_driver_detached;
+	sample->sensor_voltage = device->sensor_voltage;
+	sample->measurement_resolution_temperature = device->measurement_resolution_temperature;
+	sample->measurement_resolution_humidity = device->measurement_resolution_humidity;
+	memcpy(sample->raw_temperature_bytes, device->raw_temperature_bytes, 2);
+	memcpy(sample->raw_humidity_bytes, device->raw_humidity_bytes, 2);
+	sample->raw_temperature = device->raw_temperature;
+	sample->raw_humidity = device->raw_humidity;
+	sample->temperature = device->temperature;
+	sample->humidity = device->humidity;
+	sample->dew_point = device->dew_point;
+	temperhum_stats_summarize(&device->stats, device->sampled_at, sample->stats);
+
+	int i;
+	for (i = 0; i < TEMPERHUM_LATENCIES; i++) {
+		temperhum_histogram_summarize(&device->metrics.latency[i], &sample->latency[i]);
+	}
+	memcpy(sample->counter, device->metrics.counter, sizeof(sample->counter));
+}
+
+/**
+ * Allocates a queue for at least given amount of samples
+ */
+int temperhum_ring_init(struct temperhum_ring * ring, unsigned int capacity)
+{
+	unsigned int size = 1;
+	while (size < capacity) {
+		size <<= 1;
+	}
+
+	ring->samples = calloc(size, sizeof(struct temperhum_sample));
+	if (!ring->samples) {
+		return -1;
+	}
+	ring->mask = size - 1;
+	atomic_init(&ring->head, 0);
+	atomic_init(&ring->tail, 0);
+	atomic_init(&ring->dropped, 0);
+
+	return 0;
+}
+
+/**
+ * Adds a sample to the queue, called by the producer thread only.
+ * Returns -1 if the queue is full and the sample was dropped.
+ */
+int temperhum_ring_push(struct temperhum_ring * ring, const struct temperhum_sample * sample)
+{
+	unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+	if (head - tail > ring->mask) {
+		atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+		return -1;
+	}
+
+	ring->samples[head & ring->mask] = *sample;
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+	return 0;
+}
+
+/**
+ * Takes the oldest sample from the queue, called by the consumer thread only.
+ * Returns 0 if the queue is empty.
+ */
+int temperhum_ring_pop(struct temperhum_ring * ring, struct temperhum_sample * sample)
+{
+	unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	unsigned int head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+	if (head == tail) {
+		return 0;
+	}
+
+	*sample = ring->samples[tail & ring->mask];
+	atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+
+	return 1;
+}
+
+/**
+ * Amount of samples waiting in the queue
+ */
+unsigned int temperhum_ring_occupancy(struct temperhum_ring * ring)
+{
+	unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+	return atomic_load_explicit(&ring->head, memory_order_acquire) - tail;
+}
+
+/**
+ * Amount of samples dropped because the queue was full
+ */
+unsigned long temperhum_ring_dropped(struct temperhum_ring * ring)
+{
+	return atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+}
+
+/**
+ * Frees memory allocated by temperhum_ring_init()
+ */
+void temperhum_ring_free(struct temperhum_ring * ring)
+{
+	free(ring->samples);
+	ring->samples = NULL;
+}
@@ -0,0 +1,68 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_RING
+#define TEMPER_HUM_HID_RING
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "temper-hum-hid-api.h"
+
+/**
+ * One reading of a device, copied out of the device so that output
+ * does not need to touch the usb side
+ */
+struct temperhum_sample {
+	int64_t timestamp; /** wall clock time in ms of the reading */
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	int interval; /** time in ms between samples of the device */
+	int kernel_driver_detached;
+	double sensor_voltage;
+	int measurement_resolution_temperature;
+	int measurement_resolution_humidity;
+	char raw_temperature_bytes[2];
+	char raw_humidity_bytes[2];
+	int raw_temperature;
+	int raw_humidity;
+	double temperature;
+	double humidity;
+	double dew_point;
+	struct temperhum_summary stats[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES]; /** of temperature, humidity and dew point */
+	struct temperhum_histogram_summary latency[TEMPERHUM_LATENCIES]; /** of reads of the device in us */
+	uint64_t counter[TEMPERHUM_COUNTERS];
+};
+
+/**
+ * Single producer single consumer queue of samples. The producer never blocks,
+ * when the queue is full the new sample is dropped and counted.
+ */
+struct temperhum_ring {
+	struct temperhum_sample *samples;
+	unsigned int mask; /** capacity - 1, capacity is a power of 2 */
+	_Alignas(64) atomic_uint head; /** next slot to write, only changed by the producer */
+	_Alignas(64) atomic_uint tail; /** next slot to read, only changed by the consumer */
+	atomic_ulong dropped; /** samples lost because the queue was full */
+};
+
+void temperhum_sample_fill(struct temperhum_sample * sample, temperhum_device * device);
+int temperhum_ring_init(struct temperhum_ring * ring, unsigned int capacity);
+int temperhum_ring_push(struct temperhum_ring * ring, const struct temperhum_sample * sample);
+int temperhum_ring_pop(struct temperhum_ring * ring, struct temperhum_sample * sample);
+unsigned int temperhum_ring_occupancy(struct temperhum_ring * ring);
+unsigned long temperhum_ring_dropped(struct temperhum_ring * ring);
+void temperhum_ring_free(struct temperhum_ring * ring);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_RING */
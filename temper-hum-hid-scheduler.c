@@ -0,0 +1,173 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include "temper-hum-hid-scheduler.h"
+
+/**
+ * Current wall clock time in milliseconds since the epoch
+ */
+int64_t temperhum_realtime_ms()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+
+	return (int64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/**
+ * First point of the sampling grid after given time. The grid is aligned to
+ * the wall clock, so with an interval of a minute samples are taken at :00 seconds
+ * and a slow cycle never shifts the following ones.
+ */
+int64_t temperhum_next_deadline(int64_t now, int interval)
+{
+	return (now / interval + 1) * interval;
+}
+
+/**
+ * Sleeps until an absolute wall clock time in milliseconds,
+ * returns how many milliseconds late we woke up
+ */
+int64_t temperhum_sleep_until(int64_t deadline)
+{
+	struct timespec wakeup;
+	wakeup.tv_sec = deadline / 1000;
+	wakeup.tv_nsec = (deadline % 1000) * 1000000;
+
+	// an absolute deadline is not moved by signals interrupting the sleep
+	while (clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &wakeup, NULL) == EINTR);
+
+	return temperhum_realtime_ms() - deadline;
+}
+
+/**
+ * Moves a device up the heap until its parent is due earlier
+ */
+static void temperhum_schedule_sift_up(struct temperhum_schedule * schedule, int i)
+{
+	temperhum_device **heap = schedule->heap;
+
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (heap[parent]->next_sample <= heap[i]->next_sample) {
+			break;
+		}
+		temperhum_device *tmp = heap[parent];
+		heap[parent] = heap[i];
+		heap[i] = tmp;
+		i = parent;
+	}
+}
+
+/**
+ * Moves a device down the heap until its children are due later
+ */
+static void temperhum_schedule_sift_down(struct temperhum_schedule * schedule, int i)
+{
+	temperhum_device **heap = schedule->heap;
+
+	while (1) {
+		int smallest = i, left = 2 * i + 1, right = 2 * i + 2;
+		if (left < schedule->count && heap[left]->next_sample < heap[smallest]->next_sample) {
+			smallest = left;
+		}
+		if (right < schedule->count && heap[right]->next_sample < heap[smallest]->next_sample) {
+			smallest = right;
+		}
+		if (smallest == i) {
+			break;
+		}
+		temperhum_device *tmp = heap[smallest];
+		heap[smallest] = heap[i];
+		heap[i] = tmp;
+		i = smallest;
+	}
+}
+
+/**
+ * Puts all devices of a list into the schedule. Devices which were never
+ * scheduled are due right away, the others keep their next sample time.
+ */
+int temperhum_schedule_build(struct temperhum_schedule * schedule, temperhum_device * device, int64_t now)
+{
+	int count = 0, i;
+	temperhum_device *d;
+
+	for (d = device; d; d = d->next) {
+		count++;
+	}
+
+	if (count > schedule->size) {
+		temperhum_device **heap = realloc(schedule->heap, count * sizeof(temperhum_device *));
+		if (!heap) {
+			return -1;
+		}
+		schedule->heap = heap;
+		schedule->size = count;
+	}
+
+	schedule->count = 0;
+	for (d = device; d; d = d->next) {
+		if (!d->next_sample) {
+			d->next_sample = now;
+		}
+		schedule->heap[schedule->count++] = d;
+	}
+
+	for (i = schedule->count / 2 - 1; i >= 0; i--) {
+		temperhum_schedule_sift_down(schedule, i);
+	}
+
+	return count;
+}
+
+/**
+ * Device which is due to be read first, without removing it
+ */
+temperhum_device * temperhum_schedule_top(struct temperhum_schedule * schedule)
+{
+	return schedule->count ? schedule->heap[0] : NULL;
+}
+
+/**
+ * Removes the device which is due to be read first
+ */
+temperhum_device * temperhum_schedule_pop(struct temperhum_schedule * schedule)
+{
+	if (!schedule->count) {
+		return NULL;
+	}
+
+	temperhum_device *top = schedule->heap[0];
+	schedule->heap[0] = schedule->heap[--schedule->count];
+	temperhum_schedule_sift_down(schedule, 0);
+
+	return top;
+}
+
+/**
+ * Puts a device back into the schedule at its next_sample time
+ */
+void temperhum_schedule_push(struct temperhum_schedule * schedule, temperhum_device * device)
+{
+	// heap always has room for every device it was built with
+	schedule->heap[schedule->count] = device;
+	temperhum_schedule_sift_up(schedule, schedule->count++);
+}
+
+/**
+ * Frees memory used by a schedule
+ */
+void temperhum_schedule_free(struct temperhum_schedule * schedule)
+{
+	free(schedule->heap);
+	schedule->heap = NULL;
+	schedule->count = 0;
+	schedule->size = 0;
+}
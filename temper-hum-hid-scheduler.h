@@ -0,0 +1,38 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_SCHEDULER
+#define TEMPER_HUM_HID_SCHEDULER
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "temper-hum-hid-api.h"
+
+/**
+ * Devices ordered by the time they are due to be read
+ */
+struct temperhum_schedule {
+	temperhum_device **heap; /** min-heap keyed on next_sample */
+	int count;
+	int size;
+};
+
+int64_t temperhum_realtime_ms();
+int64_t temperhum_next_deadline(int64_t now, int interval);
+int64_t temperhum_sleep_until(int64_t deadline);
+int temperhum_schedule_build(struct temperhum_schedule * schedule, temperhum_device * device, int64_t now);
+temperhum_device * temperhum_schedule_top(struct temperhum_schedule * schedule);
+temperhum_device * temperhum_schedule_pop(struct temperhum_schedule * schedule);
+void temperhum_schedule_push(struct temperhum_schedule * schedule, temperhum_device * device);
+void temperhum_schedule_free(struct temperhum_schedule * schedule);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_SCHEDULER */
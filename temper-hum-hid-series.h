@@ -0,0 +1,44 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Binary time series of a device written by temper-hum-hid-import: a header
+ * followed by fixed size records in the order of the log, native byte order.
+ */
+
+#ifndef TEMPER_HUM_HID_SERIES
+#define TEMPER_HUM_HID_SERIES
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#define TEMPERHUM_SERIES_MAGIC "THTS"
+#define TEMPERHUM_SERIES_VERSION 1
+#define TEMPERHUM_SERIES_INVALID INT32_MIN /** value logged as nan or inf */
+
+struct temperhum_series_header {
+	char magic[4];
+	uint16_t version;
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	uint8_t reserved[7];
+};
+
+struct temperhum_series_record {
+	int64_t timestamp; /** seconds since the epoch */
+	int32_t temperature; /** hundredths of C */
+	int32_t humidity; /** hundredths of % */
+	int32_t dew_point; /** hundredths of C */
+	uint16_t raw_temperature; /** SOT */
+	uint16_t raw_humidity; /** SORH */
+};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_SERIES */
@@ -0,0 +1,55 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Writes the humidity tables of temper-hum-hid-sht1x.c to standard output,
+ * run by make sht1x-tables. Coefficients have to match those of
+ * temper-hum-hid-sht1x.c, the bench checks every entry against the formulas.
+ */
+
+#include <stdio.h>
+
+static const struct {
+	int resolution;
+	double c1, c2, c3;
+	float t1, t2;
+} humidities[2] = {
+	{12, -2.0468, 0.0367, -1.5955e-6, 0.01, 0.00008},
+	{8, -2.0468, 0.5872, -4.0845e-4, 0.01, 0.00128}
+};
+
+int main()
+{
+	int h, sorh;
+
+	printf("/**\n * Generated by temper-hum-hid-sht1x-gen.c, do not edit\n *\n");
+	printf(" * Clamped linear humidity and temperature compensation of every\n * humidity reading (SORH) per resolution\n */\n");
+
+	for (h = 0; h < 2; h++) {
+		int size = 1 << humidities[h].resolution;
+
+		printf("\nstatic const double temperhum_sht1x_linear_%i[%i] = {", humidities[h].resolution, size);
+		for (sorh = 0; sorh < size; sorh++) {
+			// the same expression as temperhum_sht1x_humidity_linear()
+			double humidity_linear = humidities[h].c1 + humidities[h].c2 * sorh + humidities[h].c3 * sorh * sorh;
+			if (humidity_linear < 0) {
+				humidity_linear = 0;
+			}
+			if (humidity_linear > 99) {
+				humidity_linear = 100;
+			}
+			printf("%s%.17g%s", sorh % 4 ? " " : "\n\t", humidity_linear, sorh + 1 < size ? "," : "\n");
+		}
+		printf("};\n");
+
+		printf("\nstatic const float temperhum_sht1x_compensation_%i[%i] = {", humidities[h].resolution, size);
+		for (sorh = 0; sorh < size; sorh++) {
+			float compensation = humidities[h].t1 + humidities[h].t2 * sorh;
+			printf("%s%.9gf%s", sorh % 4 ? " " : "\n\t", compensation, sorh + 1 < size ? "," : "\n");
+		}
+		printf("};\n");
+	}
+
+	return 0;
+}
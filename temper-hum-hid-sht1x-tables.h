@@ -0,0 +1,2194 @@
+/**
+ * Generated by temper-hum-hid-sht1x-gen.c, do not edit
+ *
+ * Clamped linear humidity and temperature compensation of every
+ * humidity reading (SORH) per resolution
+ */
+
+static const double temperhum_sht1x_linear_12[4096] = {
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0, 0, 0, 0,
+	0.0033965119999999627, 0.039916220500000141, 0.076432737999999875, 0.11294606450000005,
+	0.14945620000000023, 0.18596314449999995, 0.22246689800000014, 0.25896746049999986,
+	0.29546483200000007, 0.33195901250000021, 0.36845000199999994, 0.40493780050000011,
+	0.44142240799999988, 0.47790382450000002, 0.51438205000000026, 0.55085708449999993,
+	0.58732892800000014, 0.62379758049999989, 0.66026304200000008, 0.69672531250000025,
+	0.73318439199999996, 0.76964028050000011, 0.80609297800000035, 0.84254248450000002,
+	0.87898880000000024, 0.91543192449999999, 0.95187185800000007, 0.98830860050000024,
+	1.024742152, 1.0611725125000002, 1.097599682, 1.1340236605,
+	1.1704444480000002, 1.2068620445, 1.2432764500000002, 1.2796876644999999,
+	1.3160956880000001, 1.3525005205000002, 1.3889021619999999, 1.4253006125000003,
+	1.461695872, 1.4980879405, 1.5344768180000004, 1.5708625045,
+	1.6072450000000003, 1.6436243045000003, 1.6800004180000001, 1.7163733405000003,
+	1.7527430720000001, 1.7891096125000001, 1.8254729620000003, 1.8618331205,
+	1.8981900880000002, 1.9345438644999999, 1.9708944500000007, 2.0072418445000002,
+	2.0435860479999999, 2.0799270604999998, 2.1162648820000003, 2.1525995125000001,
+	2.1889309519999998, 2.2252592005000005, 2.2615842580000001, 2.2979061244999999,
+	2.3342248000000008, 2.3705402845000005, 2.4068525780000001, 2.4431616804999998,
+	2.4794675920000007, 2.5157703125000004, 2.5520698419999999, 2.5883661805000004,
+	2.6246593280000003, 2.6609492845, 2.6972360500000008, 2.7335196245000004,
+	2.7698000080000003, 2.8060772005000008, 2.8423512020000006, 2.8786220125000002,
+	2.914889632, 2.9511540605000004, 2.9874152980000002, 3.0236733445000001,
+	3.0599282000000008, 3.0961798645000003, 3.132428338, 3.1686736205000008,
+	3.2049157120000005, 3.2411546125000004, 3.277390322, 3.3136228405000003,
+	3.3498521680000004, 3.3860783044999998, 3.4223012500000007, 3.4585210045000006,
+	3.4947375680000001, 3.5309509405000008, 3.5671611220000004, 3.6033681125000001,
+	3.639571912000001, 3.6757725205000007, 3.7119699380000002, 3.7481641644999999,
+	3.7843552000000007, 3.8205430445000004, 3.8567276980000003, 3.8929091605000008,
+	3.9290874320000002, 3.9652625125000003, 4.001434402000001, 4.0376031005000002,
+	4.073768608, 4.1099309245000004, 4.1460900500000006, 4.1822459845000006,
+	4.2183987280000004, 4.2545482805000008, 4.2906946420000001, 4.3268378125,
+	4.3629777920000006, 4.3991145805000009, 4.4352481780000002, 4.4713785845000009,
+	4.5075058000000006, 4.5436298245, 4.579750658, 4.6158683005000007,
+	4.6519827520000003, 4.6880940125000006, 4.7242020820000006, 4.7603069605000004,
+	4.7964086479999999, 4.832507144500001, 4.8686024500000009, 4.9046945645000006,
+	4.9407834880000001, 4.9768692205000002, 5.0129517620000001, 5.0490311124999998,
+	5.085107272000001, 5.1211802405000002, 5.157250018, 5.1933166045000005,
+	5.2293800000000008, 5.2654402044999999, 5.3014972180000006, 5.3375510405000011,
+	5.3736016720000004, 5.4096491125000004, 5.445693362000001, 5.4817344205000005,
+	5.5177722880000006, 5.5538069645000006, 5.5898384500000002, 5.6258667445000006,
+	5.6618918480000007, 5.6979137605000005, 5.7339324820000002, 5.7699480125000013,
+	5.8059603520000005, 5.8419695005000003, 5.8779754579999999, 5.9139782245000001,
+	5.9499778000000019, 5.9859741845000016, 6.0219673780000011, 6.0579573805000004,
+	6.0939441920000004, 6.1299278125000001, 6.1659082419999995, 6.2018854805000014,
+	6.2378595280000013, 6.273830384500001, 6.3097980500000004, 6.3457625245000004,
+	6.3817238080000003, 6.4176819004999999, 6.453636802000001, 6.489588512500001,
+	6.5255370320000008, 6.5614823605000003, 6.5974244980000005, 6.6333634444999996,
+	6.6692992000000011, 6.7052317645000015, 6.7411611380000007, 6.7770873205000006,
+	6.8130103120000003, 6.8489301124999997, 6.8848467219999998, 6.9207601405000014,
+	6.956670368000001, 6.9925774045000004, 7.0284812500000005, 7.0643819045000003,
+	7.1002793679999998, 7.1361736405000018, 7.1720647220000009, 7.2079526125000006,
+	7.243837312000001, 7.2797188205000003, 7.3155971380000002, 7.3514722644999999,
+	7.3873442000000011, 7.4232129445000012, 7.4590784980000011, 7.4949408605000007,
+	7.5308000320000001, 7.5666560125000002, 7.6025088020000018, 7.6383584005000014,
+	7.6742048080000007, 7.7100480245000007, 7.7458880500000005, 7.7817248845,
+	7.8175585280000002, 7.8533889805000019, 7.8892162420000007, 7.9250403125000002,
+	7.9608611919999994, 7.9966788804999993, 8.0324933779999999, 8.0683046845000028,
+	8.1041128000000029, 8.1399177245000018, 8.1757194580000014, 8.2115180005000017,
+	8.2473133520000008, 8.2831055125000006, 8.318894482000001, 8.3546802605000003,
+	8.3904628480000003, 8.4262422444999991, 8.4620184500000004, 8.4977914644999988,
+	8.5335612879999996, 8.5693279205000028, 8.6050913620000014, 8.6408516125000023,
+	8.6766086720000022, 8.7123625405000009, 8.7481132180000003, 8.7838607045000003,
+	8.819605000000001, 8.8553461045000006, 8.8910840180000008, 8.9268187404999999,
+	8.9625502719999997, 8.9982786124999983, 9.0340037620000029, 9.0697257205000028,
+	9.1054444880000016, 9.1411600645000011, 9.1768724500000012, 9.2125816445000019,
+	9.2482876480000016, 9.2839904605000001, 9.319690082000001, 9.3553865125000009,
+	9.3910797519999996, 9.4267698004999989, 9.4624566579999989, 9.4981403245000031,
+	9.5338208000000026, 9.5694980845000028, 9.6051721780000019, 9.6408430805000016,
+	9.676510792000002, 9.7121753125000012, 9.7478366420000011, 9.7834947804999999,
+	9.8191497279999993, 9.8548014844999994, 9.8904500500000001, 9.9260954244999997,
+	9.9617376080000017, 9.9973766005000027, 10.033012402000002, 10.068645012500001,
+	10.104274432000002, 10.1399006605, 10.175523698000001, 10.211143544500001,
+	10.246760200000001, 10.2823736645, 10.317983937999999, 10.3535910205,
+	10.389194911999999, 10.424795612500002, 10.460393122000003, 10.495987440500002,
+	10.531578568000002, 10.567166504500001, 10.602751250000001, 10.638332804500001,
+	10.673911168, 10.7094863405, 10.745058322, 10.780627112499999,
+	10.816192711999999, 10.8517551205, 10.887314338000003, 10.922870364500003,
+	10.958423200000002, 10.993972844500002, 11.029519298000002, 11.065062560500001,
+	11.100602632000001, 11.136139512500002, 11.171673202000001, 11.207203700500001,
+	11.242731008, 11.278255124499999, 11.31377605, 11.349293784500002,
+	11.384808328000002, 11.420319680500002, 11.455827842000001, 11.491332812500001,
+	11.526834592000002, 11.562333180500001, 11.597828578000001, 11.6333207845,
+	11.6688098, 11.7042956245, 11.739778257999999, 11.775257700499999,
+	11.810733952, 11.846207012500003, 11.881676882000002, 11.917143560500001,
+	11.952607048000003, 11.988067344500001, 12.023524450000002, 12.058978364500001,
+	12.094429088, 12.129876620500001, 12.165320962000001, 12.2007621125,
+	12.236200071999999, 12.271634840499999, 12.307066418000003, 12.342494804500003,
+	12.377920000000001, 12.413342004500002, 12.448760818000002, 12.484176440500001,
+	12.519588872000002, 12.554998112500002, 12.590404162, 12.6258070205,
+	12.661206688, 12.696603164499999, 12.731996449999999, 12.767386544500003,
+	12.802773448000002, 12.838157160500002, 12.873537682000002, 12.908915012500001,
+	12.944289152000001, 12.979660100500002, 13.015027858000002, 13.0503924245,
+	13.085753800000001, 13.121111984500001, 13.156466977999999, 13.1918187805,
+	13.227167392000004, 13.262512812500002, 13.297855042000002, 13.333194080500002,
+	13.368529928000001, 13.403862584500002, 13.439192050000001, 13.474518324500002,
+	13.509841408000002, 13.5451613005, 13.580478002, 13.6157915125,
+	13.651101832, 13.6864089605, 13.721712898, 13.757013644499999,
+	13.792311200000002, 13.827605564500002, 13.862896738000002, 13.898184720500002,
+	13.933469512, 13.968751112500001, 14.004029522, 14.0393047405,
+	14.074576768, 14.1098456045, 14.145111249999999, 14.180373704499999,
+	14.215632968, 14.250889040500002, 14.286141922000002, 14.321391612500001,
+	14.356638112000001, 14.391881420500001, 14.427121538000002, 14.462358464500001,
+	14.4975922, 14.532822744500001, 14.568050098000001, 14.603274260499999,
+	14.638495231999999, 14.673713012499999, 14.708927601999999, 14.744139000500002,
+	14.779347208000003, 14.814552224500002, 14.849754050000001, 14.884952684500002,
+	14.920148128000001, 14.955340380500001, 14.990529442, 15.025715312499999,
+	15.060897991999999, 15.0960774805, 15.131253778, 15.166426884499998,
+	15.201596800000003, 15.236763524500002, 15.271927058000001, 15.307087400500002,
+	15.342244552, 15.377398512500001, 15.412549282000001, 15.447696860500001,
+	15.482841248, 15.517982444499999, 15.55312045, 15.588255264499999,
+	15.623386887999999, 15.658515320500003, 15.693640562000002, 15.728762612500002,
+	15.763881472000001, 15.798997140500001, 15.834109618000001, 15.8692189045,
+	15.904325, 15.9394279045, 15.974527618, 16.009624140499998,
+	16.044717471999999, 16.079807612499998, 16.114894562000003, 16.149978320500001,
+	16.185058888, 16.220136264500002, 16.25521045, 16.2902814445,
+	16.325349248000002, 16.3604138605, 16.395475282, 16.430533512499998,
+	16.465588552, 16.5006404005, 16.535689057999999, 16.570734524500001,
+	16.605776800000001, 16.6408158845, 16.675851778000002, 16.710884480500003,
+	16.745913992000002, 16.7809403125, 16.815963442000001, 16.850983380500001,
+	16.886000127999999, 16.9210136845, 16.95602405, 16.991031224499999,
+	17.026035208000003, 17.061036000500003, 17.096033602000002, 17.131028012500003,
+	17.166019232, 17.201007260500003, 17.235992098000001, 17.270973744500001,
+	17.3059522, 17.340927464500002, 17.375899537999999, 17.410868420499998,
+	17.445834112, 17.480796612500004, 17.515755922000004, 17.550712040500002,
+	17.585664968000003, 17.620614704500003, 17.655561250000002, 17.690504604499999,
+	17.725444767999999, 17.760381740500002, 17.795315521999999, 17.830246112499999,
+	17.865173511999998, 17.9000977205, 17.935018738000004, 17.969936564500003,
+	18.004851200000001, 18.039762644500001, 18.074670898000001, 18.109575960500003,
+	18.144477832, 18.179376512499999, 18.214272002000001, 18.249164300499999,
+	18.284053407999998, 18.318939324500001, 18.353822049999998, 18.388701584499998,
+	18.423577928000004, 18.458451080500001, 18.493321042000002, 18.528187812500001,
+	18.563051392000002, 18.597911780500002, 18.632768978000001, 18.667622984499999,
+	18.7024738, 18.737321424499999, 18.772165858000001, 18.807007100499998,
+	18.841845151999998, 18.876680012500003, 18.911511682000004, 18.9463401605,
+	18.981165448000002, 19.0159875445, 19.05080645, 19.085622164500002,
+	19.120434688, 19.1552440205, 19.190050161999999, 19.2248531125,
+	19.259652872, 19.294449440499999, 19.329242818000004, 19.364033004500001,
+	19.398820000000001, 19.433603804500002, 19.468384418000003, 19.503161840500002,
+	19.537936072000001, 19.572707112500002, 19.607474962000001, 19.6422396205,
+	19.677001088000001, 19.711759364500001, 19.746514449999999, 19.781266344500004,
+	19.816015048000004, 19.850760560500003, 19.885502882000001, 19.920242012500001,
+	19.954977952, 19.989710700500002, 20.024440258000002, 20.059166624500001,
+	20.093889799999999, 20.1286097845, 20.163326578, 20.198040180499998,
+	20.232750592000002, 20.267457812500002, 20.302161842000004, 20.336862680500001,
+	20.371560328000001, 20.4062547845, 20.440946050000001, 20.475634124500001,
+	20.510319008, 20.545000700500001, 20.579679202000001, 20.6143545125,
+	20.649026631999998, 20.683695560500002, 20.718361298000001, 20.753023844500003,
+	20.787683200000004, 20.822339364500003, 20.856992338000001, 20.891642120500002,
+	20.926288712000002, 20.9609321125, 20.995572322000001, 21.030209340500001,
+	21.064843167999999, 21.099473804500001, 21.134101250000004, 21.168725504500003,
+	21.203346568000001, 21.237964440500001, 21.272579122000003, 21.307190612500001,
+	21.341798912000002, 21.376404020500001, 21.411005938000002, 21.445604664499999,
+	21.480200199999999, 21.514792544500001, 21.549381698000001, 21.583967660500004,
+	21.618550432000003, 21.653130012500004, 21.687706402000003, 21.722279600500002,
+	21.756849608000003, 21.791416424500003, 21.825980050000002, 21.8605404845,
+	21.895097728, 21.929651780499999, 21.964202642, 21.9987503125,
+	22.033294792, 22.067836080500001, 22.102374178000002, 22.136909084500001,
+	22.171440800000003, 22.205969324500003, 22.240494658000003, 22.275016800500001,
+	22.309535752000002, 22.344051512500002, 22.378564082, 22.413073460500001,
+	22.447579648000001, 22.4820826445, 22.516582450000001, 22.551079064500001,
+	22.585572488000004, 22.620062720500002, 22.654549762000002, 22.689033612500001,
+	22.723514272000003, 22.7579917405, 22.792466018000002, 22.826937104500001,
+	22.861405000000001, 22.895869704500001, 22.930331217999999, 22.964789540500004,
+	22.999244672000003, 23.033696612500002, 23.068145362000003, 23.102590920500003,
+	23.137033288000001, 23.171472464500003, 23.205908450000003, 23.240341244500001,
+	23.274770847999999, 23.3091972605, 23.343620481999999, 23.3780405125,
+	23.412457352000004, 23.446871000500003, 23.481281458000002, 23.515688724500002,
+	23.550092800000002, 23.584493684500003, 23.618891378000001, 23.6532858805,
+	23.687677192000002, 23.7220653125, 23.756450242, 23.790831980500002,
+	23.825210527999999, 23.859585884500003, 23.893958050000002, 23.928327024500003,
+	23.962692808000003, 23.997055400500003, 24.031414802, 24.065771012500001,
+	24.100124032, 24.134473860500002, 24.168820498000002, 24.203163944500002,
+	24.2375042, 24.271841264500001, 24.306175138000004, 24.340505820500002,
+	24.374833312000003, 24.409157612500003, 24.443478722000002, 24.477796640500003,
+	24.512111368000003, 24.546422904500002, 24.580731249999999, 24.6150364045,
+	24.649338368000002, 24.6836371405, 24.717932722, 24.752225112500003,
+	24.786514312000001, 24.820800320500002, 24.855083138000001, 24.889362764500003,
+	24.923639200000004, 24.957912444500003, 24.992182498000002, 25.026449360500003,
+	25.060713032000002, 25.094973512500001, 25.129230802000002, 25.163484900499999,
+	25.197735808000001, 25.231983524500002, 25.266228050000002, 25.300469384500001,
+	25.334707528000003, 25.368942480500003, 25.403174242000002, 25.4374028125,
+	25.471628192000001, 25.5058503805, 25.540069378000002, 25.574285184499999,
+	25.608497799999999, 25.642707224500001, 25.676913458000001, 25.711116500500005,
+	25.745316352000003, 25.779513012500001, 25.813706482000001, 25.847896760500003,
+	25.882083848000001, 25.916267744500001, 25.95044845, 25.984625964500001,
+	26.018800288000001, 26.0529714205, 26.087139361999998, 26.121304112500003,
+	26.155465672000002, 26.189624040500004, 26.223779218000004, 26.257931204500004,
+	26.292080000000002, 26.326225604500003, 26.360368018000003, 26.394507240500001,
+	26.428643272000002, 26.462776112500002, 26.496905762000001, 26.531032220499998,
+	26.565155488000002, 26.599275564500005, 26.633392450000002, 26.667506144500003,
+	26.701616648000002, 26.735723960500003, 26.769828082, 26.803929012500003,
+	26.838026752000001, 26.872121300500002, 26.906212658000001, 26.9403008245,
+	26.9743858, 27.008467584500004, 27.042546178000002, 27.076621580500003,
+	27.110693792000003, 27.144762812500002, 27.178828642000003, 27.212891280500003,
+	27.246950728000002, 27.281006984500003, 27.31506005, 27.349109924500002,
+	27.383156608, 27.417200100500001, 27.451240402000003, 27.485277512500005,
+	27.519311432000002, 27.553342160500002, 27.587369698000003, 27.621394044500001,
+	27.6554152, 27.689433164500002, 27.723447938, 27.757459520499999,
+	27.791467912000002, 27.825473112499999, 27.859475121999999, 27.893473940500005,
+	27.927469568000003, 27.961462004500003, 27.995451250000002, 28.029437304500004,
+	28.063420168, 28.097399840500003, 28.131376322000001, 28.165349612500002,
+	28.199319712000001, 28.233286620499999, 28.267250338, 28.3012108645,
+	28.335168200000005, 28.369122344500003, 28.403073298000002, 28.437021060500001,
+	28.470965632000002, 28.504907012500002, 28.538845202000001, 28.572780200500002,
+	28.606712008000002, 28.640640624500001, 28.674566050000003, 28.7084882845,
+	28.742407327999999, 28.776323180500004, 28.810235842000001, 28.844145312500004,
+	28.878051591999998, 28.911954680500003, 28.945854577999999, 28.979751284500001,
+	29.013644800000005, 29.047535124500001, 29.081422258000003, 29.115306200500001,
+	29.149186952000004, 29.1830645125, 29.216938882000004, 29.250810060500001,
+	29.284678048000004, 29.318542844499998, 29.352404450000002, 29.386262864499997,
+	29.420118088000002, 29.453970120500006, 29.487818962000002, 29.521664612500004,
+	29.555507072000001, 29.589346340500004, 29.623182417999999, 29.657015304500003,
+	29.690844999999999, 29.724671504500002, 29.758494817999999, 29.792314940500003,
+	29.826131871999998, 29.859945612500002, 29.893756162000006, 29.927563520500001,
+	29.961367688000006, 29.9951686645, 30.028966450000006, 30.0627610445,
+	30.096552448000004, 30.1303406605, 30.164125682000005, 30.197907512499999,
+	30.231686152000002, 30.2654616005, 30.299233858000001, 30.333002924500004,
+	30.366768800000003, 30.400531484500004, 30.434290978, 30.468047280500006,
+	30.501800392, 30.535550312500003, 30.569297041999999, 30.603040580500004,
+	30.636780928000004, 30.670518084500006, 30.704252050000001, 30.737982824500005,
+	30.771710408000004, 30.805434800500006, 30.83915600200001, 30.872874012500006,
+	30.906588832000008, 30.940300460500005, 30.974008898000008, 31.007714144500003,
+	31.041416200000008, 31.075115064500004, 31.108810738000006, 31.142503220500004,
+	31.176192512000007, 31.209878612500003, 31.243561522000007, 31.277241240500008,
+	31.310917768000007, 31.344591104500008, 31.378261250000005, 31.411928204500008,
+	31.445591968000002, 31.479252540500006, 31.512909922000002, 31.546564112500008,
+	31.580215112000001, 31.613862920500004, 31.647507538000003, 31.681148964500004,
+	31.714787200000011, 31.748422244500006, 31.782054098000007, 31.815682760500003,
+	31.849308232000009, 31.882930512500003, 31.916549602000007, 31.950165500500002,
+	31.983778208000007, 32.017387724500004, 32.050994050000007, 32.084597184500005,
+	32.118197128000006, 32.151793880500009, 32.185387442000007, 32.218977812500007,
+	32.252564992000003, 32.286148980500009, 32.319729778000003, 32.353307384500006,
+	32.386881800000005, 32.420453024500006, 32.454021058000002, 32.487585900500008,
+	32.521147552000002, 32.554706012500006, 32.588261282000012, 32.621813360500006,
+	32.65536224800001, 32.688907944500002, 32.722450450000011, 32.755989764500001,
+	32.789525888000007, 32.823058820500002, 32.856588562000006, 32.890115112500006,
+	32.923638472000007, 32.957158640500005, 32.990675618000004, 33.024189404500007,
+	33.057700000000004, 33.091207404500011, 33.124711618000006, 33.158212640500011,
+	33.191710472000004, 33.225205112500007, 33.258696562000004, 33.292184820500005,
+	33.325669888, 33.359151764500005, 33.392630450000006, 33.426105944500009,
+	33.459578248000007, 33.493047360500007, 33.52651328200001, 33.559976012500002,
+	33.59343555200001, 33.626891900500006, 33.660345058000004, 33.693795024500005,
+	33.727241800000009, 33.7606853845, 33.794125778000009, 33.827562980500005,
+	33.860996992000004, 33.894427812500012, 33.927855442000002, 33.961279880500008,
+	33.994701128000003, 34.028119184500007, 34.061534050000006, 34.094945724500008,
+	34.128354208000005, 34.161759500500004, 34.195161602000006, 34.228560512500003,
+	34.261956232000003, 34.295348760500005, 34.328738098000009, 34.362124244500009,
+	34.395507200000011, 34.428886964500002, 34.462263538000009, 34.495636920500004,
+	34.529007112000009, 34.562374112500002, 34.595737922000005, 34.629098540500003,
+	34.662455968000003, 34.695810204500006, 34.729161250000004, 34.762509104500012,
+	34.795853768000008, 34.829195240500006, 34.862533522000007, 34.89586861250001,
+	34.929200512000001, 34.962529220500009, 34.995854738000006, 35.029177064500004,
+	35.062496200000005, 35.095812144500009, 35.129124898000001, 35.162434460500009,
+	35.195740832000013, 35.229044012500005, 35.262344002000006, 35.295640800500003,
+	35.328934408000009, 35.362224824500004, 35.395512050000008, 35.428796084500007,
+	35.462076928000009, 35.495354580500006, 35.528629042000006, 35.561900312500001,
+	35.595168392000005, 35.628433280500012, 35.661694978000007, 35.694953484500012,
+	35.728208800000004, 35.761460924500007, 35.794709858000004, 35.827955600500005,
+	35.861198152000007, 35.894437512500005, 35.927673682000005, 35.960906660500008,
+	35.994136448000006, 36.027363044500007, 36.06058645000001, 36.093806664500008,
+	36.127023688000008, 36.160237520500004, 36.19344816200001, 36.226655612500004,
+	36.259859872000007, 36.293060940500006, 36.326258818000007, 36.359453504500003,
+	36.392645000000009, 36.425833304500003, 36.459018418000007, 36.492200340500013,
+	36.525379072000007, 36.558554612500011, 36.591726962000003, 36.624896120500011,
+	36.658062088000008, 36.691224864500008, 36.724384450000002, 36.757540844500006,
+	36.790694048000006, 36.823844060500008, 36.856990882000005, 36.890134512500005,
+	36.923274952000007, 36.956412200500004, 36.989546258000011, 37.022677124500007,
+	37.055804800000011, 37.088929284500004, 37.122050578000007, 37.155168680500005,
+	37.188283592000005, 37.221395312500007, 37.254503842000005, 37.287609180500006,
+	37.320711328000009, 37.3538102845, 37.386906050000007, 37.41999862450001,
+	37.453088008000009, 37.48617420050001, 37.519257202000006, 37.552337012500011,
+	37.585413632000005, 37.618487060500009, 37.651557298000007, 37.684624344500008,
+	37.717688200000005, 37.750748864500004, 37.783806338000005, 37.816860620500009,
+	37.849911712000008, 37.882959612500002, 37.916004322000006, 37.949045840500006,
+	37.982084168000007, 38.015119304500004, 38.048151250000011, 38.081180004500006,
+	38.11420556800001, 38.147227940500002, 38.180247122000004, 38.213263112500002,
+	38.246275912000009, 38.279285520500011, 38.312291938000008, 38.345295164500008,
+	38.378295200000004, 38.411292044500009, 38.444285698000002, 38.477276160500011,
+	38.510263432000002, 38.54324751250001, 38.576228402000005, 38.609206100500003,
+	38.642180608000004, 38.675151924500007, 38.708120050000012, 38.741084984500006,
+	38.774046728000009, 38.807005280500007, 38.839960642000008, 38.872912812500005,
+	38.90586179200001, 38.938807580500004, 38.971750178000008, 39.004689584500007,
+	39.037625800000008, 39.070558824500004, 39.103488658000003, 39.136415300500012,
+	39.169338752000009, 39.202259012500008, 39.235176082000002, 39.268089960500006,
+	39.301000648000006, 39.333908144500008, 39.366812450000005, 39.399713564500004,
+	39.432611488000006, 39.465506220500004, 39.498397762000003, 39.531286112500005,
+	39.56417127200001, 39.597053240500003, 39.629932018000012, 39.662807604500003,
+	39.69568000000001, 39.728549204500005, 39.76141521800001, 39.794278040500004,
+	39.827137672000006, 39.859994112500004, 39.892847362000005, 39.925697420500001,
+	39.958544288000006, 39.991387964500007, 40.02422845000001, 40.057065744500008,
+	40.089899848000002, 40.122730760500005, 40.155558482000004, 40.188383012500012,
+	40.221204352000001, 40.254022500500007, 40.286837458000001, 40.319649224500004,
+	40.352457800000003, 40.385263184500005, 40.418065378000009, 40.450864380500008,
+	40.483660192000009, 40.516452812500006, 40.549242242000005, 40.582028480500007,
+	40.614811528000011, 40.647591384500004, 40.680368050000006, 40.713141524500003,
+	40.74591180800001, 40.778678900500005, 40.811442802000009, 40.844203512500009,
+	40.876961032000004, 40.909715360500009, 40.942466498000002, 40.975214444500011,
+	41.007959200000002, 41.040700764500009, 41.073439138000005, 41.10617432050001,
+	41.138906312000003, 41.171635112500006, 41.204360722000004, 41.237083140500005,
+	41.269802368000008, 41.302518404500006, 41.335231250000007, 41.367940904500003,
+	41.400647368000008, 41.433350640500002, 41.466050722000006, 41.498747612500004,
+	41.531441312000005, 41.564131820500002, 41.596819138000008, 41.629503264500002,
+	41.662184200000006, 41.694861944500012, 41.727536498000006, 41.76020786050001,
+	41.792876032000009, 41.825541012500011, 41.858202802000008, 41.890861400500008,
+	41.923516808000002, 41.956169024500007, 41.988818050000006, 42.021463884500008,
+	42.054106528000005, 42.086745980500005, 42.119382242000007, 42.152015312500005,
+	42.184645192000012, 42.217271880500007, 42.249895378000012, 42.282515684500005,
+	42.315132800000008, 42.347746724500006, 42.380357458000006, 42.412965000500002,
+	42.445569352000007, 42.4781705125, 42.51076848200001, 42.543363260500008,
+	42.575954848000009, 42.608543244500012, 42.641128450000004, 42.673710464500012,
+	42.706289288000008, 42.738864920500006, 42.771437362000007, 42.804006612500011,
+	42.836572672000003, 42.869135540500011, 42.901695218, 42.934251704500006,
+	42.966805000000008, 42.999355104500005, 43.031902018000011, 43.064445740500005,
+	43.096986272000009, 43.129523612500009, 43.162057762000011, 43.194588720500008,
+	43.227116488000007, 43.259641064500002, 43.292162450000006, 43.324680644500006,
+	43.357195648000008, 43.389707460500013, 43.422216082000006, 43.454721512500008,
+	43.487223752000006, 43.519722800500013, 43.552218658000008, 43.584711324500006,
+	43.617200800000006, 43.649687084500009, 43.682170178000007, 43.714650080500007,
+	43.747126792000003, 43.779600312500008, 43.812070642000009, 43.844537780500005,
+	43.87700172800001, 43.909462484500004, 43.941920050000007, 43.974374424500006,
+	44.006825608000007, 44.039273600500003, 44.071718402000009, 44.104160012500003,
+	44.136598432000007, 44.169033660500006, 44.201465698000007, 44.233894544500004,
+	44.26632020000001, 44.298742664500011, 44.331161938000008, 44.363578020500007,
+	44.395990912000009, 44.428400612500006, 44.460807122000006, 44.493210440500008,
+	44.525610568000005, 44.558007504500011, 44.590401250000006, 44.622791804500011,
+	44.655179168000004, 44.687563340500006, 44.719944322000011, 44.752322112500003,
+	44.784696712000013, 44.817068120500004, 44.849436338000011, 44.881801364500006,
+	44.914163200000011, 44.946521844500005, 44.978877298000008, 45.011229560500006,
+	45.043578632000006, 45.075924512500002, 45.108267202000008, 45.140606700500008,
+	45.172943008000004, 45.20527612450001, 45.237606050000004, 45.269932784500007,
+	45.302256328000006, 45.334576680500007, 45.366893842000003, 45.399207812500009,
+	45.431518592000003, 45.463826180500007, 45.496130578000006, 45.528431784500007,
+	45.560729800000011, 45.593024624500003, 45.625316258000012, 45.657604700500002,
+	45.689889952000009, 45.722172012500003, 45.754450882000008, 45.786726560500007,
+	45.818999048000009, 45.851268344500006, 45.883534450000006, 45.915797364500001,
+	45.948057088000006, 45.980313620500013, 46.012566962000008, 46.044817112500013,
+	46.077064072000006, 46.109307840500009, 46.141548418000006, 46.173785804500007,
+	46.206020000000002, 46.238251004500007, 46.270478818000001, 46.302703440500011,
+	46.334924872000002, 46.36714311250001, 46.399358162000013, 46.431570020500004,
+	46.463778688000012, 46.495984164500008, 46.528186450000007, 46.560385544500008,
+	46.592581448000011, 46.624774160500003, 46.656963682000011, 46.689150012500008,
+	46.721333152000007, 46.753513100500001, 46.785689858000005, 46.817863424500011,
+	46.850033800000006, 46.88220098450001, 46.914364978000009, 46.946525780500011,
+	46.978683392000008, 47.010837812500007, 47.042989042000002, 47.075137080500006,
+	47.107281928000006, 47.139423584500008, 47.171562050000006, 47.203697324500006,
+	47.235829408000008, 47.267958300500005, 47.300084002000013, 47.332206512500008,
+	47.364325832000013, 47.396441960500006, 47.428554898000009, 47.460664644500007,
+	47.492771200000007, 47.524874564500003, 47.556974738000008, 47.589071720500002,
+	47.621165512000005, 47.65325611250001, 47.685343522000004, 47.717427740500014,
+	47.749508768000005, 47.781586604500006, 47.813661250000003, 47.845732704500008,
+	47.877800968000003, 47.909866040500006, 47.941927922000005, 47.973986612500006,
+	48.006042112000003, 48.038094420500009, 48.070143538000011, 48.102189464500007,
+	48.134232200000014, 48.166271744500008, 48.198308098000012, 48.230341260500005,
+	48.262371232000007, 48.294398012500004, 48.326421602000011, 48.358442000500006,
+	48.39045920800001, 48.422473224500003, 48.454484050000005, 48.48649168450001,
+	48.51849612800001, 48.550497380500012, 48.58249544200001, 48.61449031250001,
+	48.646481992000005, 48.67847048050001, 48.710455778000004, 48.742437884500006,
+	48.774416800000004, 48.806392524500005, 48.838365058000008, 48.870334400500006,
+	48.902300552000014, 48.93426351250001, 48.966223282000009, 48.998179860500009,
+	49.030133248000013, 49.062083444500004, 49.094030450000012, 49.125974264500009,
+	49.157914888000008, 49.189852320500002, 49.221786562000005, 49.253717612500004,
+	49.285645472000006, 49.31757014050001, 49.349491618000009, 49.381409904500011,
+	49.413325000000007, 49.445236904500007, 49.477145618000009, 49.509051140500013,
+	49.540953472000005, 49.572852612500007, 49.604748562000005, 49.636641320500011,
+	49.668530888000006, 49.700417264500011, 49.732300450000011, 49.764180444500006,
+	49.796057248000011, 49.827930860500004, 49.859801282000014, 49.891668512500004,
+	49.923532552000012, 49.955393400500007, 49.987251058000012, 50.019105524500006,
+	50.050956800000009, 50.082804884500007, 50.114649778000008, 50.146491480500011,
+	50.178329992000009, 50.21016531250001, 50.241997442000006, 50.273826380500012,
+	50.305652128000006, 50.337474684500009, 50.369294050000008, 50.401110224500009,
+	50.432923208000005, 50.464733000500011, 50.496539602000006, 50.528343012500009,
+	50.560143232000001, 50.59194026050001, 50.623734098000014, 50.655524744500006,
+	50.687312200000008, 50.719096464500005, 50.750877538000012, 50.782655420500006,
+	50.814430112000011, 50.846201612500003, 50.877969922000005, 50.909735040500003,
+	50.94149696800001, 50.973255704500005, 51.00501125000001, 51.03676360450001,
+	51.068512768000005, 51.10025874050001, 51.13200152200001, 51.163741112500013,
+	51.195477512000004, 51.227210720500011, 51.258940738000007, 51.290667564500012,
+	51.322391200000006, 51.354111644500009, 51.385828898000007, 51.417542960500008,
+	51.449253832000011, 51.480961512500009, 51.51266600200001, 51.544367300500006,
+	51.576065408000012, 51.607760324500006, 51.63945205000001, 51.671140584500009,
+	51.70282592800001, 51.734508080500007, 51.766187042000006, 51.797862812500007,
+	51.829535392000011, 51.86120478050001, 51.892870978000005, 51.924533984500009,
+	51.956193800000008, 51.98785042450001, 52.019503858000007, 52.051154100500007,
+	52.082801152000002, 52.114445012500006, 52.146085682000006, 52.177723160500008,
+	52.209357448000006, 52.240988544500006, 52.272616450000015, 52.304241164500006,
+	52.335862688000013, 52.367481020500009, 52.399096162000006, 52.430708112500007,
+	52.462316872000009, 52.493922440500008, 52.525524818000008, 52.557124004500004,
+	52.588720000000009, 52.620312804500003, 52.651902418000006, 52.683488840500011,
+	52.715072072000005, 52.746652112500009, 52.778228962000007, 52.809802620500008,
+	52.841373088000005, 52.87294036450001, 52.904504450000005, 52.936065344500008,
+	52.967623048000007, 52.999177560500009, 53.030728882000005, 53.062277012500005,
+	53.093821952000013, 53.12536370050001, 53.156902258000009, 53.188437624500011,
+	53.219969800000008, 53.251498784500008, 53.28302457800001, 53.314547180500007,
+	53.346066592000007, 53.377582812500009, 53.409095842000006, 53.440605680500006,
+	53.472112328000009, 53.503615784500013, 53.535116050000006, 53.566613124500009,
+	53.598107008000007, 53.629597700500014, 53.66108520200001, 53.692569512500008,
+	53.724050632000008, 53.755528560500011, 53.787003298000002, 53.81847484450001,
+	53.849943200000006, 53.881408364500011, 53.912870338000012, 53.944329120500008,
+	53.975784712000014, 54.007237112500007, 54.038686322000011, 54.07013234050001,
+	54.101575168000011, 54.133014804500007, 54.164451250000013, 54.195884504500007,
+	54.227314568000011, 54.258741440500003, 54.290165122000005, 54.321585612500009,
+	54.353002912000008, 54.38441702050001, 54.415827938000007, 54.447235664500013,
+	54.478640200000008, 54.510041544500012, 54.541439698000005, 54.572834660500007,
+	54.604226432000004, 54.635615012500011, 54.667000402000006, 54.698382600500011,
+	54.729761608000011, 54.761137424500006, 54.792510050000011, 54.823879484500004,
+	54.855245728000014, 54.886608780500005, 54.917968642000012, 54.949325312500008,
+	54.980678792000006, 55.012029080500007, 55.04337617800001, 55.074720084500008,
+	55.106060800000009, 55.137398324500012, 55.16873265800001, 55.200063800500011,
+	55.231391752000008, 55.262716512500013, 55.294038082000007, 55.325356460500011,
+	55.35667164800001, 55.387983644500011, 55.419292450000007, 55.450598064500007,
+	55.481900488000008, 55.513199720500012, 55.544495762000011, 55.575788612500006,
+	55.60707827200001, 55.638364740500009, 55.669648018000011, 55.700928104500008,
+	55.732205000000008, 55.76347870450001, 55.794749218000007, 55.826016540500007,
+	55.857280672000009, 55.888541612500006, 55.919799362000006, 55.951053920500016,
+	55.982305288000006, 56.013553464500013, 56.044798450000009, 56.076040244500007,
+	56.107278848000007, 56.13851426050001, 56.169746482000008, 56.200975512500008,
+	56.232201352000004, 56.263424000500009, 56.294643458000003, 56.325859724500006,
+	56.357072800000012, 56.388282684500005, 56.419489378000009, 56.450692880500007,
+	56.481893192000008, 56.513090312500005, 56.54428424200001, 56.575474980500005,
+	56.606662528000008, 56.637846884500007, 56.669028050000009, 56.700206024500005,
+	56.731380808000011, 56.762552400500013, 56.79372080200001, 56.824886012500009,
+	56.856048032000004, 56.887206860500015, 56.918362498000008, 56.94951494450001,
+	56.980664200000007, 57.011810264500014, 57.042953138000009, 57.074092820500013,
+	57.105229312000006, 57.136362612500001, 57.167492722000013, 57.198619640500006,
+	57.229743368000001, 57.260863904500013, 57.291981250000013, 57.323095404500009,
+	57.354206368000007, 57.385314140500014, 57.41641872200001, 57.447520112500008,
+	57.478618312000002, 57.509713320500012, 57.54080513800001, 57.571893764500004,
+	57.602979200000014, 57.634061444500013, 57.665140498000007, 57.696216360500003,
+	57.727289032000016, 57.75835851250001, 57.789424802000006, 57.820487900500005,
+	57.851547808000014, 57.88260452450001, 57.913658050000009, 57.944708384500004,
+	57.975755528000015, 58.006799480500007, 58.037840242000001, 58.068877812500013,
+	58.099912192000012, 58.130943380500007, 58.161971378000004, 58.192996184500018,
+	58.224017800000013, 58.255036224500003, 58.286051458000003, 58.317063500500012,
+	58.34807235200001, 58.379078012500003, 58.410080482000012, 58.44107976050001,
+	58.47207584800001, 58.503068744500005, 58.534058450000018, 58.565044964500011,
+	58.596028288000007, 58.627008420500005, 58.657985362000012, 58.688959112500008,
+	58.719929672000006, 58.7508970405, 58.78186121800001, 58.812822204500009,
+	58.843779999999995, 58.874734604500006, 58.905686018000004, 58.936634240499998,
+	58.967579271999995, 58.998521112500008, 59.029459762000002, 59.060395220499998,
+	59.091327487999997, 59.122256564500006, 59.153182450000003, 59.184105144499995,
+	59.215024648000011, 59.245940960500008, 59.276854082, 59.307764012499995,
+	59.338670752000006, 59.369574300500005, 59.400474658, 59.431371824499998,
+	59.462265800000004, 59.493156584499999, 59.524044177999997, 59.554928580499997,
+	59.585809792000006, 59.616687812500004, 59.647562641999997, 59.678434280500007,
+	59.709302728000004, 59.740167984499998, 59.771030049999993, 59.801888924500005,
+	59.832744608000006, 59.863597100500002, 59.894446401999993, 59.925292512500008,
+	59.956135432000004, 59.986975160499995, 60.01781169800001, 60.048645044500006,
+	60.079475200000005, 60.110302164499998, 60.141125938000009, 60.171946520500001,
+	60.202763912000002, 60.233578112499998, 60.264389122000004, 60.295196940500006,
+	60.326001567999995, 60.356803004499994, 60.387601250000003, 60.4183963045,
+	60.449188167999999, 60.479976840500008, 60.510762322000005, 60.541544612500005,
+	60.572323711999999, 60.603099620500004, 60.633872338000003, 60.664641864499998,
+	60.695408199999996, 60.726171344500003, 60.756931298000005, 60.787688060500003,
+	60.818441631999995, 60.849192012500005, 60.879939202000003, 60.910683200499996,
+	60.941424008000006, 60.972161624500004, 61.002896050000004, 61.0336272845,
+	61.064355328000005, 61.095080180500005, 61.125801842000001, 61.156520312499993,
+	61.187235592000008, 61.217947680500004, 61.248656577999995, 61.27936228450001,
+	61.310064800000006, 61.340764124499998, 61.371460257999999, 61.40215320050001,
+	61.432842952000001, 61.463529512500003, 61.494212881999999, 61.524893060500006,
+	61.555570048, 61.586243844499997, 61.616914449999996, 61.647581864500005,
+	61.678246088000002, 61.708907120500001, 61.73956496200001, 61.770219612500007,
+	61.800871072, 61.831519340499995, 61.862164418000006, 61.892806304500006,
+	61.923445000000001, 61.954080504499998, 61.984712818000006, 62.015341940500001,
+	62.045967871999999, 62.076590612500006, 62.107210162000001, 62.137826520499999,
+	62.168439687999999, 62.199049664500009, 62.229656450000007, 62.260260044500001,
+	62.290860447999997, 62.321457660500009, 62.352051682000003, 62.382642512499999,
+	62.413230151999997, 62.443814600500005, 62.474395858000001, 62.5049739245,
+	62.535548800000008, 62.566120484500004, 62.596688978000003, 62.627254280499997,
+	62.657816392000008, 62.6883753125, 62.718931042000001, 62.749483580499998,
+	62.780032928000004, 62.810579084500006, 62.841122049999996, 62.871661824500009,
+	62.902198408000004, 62.932731800500001, 62.963262001999993, 62.99378901250001,
+	63.024312832000007, 63.054833460499999, 63.085350897999994, 63.115865144500006,
+	63.146376200000006, 63.176884064500001, 63.207388737999992, 63.237890220500006,
+	63.268388512000001, 63.298883612499999, 63.329375522000007, 63.359864240500002,
+	63.390349768, 63.420832104499993, 63.451311250000003, 63.481787204500002,
+	63.512259968000002, 63.542729540499998, 63.573195922000004, 63.603659112500004,
+	63.634119112, 63.664575920500006, 63.695029538000007, 63.725479964500003,
+	63.755927199999995, 63.78637124450001, 63.816812098000007, 63.847249760499999,
+	63.877684231999993, 63.908115512500004, 63.938543602000003, 63.968968500499997,
+	63.999390207999994, 64.0298087245, 64.060224050000002, 64.090636184499999,
+	64.121045128000006, 64.151450880500008, 64.181853442000005, 64.212252812499997,
+	64.242648992000014, 64.273041980500011, 64.303431778000004, 64.333818384499992,
+	64.364201800000004, 64.394582024499996, 64.424959057999999, 64.455332900500011,
+	64.485703552000004, 64.516071012500007, 64.546435282000004, 64.576796360500012,
+	64.607154248000001, 64.637508944499999, 64.667860449999992, 64.698208764500009,
+	64.728553888000008, 64.758895820500001, 64.78923456199999, 64.819570112500003,
+	64.849902471999997, 64.8802316405, 64.910557618000013, 64.940880404500007,
+	64.971199999999996, 65.001516404499995, 65.031829618000003, 65.062139640500007,
+	65.092446472000006, 65.1227501125, 65.153050562000004, 65.183347820500003,
+	65.213641887999998, 65.243932764500016, 65.274220450000001, 65.304504944499996,
+	65.334786248, 65.365064360500014, 65.395339282000009, 65.425611012499999,
+	65.455879551999999, 65.486144900500008, 65.516407057999999, 65.546666024499999,
+	65.576921799999994, 65.607174384500013, 65.637423777999999, 65.667669980499994,
+	65.697912992000013, 65.728152812499999, 65.758389441999995, 65.7886228805,
+	65.818853128000001, 65.849080184500011, 65.879304050000002, 65.909524724500002,
+	65.939742208000013, 65.969956500500004, 66.000167602000005, 66.030375512500015,
+	66.060580232000007, 66.090781760500008, 66.120980098000004, 66.15117524450001,
+	66.181367200000011, 66.211555964500008, 66.241741537999999, 66.271923920500001,
+	66.302103111999998, 66.332279112500004, 66.362451921999991, 66.392621540500002,
+	66.422787968000009, 66.452951204499996, 66.483111250000007, 66.5132681045,
+	66.543421768000002, 66.573572240499999, 66.603719522000006, 66.633863612500008,
+	66.664004512000005, 66.694142220499998, 66.724276738000015, 66.754408064499998,
+	66.784536200000005, 66.814661144499993, 66.844782898000005, 66.874901460499999,
+	66.905016832000001, 66.935129012500013, 66.965238002000007, 66.995343800499995,
+	67.025446407999993, 67.055545824500001, 67.085642050000004, 67.115735084500002,
+	67.145824927999996, 67.175911580500014, 67.205995041999998, 67.236075312499992,
+	67.266152392000009, 67.296226280500008, 67.326296978000002, 67.356364484499991,
+	67.386428800000004, 67.416489924499999, 67.446547858000002, 67.476602600500001,
+	67.50665415200001, 67.5367025125, 67.566747681999999, 67.596789660499994,
+	67.626828448000012, 67.656864044499997, 67.686896449999992, 67.71692566450001,
+	67.74695168800001, 67.776974520500005, 67.806994161999995, 67.837010612500009,
+	67.867023872000004, 67.897033940499995, 67.927040817999995, 67.957044504500004,
+	67.987045000000009, 68.017042304499995, 68.047036418000005, 68.07702734050001,
+	68.107015071999996, 68.136999612499991, 68.166980962000011, 68.196959120500011,
+	68.226934088000007, 68.256905864499998, 68.286874450000013, 68.316839844500009,
+	68.346802048000001, 68.376761060500002, 68.406716882000012, 68.436669512500004,
+	68.466618952000005, 68.496565200500015, 68.526508258000007, 68.556448124500008,
+	68.58638479999999, 68.616318284500011, 68.646248577999998, 68.676175680499995,
+	68.706099592000001, 68.736020312500003, 68.765937842, 68.795852180500006,
+	68.825763328000008, 68.855671284500005, 68.885576049999997, 68.915477624499999,
+	68.945376008000011, 68.975271200500003, 69.005163202000006, 69.035052012500003,
+	69.06493763200001, 69.094820060499998, 69.124699297999996, 69.154575344499989,
+	69.184448200000006, 69.214317864500003, 69.244184337999997, 69.274047620500014,
+	69.303907712000012, 69.333764612500005, 69.363618321999994, 69.393468840500006,
+	69.423316167999999, 69.453160304500003, 69.483001250000001, 69.512839004500009,
+	69.542673567999998, 69.572504940499996, 69.602333122000005, 69.632158112500008,
+	69.661979912000007, 69.691798520500001, 69.721613938000004, 69.751426164500003,
+	69.781235199999998, 69.811041044500001, 69.840843698000015, 69.870643160500009,
+	69.900439431999999, 69.930232512499998, 69.960022402000007, 69.989809100499997,
+	70.019592607999996, 70.049372924500005, 70.07915005000001, 70.108923984499995,
+	70.13869472799999, 70.168462280500009, 70.198226642000009, 70.227987812500004,
+	70.257745791999994, 70.287500580500009, 70.317252178000004, 70.347000584499995,
+	70.376745800000009, 70.406487824500005, 70.43622665800001, 70.465962300499996,
+	70.495694752000006, 70.525424012500011, 70.555150081999997, 70.584872960499993,
+	70.614592648000013, 70.644309144499999, 70.674022449999995, 70.703732564500001,
+	70.733439488000002, 70.763143220499998, 70.792843762000004, 70.822541112500005,
+	70.852235272000001, 70.881926240500007, 70.911614017999995, 70.941298604500005,
+	70.970979999999997, 71.000658204499999, 71.030333217999996, 71.060005040500002,
+	71.089673672000004, 71.119339112500001, 71.149001362000007, 71.178660420500009,
+	71.208316288000006, 71.237968964499998, 71.267618450000015, 71.297264744500012,
+	71.326907848000005, 71.356547760499993, 71.386184482000004, 71.415818012499997,
+	71.445448352, 71.475075500499997, 71.504699458000005, 71.534320224500007,
+	71.563937800000005, 71.593552184500012, 71.623163378000001, 71.652771380499999,
+	71.682376191999992, 71.71197781250001, 71.741576242000008, 71.771171480500001,
+	71.80076352799999, 71.830352384500003, 71.859938049999997, 71.8895205245,
+	71.919099808000013, 71.948675900500007, 71.978248801999996, 72.007818512499995,
+	72.037385032000003, 72.066948360500007, 72.096508498000006, 72.1260654445,
+	72.155619200000004, 72.185169764500003, 72.214717137999997, 72.244261320500001,
+	72.273802312000001, 72.303340112499995, 72.332874722, 72.362406140500013,
+	72.391934368000008, 72.421459404499998, 72.450981249999998, 72.480499904500007,
+	72.510015368000012, 72.539527640499998, 72.569036721999993, 72.598542612500012,
+	72.628045312000012, 72.657544820499993, 72.687041137999998, 72.716534264500012,
+	72.746024200000008, 72.775510944499999, 72.804994498000013, 72.834474860500009,
+	72.863952032, 72.893426012500001, 72.922896802000011, 72.952364400500002,
+	72.981828808000003, 73.011290024499999, 73.040748050000005, 73.070202884500006,
+	73.099654528000002, 73.129102980500008, 73.158548242000009, 73.187990312500006,
+	73.217429191999997, 73.246864880500013, 73.27629737800001, 73.305726684500002,
+	73.335152800000003, 73.364575724500014, 73.393995458000006, 73.423412000500008,
+	73.452825351999991, 73.482235512500012, 73.511642481999999, 73.541046260499996,
+	73.570446848000003, 73.599844244500005, 73.629238450000003, 73.658629464499995,
+	73.688017288000012, 73.717401920500009, 73.746783362000002, 73.776161612500005,
+	73.805536672000002, 73.83490854050001, 73.864277217999998, 73.89364270450001,
+	73.923005000000003, 73.952364104500006, 73.981720018000004, 74.011072740500012,
+	74.040422272000001, 74.069768612499999, 74.099111761999993, 74.12845172050001,
+	74.157788488000008, 74.187122064500002, 74.216452449999991, 74.245779644500004,
+	74.275103647999998, 74.304424460500002, 74.333742082000015, 74.363056512500009,
+	74.392367751999998, 74.421675800499997, 74.450980658000006, 74.48028232450001,
+	74.509580799999995, 74.538876084500004, 74.568168178000008, 74.597457080500007,
+	74.626742792000002, 74.656025312500006, 74.685304642000006, 74.7145807805,
+	74.743853728000005, 74.773123484500005, 74.80239005, 74.831653424500004,
+	74.860913608000004, 74.890170600500014, 74.919424402000004, 74.948675012500004,
+	74.977922432, 75.007166660500005, 75.036407698000005, 75.065645544500001,
+	75.094880200000006, 75.124111664500006, 75.153339938000002, 75.182565020499993,
+	75.211786912000008, 75.241005612500004, 75.270221121999995, 75.299433440499996,
+	75.328642568000006, 75.357848504499998, 75.387051249999999, 75.41625080450001,
+	75.445447168000001, 75.474640340500002, 75.503830321999999, 75.533017112500005,
+	75.562200712000006, 75.591381120500003, 75.620558337999995, 75.649732364500011,
+	75.678903200000008, 75.7080708445, 75.737235298000002, 75.766396560500013,
+	75.795554632000005, 75.824709512499993, 75.853861202000004, 75.883009700500011,
+	75.912155007999999, 75.941297124499997, 75.970436050000004, 75.999571784500006,
+	76.028704328000003, 76.057833680499996, 76.086959842000013, 76.116082812499997,
+	76.145202592000004, 76.174319180500007, 76.203432578000005, 76.232542784499998,
+	76.261649800000001, 76.290753624500013, 76.319854258000007, 76.34895170050001,
+	76.378045951999994, 76.407137012500016, 76.436224882000005, 76.465309560500003,
+	76.494391047999997, 76.5234693445, 76.552544449999999, 76.581616364500007,
+	76.610685088000011, 76.63975062050001, 76.668812962000004, 76.697872112499994,
+	76.726928072000007, 76.755980840500001, 76.785030418000005, 76.81407680449999,
+	76.843120000000013, 76.872160004500003, 76.901196818000003, 76.930230440500011,
+	76.959260872000002, 76.988288112500001, 77.017312161999996, 77.046333020500015,
+	77.075350688, 77.104365164499995, 77.13337645, 77.162384544500014,
+	77.19138944800001, 77.2203911605, 77.249389682, 77.27838501250001,
+	77.307377152000001, 77.336366100500001, 77.365351858000011, 77.394334424500002,
+	77.423313800000003, 77.452289984499998, 77.481262978000004, 77.510232780500004,
+	77.539199392, 77.568162812499992, 77.597123042000007, 77.626080080500003,
+	77.655033927999995, 77.68398458450001, 77.712932050000006, 77.741876324499998,
+	77.770817407999999, 77.79975530050001, 77.828690002000002, 77.857621512500003,
+	77.886549832, 77.915474960500006, 77.944396898000008, 77.973315644500005,
+	78.002231199999997, 78.031143564500013, 78.060052737999996, 78.088958720500003,
+	78.117861512000005, 78.146761112500002, 78.175657521999995, 78.204550740499997,
+	78.233440768000008, 78.262327604500001, 78.291211250000003, 78.320091704500001,
+	78.348968968000008, 78.377843040500011, 78.406713921999994, 78.435581612500016,
+	78.464446112000005, 78.493307420500003, 78.522165537999996, 78.551020464500013,
+	78.579872200000011, 78.608720744500005, 78.637566097999994, 78.666408260500006,
+	78.695247232, 78.724083012500003, 78.752915602000002, 78.78174500050001,
+	78.810571207999999, 78.839394224499998, 78.868214050000006, 78.89703068450001,
+	78.925844127999994, 78.954654380500003, 78.983461442000007, 79.012265312500006,
+	79.041065992, 79.069863480500004, 79.098657778000003, 79.127448884500012,
+	79.156236800000002, 79.185021524500002, 79.213803058000011, 79.242581400500001,
+	79.271356552, 79.300128512500009, 79.328897282, 79.3576628605,
+	79.386425247999995, 79.415184444500014, 79.443940449999999, 79.472693264499995,
+	79.501442888, 79.530189320500014, 79.558932561999995, 79.5876726125,
+	79.616409472000015, 79.645143140500011, 79.673873618000002, 79.702600904500002,
+	79.731325000000012, 79.760045904500004, 79.788763618000004, 79.8174781405,
+	79.846189472000006, 79.874897612500007, 79.903602562000003, 79.932304320499995,
+	79.96100288800001, 79.989698264500007, 80.018390449999998, 80.047079444500014,
+	80.07576524800001, 80.104447860500002, 80.133127282000004, 80.161803512500015,
+	80.190476552000007, 80.219146400499994, 80.247813057999991, 80.276476524500012,
+	80.3051368, 80.333793884499997, 80.362447778000018, 80.391098480500006,
+	80.419745992000003, 80.448390312499996, 80.477031442000012, 80.505669380500009,
+	80.534304128000002, 80.562935684500005, 80.591564050000002, 80.62018922450001,
+	80.648811207999998, 80.677430000499996, 80.706045602000003, 80.734658012500006,
+	80.763267232000004, 80.791873260500012, 80.820476098, 80.849075744499999,
+	80.877672200000006, 80.906265464500009, 80.934855538000008, 80.963442420500002,
+	80.992026111999991, 81.020606612500004, 81.049183921999997, 81.077758040500001,
+	81.106328968000014, 81.134896704500008, 81.163461249999997, 81.192022604499996,
+	81.220580768000005, 81.249135740500009, 81.277687522000008, 81.306236112500002,
+	81.334781512000006, 81.363323720500006, 81.391862738, 81.420398564500005,
+	81.448931200000004, 81.477460644499999, 81.505986898000003, 81.534509960500003,
+	81.563029832000012, 81.591546512500003, 81.620060002000002, 81.648570300500012,
+	81.677077408000002, 81.705581324500002, 81.734082049999998, 81.762579584500003,
+	81.791073928000003, 81.819565080499999, 81.848053042000004, 81.876537812500004,
+	81.905019392, 81.933497780500005, 81.961972978000006, 81.990444984500002,
+	82.018913800000007, 82.047379424499994, 82.075841858000004, 82.10430110050001,
+	82.132757151999996, 82.161210012499993, 82.189659682000013, 82.2181061605,
+	82.246549447999996, 82.274989544500016, 82.303426450000003, 82.3318601645,
+	82.360290687999992, 82.388718020500008, 82.417142162000005, 82.445563112499997,
+	82.473980871999998, 82.50239544050001, 82.530806818000002, 82.559215004500004,
+	82.587620000000015, 82.616021804500008, 82.64442041800001, 82.672815840499993,
+	82.701208072000014, 82.729597112500002, 82.757982962, 82.786365620499993,
+	82.814745088000009, 82.843121364500007, 82.87149445, 82.899864344500003,
+	82.928231048000015, 82.956594560500008, 82.984954881999997, 83.013312012500009,
+	83.041665952000002, 83.070016700500005, 83.098364258000004, 83.126708624500012,
+	83.1550498, 83.183387784499999, 83.211722577999993, 83.24005418050001,
+	83.268382592000009, 83.296707812500003, 83.325029842000006, 83.353348680500005,
+	83.381664327999999, 83.409976784500003, 83.438286050000016, 83.466592124500011,
+	83.494895008, 83.523194700499999, 83.551491202000008, 83.579784512499998,
+	83.608074631999997, 83.636361560499992, 83.664645298000011, 83.69292584450001,
+	83.721203200000005, 83.749477364500009, 83.777748338000009, 83.806016120500004,
+	83.834280711999995, 83.862542112500009, 83.890800322000004, 83.919055340499995,
+	83.947307167999995, 83.975555804500004, 84.003801250000009, 84.032043504499995,
+	84.060282568000019, 84.08851844050001, 84.116751122000011, 84.144980612500007,
+	84.173206912000012, 84.201430020500013, 84.229649938000009, 84.2578666645,
+	84.286080200000015, 84.314290544500011, 84.342497698000003, 84.370701660500004,
+	84.398902432, 84.427100012500006, 84.455294402000007, 84.483485600500018,
+	84.511673608000009, 84.539858424500011, 84.568040050000008, 84.596218484500014,
+	84.624393728000001, 84.652565780499998, 84.680734642000004, 84.708900312500006,
+	84.737062792000003, 84.765222080499996, 84.793378177999998, 84.821531084500009,
+	84.849680800000002, 84.877827324500004, 84.905970658000015, 84.934110800500008,
+	84.962247751999996, 84.990381512499994, 85.018512082000001, 85.046639460500003,
+	85.074763648000001, 85.102884644499994, 85.131002450000011, 85.159117064500009,
+	85.187228488000002, 85.215336720500005, 85.243441762000003, 85.271543612499997,
+	85.299642272, 85.327737740500012, 85.355830018000006, 85.383919104499995,
+	85.412004999999994, 85.440087704500002, 85.468167218000005, 85.496243540500004,
+	85.524316671999998, 85.552386612500015, 85.580453362, 85.608516920499994,
+	85.636577288000012, 85.664634464500011, 85.692688450000006, 85.720739244499995,
+	85.748786848000009, 85.776831260500003, 85.804872482000007, 85.832910512499993,
+	85.860945352000016, 85.888977000500006, 85.917005458000006, 85.945030724500015,
+	85.973052800000005, 86.001071684500005, 86.029087378, 86.057099880500004,
+	86.085109192000004, 86.1131153125, 86.141118242000005, 86.169117980500005,
+	86.197114528, 86.225107884500005, 86.253098049999991, 86.281085024500015,
+	86.309068808000006, 86.337049400500007, 86.365026802000017, 86.393001012500008,
+	86.420972032000009, 86.448939860500005, 86.47690449800001, 86.504865944500011,
+	86.532824200000007, 86.560779264499999, 86.588731138000014, 86.616679820500011,
+	86.644625312000002, 86.672567612500018, 86.700506722, 86.728442640500006,
+	86.756375367999993, 86.784304904500004, 86.812231250000011, 86.840154404499998,
+	86.868074367999995, 86.895991140500001, 86.923904722000003, 86.9518151125,
+	86.979722311999993, 87.007626320500009, 87.035527138000006, 87.063424764499999,
+	87.091319200000015, 87.119210444500013, 87.147098498000005, 87.174983360499994,
+	87.202865032000005, 87.230743512500013, 87.258618802000001, 87.286490900499999,
+	87.314359808000006, 87.342225524500009, 87.370088050000007, 87.397947384500014,
+	87.425803528000003, 87.453656480500001, 87.481506241999995, 87.509352812500012,
+	87.53719619200001, 87.565036380500004, 87.592873378000007, 87.620707184500006,
+	87.6485378, 87.676365224500003, 87.704189458000002, 87.73201050050001,
+	87.759828352, 87.787643012499998, 87.815454482000007, 87.843262760500011,
+	87.871067847999996, 87.898869744500004, 87.926668450000008, 87.954463964500007,
+	87.982256288000002, 88.010045420499992, 88.037831362000006, 88.0656141125,
+	88.093393672000005, 88.121170040500004, 88.148943218000014, 88.176713204500004,
+	88.204480000000004, 88.232243604500013, 88.260004018000004, 88.287761240500004,
+	88.315515271999999, 88.343266112500004, 88.371013762000004, 88.3987582205,
+	88.42649948799999, 88.454237564500005, 88.481972450000001, 88.509704144500006,
+	88.537432648000006, 88.565157960500002, 88.592880082000008, 88.620599012499994,
+	88.648314752000005, 88.67602730050001, 88.703736657999997, 88.731442824499993,
+	88.759145800000013, 88.7868455845, 88.814542177999996, 88.842235580500017,
+	88.869925792000004, 88.8976128125, 88.925296642000006, 88.952977280500008,
+	88.980654728000005, 89.008328984499997, 89.036000049999998, 89.06366792450001,
+	89.091332608000002, 89.118994100500004, 89.146652402000001, 89.174307512500008,
+	89.20195943200001, 89.229608160499993, 89.257253698000014, 89.284896044500002,
+	89.312535199999999, 89.340171164500006, 89.367803938000009, 89.395433520500006,
+	89.423059911999999, 89.450683112500002, 89.478303122000014, 89.505919940500007,
+	89.533533567999996, 89.561144004500008, 89.588751250000016, 89.616355304500004,
+	89.643956168000003, 89.67155384050001, 89.699148322000013, 89.726739612499998,
+	89.754327711999991, 89.781912620500009, 89.809494338000007, 89.837072864500001,
+	89.864648200000005, 89.892220344500004, 89.919789298000012, 89.947355060500001,
+	89.974917632000015, 90.002477012500009, 90.030033201999998, 90.057586200499998,
+	90.085136008000006, 90.11268262450001, 90.140226049999995, 90.167766284500004,
+	90.195303328000008, 90.222837180500008, 90.250367842000003, 90.277895312499993,
+	90.305419592000007, 90.332940680500002, 90.360458577999992, 90.387973284500006,
+	90.415484800000002, 90.442993124500006, 90.470498257999992, 90.498000200500016,
+	90.525498952000007, 90.552994512500007, 90.580486882000002, 90.607976060500008,
+	90.635462048000008, 90.662944844500004, 90.690424450000009, 90.71790086450001,
+	90.745374088000005, 90.772844120499997, 90.800310962000012, 90.827774612500008,
+	90.855235071999999, 90.8826923405, 90.910146418000011, 90.937597304500002,
+	90.965045000000003, 90.9924895045, 91.019930818000006, 91.047368940500007,
+	91.074803872000004, 91.10223561250001, 91.129664162000012, 91.157089520500008,
+	91.184511688000001, 91.211930664500017, 91.239346449999999, 91.266759044500006,
+	91.294168447999994, 91.321574660500005, 91.348977681999997, 91.3763775125,
+	91.403774152000011, 91.431167600500004, 91.458557858000006, 91.485944924500004,
+	91.513328800000011, 91.540709484500013, 91.568086977999997, 91.595461280500004,
+	91.622832392000007, 91.650200312500004, 91.677565041999998, 91.7049265805,
+	91.732284928000013, 91.759640084500006, 91.786992050000009, 91.814340824500007,
+	91.841686408000015, 91.869028800500004, 91.896368002000003, 91.923704012500011,
+	91.951036832, 91.978366460499998, 92.005692898000007, 92.03301614450001,
+	92.060336200000009, 92.087653064500003, 92.114966738000007, 92.142277220500006,
+	92.169584512, 92.196888612500004, 92.224189522000017, 92.251487240500012,
+	92.278781768000002, 92.306073104500001, 92.33336125000001, 92.3606462045,
+	92.387927968, 92.415206540499995, 92.442481922000013, 92.469754112499999,
+	92.497023112000008, 92.524288920500013, 92.551551538000012, 92.578810964500008,
+	92.606067199999998, 92.633320244500013, 92.660570098000008, 92.687816760499999,
+	92.715060231999999, 92.742300512500009, 92.769537602000014, 92.7967715005,
+	92.82400220800001, 92.851229724500001, 92.878454050000002, 92.905675184499998,
+	92.932893128000018, 92.960107880500004, 92.987319442, 93.014527812500006,
+	93.041732992000007, 93.068934980500003, 93.096133777999995, 93.123329384499996,
+	93.150521800000007, 93.177711024499999, 93.204897058, 93.232079900500011,
+	93.259259552000003, 93.286436012500005, 93.313609282000002, 93.340779360500008,
+	93.36794624800001, 93.395109944500007, 93.422270449999999, 93.449427764500015,
+	93.476581888000013, 93.503732820500005, 93.530880562000007, 93.558025112500005,
+	93.585166471999997, 93.6123046405, 93.639439618000011, 93.666571404500004,
+	93.693700000000007, 93.720825404500005, 93.747947618000012, 93.7750666405,
+	93.802182471999998, 93.829295112500006, 93.856404562000009, 93.883510820500007,
+	93.910613888, 93.937713764500018, 93.964810450000016, 93.991903944499995,
+	94.018994247999998, 94.046081360500011, 94.073165282000005, 94.100246012500008,
+	94.127323551999993, 94.154397900500015, 94.181469058000005, 94.208537024500004,
+	94.235601800000012, 94.262663384500001, 94.289721778000001, 94.316776980500009,
+	94.343828992000013, 94.370877812500012, 94.397923442000007, 94.424965880499997,
+	94.45200512800001, 94.479041184500005, 94.506074049999995, 94.533103724499995,
+	94.560130208000004, 94.587153500500008, 94.614173601999994, 94.641190512500017,
+	94.668204232000008, 94.695214760500008, 94.722222098000003, 94.749226244500008,
+	94.776227200000008, 94.803224964500004, 94.830219537999994, 94.857210920500009,
+	94.884199112000005, 94.911184112499996, 94.93816592200001, 94.965144540500006,
+	94.992119967999997, 95.019092204499998, 95.046061250000008, 95.073027104499999,
+	95.099989768, 95.126949240499997, 95.153905522000017, 95.180858612500003,
+	95.207808512, 95.234755220500006, 95.261698738000007, 95.288639064500003,
+	95.315576199999995, 95.342510144500011, 95.369440898000008, 95.3963684605,
+	95.423292832000001, 95.450214012500012, 95.477132002000005, 95.504046800500006,
+	95.530958408000004, 95.55786682450001, 95.584772049999998, 95.611674084500009,
+	95.638572928000002, 95.665468580500004, 95.692361042000002, 95.719250312500009,
+	95.746136392000011, 95.773019280500009, 95.799898978000002, 95.826775484500004,
+	95.853648800000016, 95.880518924500009, 95.907385857999998, 95.934249600499996,
+	95.961110152000003, 95.987967512500006, 96.014821682000004, 96.041672660500012,
+	96.068520448000015, 96.095365044499999, 96.122206450000007, 96.149044664500011,
+	96.175879688000009, 96.202711520500003, 96.229540162000006, 96.256365612500019,
+	96.283187872000013, 96.310006940500003, 96.336822818000002, 96.36363550450001,
+	96.390445, 96.417251304499999, 96.444054418000007, 96.470854340500011,
+	96.497651072000011, 96.524444612500005, 96.551234962000009, 96.578022120500009,
+	96.604806088000004, 96.631586864499994, 96.658364450000008, 96.685138844500003,
+	96.711910048000007, 96.738678060500007, 96.765442882000002, 96.792204512500007,
+	96.818962952000007, 96.845718200500016, 96.872470258000007, 96.899219124500007,
+	96.925964800000003, 96.952707284500008, 96.979446578000008, 97.006182680500004,
+	97.032915591999995, 97.05964531250001, 97.086371842000005, 97.113095180499997,
+	97.139815328000012, 97.166532284500008, 97.193246049999999, 97.2199566245,
+	97.24666400800001, 97.273368200500002, 97.300069202000003, 97.3267670125,
+	97.353461632000005, 97.380153060500007, 97.406841298000003, 97.433526344500009,
+	97.460208200000011, 97.486886864500008, 97.513562338, 97.540234620500016,
+	97.566903712000013, 97.593569612500005, 97.620232321999993, 97.646891840500018,
+	97.673548168000011, 97.700201304499998, 97.726851249999996, 97.753498004500017,
+	97.780141568000005, 97.806781940500002, 97.833419122000009, 97.860053112500012,
+	97.886683912000009, 97.913311520500002, 97.939935938000005, 97.966557164500003,
+	97.993175199999996, 98.019790044499999, 98.046401698000011, 98.073010160500004,
+	98.099615432000007, 98.126217512500006, 98.152816402000013, 98.179412100500002,
+	98.206004608000001, 98.232593924500009, 98.259180050000012, 98.28576298450001,
+	98.312342728000004, 98.338919280500008, 98.365492642000007, 98.392062812500001,
+	98.41862979199999, 98.445193580500018, 98.471754177999998, 98.498311584500001,
+	98.524865800000015, 98.551416824500009, 98.577964658000013, 98.604509300499998,
+	98.631050752000007, 98.657589012500011, 98.684124082000011, 98.710655960499992,
+	98.73718464800001, 98.76371014450001, 98.790232450000005, 98.816751564500009,
+	98.843267488000009, 98.869780220500004, 98.896289762000009, 98.922796112500009,
+	98.949299272000005, 98.97579924050001, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100
+};
+
+static const float temperhum_sht1x_compensation_12[4096] = {
+	0.00999999978f, 0.0100799995f, 0.0101600001f, 0.0102399997f,
+	0.0103199994f, 0.0104f, 0.0104799997f, 0.0105599994f,
+	0.01064f, 0.0107199997f, 0.0107999993f, 0.01088f,
+	0.0109599996f, 0.0110400002f, 0.0111199999f, 0.0111999996f,
+	0.0112800002f, 0.0113599999f, 0.0114399996f, 0.0115200002f,
+	0.0115999999f, 0.0116799995f, 0.0117600001f, 0.0118399998f,
+	0.0119199995f, 0.0120000001f, 0.0120799998f, 0.0121599995f,
+	0.0122400001f, 0.0123199997f, 0.0123999994f, 0.01248f,
+	0.0125599997f, 0.0126399994f, 0.01272f, 0.0127999997f,
+	0.0128799994f, 0.01296f, 0.0130399996f, 0.0131199993f,
+	0.0131999999f, 0.0132799996f, 0.0133599993f, 0.0134399999f,
+	0.0135199996f, 0.0135999992f, 0.0136799999f, 0.0137599995f,
+	0.0138399992f, 0.0139199998f, 0.0139999995f, 0.0140799992f,
+	0.0141599998f, 0.0142399995f, 0.0143199991f, 0.0143999998f,
+	0.0144799994f, 0.0145599991f, 0.0146399997f, 0.0147200003f,
+	0.0147999991f, 0.0148799997f, 0.0149600003f, 0.015039999f,
+	0.0151199996f, 0.0152000003f, 0.015279999f, 0.0153599996f,
+	0.0154400002f, 0.015519999f, 0.0155999996f, 0.0156800002f,
+	0.0157600008f, 0.0158399995f, 0.0159200002f, 0.0159999989f,
+	0.0160799995f, 0.0161600001f, 0.0162400007f, 0.0163199995f,
+	0.0164000001f, 0.0164799988f, 0.0165599994f, 0.01664f,
+	0.0167200007f, 0.0167999994f, 0.01688f, 0.0169599988f,
+	0.0170399994f, 0.01712f, 0.0172000006f, 0.0172799993f,
+	0.0173599999f, 0.0174399987f, 0.0175199993f, 0.0175999999f,
+	0.0176800005f, 0.0177599993f, 0.0178399999f, 0.0179199986f,
+	0.0179999992f, 0.0180799998f, 0.0181600004f, 0.0182399992f,
+	0.0183199998f, 0.0183999985f, 0.0184799992f, 0.0185599998f,
+	0.0186400004f, 0.0187199991f, 0.0187999997f, 0.0188799985f,
+	0.0189599991f, 0.0190399997f, 0.0191200003f, 0.0192000009f,
+	0.0192799997f, 0.0193599984f, 0.019439999f, 0.0195199996f,
+	0.0196000002f, 0.0196800008f, 0.0197599996f, 0.0198399983f,
+	0.0199199989f, 0.0199999996f, 0.0200800002f, 0.0201600008f,
+	0.0202399995f, 0.0203199983f, 0.0203999989f, 0.0204799995f,
+	0.0205600001f, 0.0206400007f, 0.0207199994f, 0.0207999982f,
+	0.0208799988f, 0.0209599994f, 0.02104f, 0.0211200006f,
+	0.0211999994f, 0.0212799981f, 0.0213599987f, 0.0214399993f,
+	0.02152f, 0.0216000006f, 0.0216799993f, 0.0217599999f,
+	0.0218399987f, 0.0219199993f, 0.0219999999f, 0.0220800005f,
+	0.0221599992f, 0.0222399998f, 0.0223199986f, 0.0223999992f,
+	0.0224799998f, 0.0225600004f, 0.0226399992f, 0.0227199998f,
+	0.0227999985f, 0.0228799991f, 0.0229599997f, 0.0230400003f,
+	0.0231199991f, 0.0231999997f, 0.0232799985f, 0.0233599991f,
+	0.0234399997f, 0.0235200003f, 0.023599999f, 0.0236799996f,
+	0.0237599984f, 0.023839999f, 0.0239199996f, 0.0240000002f,
+	0.024079999f, 0.0241599996f, 0.0242399983f, 0.0243199989f,
+	0.0243999995f, 0.0244800001f, 0.0245600007f, 0.0246399995f,
+	0.0247199982f, 0.0247999988f, 0.0248799995f, 0.0249600001f,
+	0.0250400007f, 0.0251199994f, 0.0251999982f, 0.0252799988f,
+	0.0253599994f, 0.02544f, 0.0255200006f, 0.0255999994f,
+	0.02568f, 0.0257599987f, 0.0258399993f, 0.0259199999f,
+	0.0259999987f, 0.0260799993f, 0.0261599999f, 0.0262399986f,
+	0.0263199992f, 0.0263999999f, 0.0264799986f, 0.0265599992f,
+	0.0266399998f, 0.0267199986f, 0.0267999992f, 0.0268799998f,
+	0.0269599985f, 0.0270399991f, 0.0271199998f, 0.0271999985f,
+	0.0272799991f, 0.0273599997f, 0.0274399985f, 0.0275199991f,
+	0.0275999997f, 0.0276799984f, 0.027759999f, 0.0278399996f,
+	0.0279199984f, 0.027999999f, 0.0280799996f, 0.0281600002f,
+	0.028239999f, 0.0283199996f, 0.0284000002f, 0.0284799989f,
+	0.0285599995f, 0.0286400001f, 0.0287199989f, 0.0287999995f,
+	0.0288800001f, 0.0289599989f, 0.0290399995f, 0.0291200001f,
+	0.0291999988f, 0.0292799994f, 0.02936f, 0.0294399988f,
+	0.0295199994f, 0.0296f, 0.0296799988f, 0.0297599994f,
+	0.02984f, 0.0299199987f, 0.0299999993f, 0.0300799999f,
+	0.0301599987f, 0.0302399993f, 0.0303199999f, 0.0303999986f,
+	0.0304799993f, 0.0305599999f, 0.0306399986f, 0.0307199992f,
+	0.0307999998f, 0.0308799986f, 0.0309599992f, 0.0310399998f,
+	0.0311199985f, 0.0311999992f, 0.0312799998f, 0.0313600004f,
+	0.0314399973f, 0.0315200016f, 0.0315999985f, 0.0316799991f,
+	0.0317599997f, 0.0318399966f, 0.0319200009f, 0.0319999978f,
+	0.0320799984f, 0.032159999f, 0.0322399996f, 0.0323200002f,
+	0.0323999971f, 0.0324800014f, 0.0325599983f, 0.0326399989f,
+	0.0327199996f, 0.0327999964f, 0.0328800008f, 0.0329599977f,
+	0.033040002f, 0.0331199989f, 0.0331999995f, 0.0332800001f,
+	0.033359997f, 0.0334400013f, 0.0335199982f, 0.0335999988f,
+	0.0336799994f, 0.03376f, 0.0338400006f, 0.0339199975f,
+	0.0340000018f, 0.0340799987f, 0.0341599993f, 0.0342399999f,
+	0.0343199968f, 0.0344000012f, 0.0344799981f, 0.0345599987f,
+	0.0346399993f, 0.0347199999f, 0.0348000005f, 0.0348799974f,
+	0.0349600017f, 0.0350399986f, 0.0351199992f, 0.0351999998f,
+	0.0352799967f, 0.035360001f, 0.0354399979f, 0.0355199985f,
+	0.0355999991f, 0.0356799997f, 0.0357600003f, 0.0358399972f,
+	0.0359200016f, 0.0359999985f, 0.0360799991f, 0.0361599997f,
+	0.0362399966f, 0.0363200009f, 0.0363999978f, 0.0364799984f,
+	0.036559999f, 0.0366399996f, 0.0367200002f, 0.0367999971f,
+	0.0368800014f, 0.0369599983f, 0.0370399989f, 0.0371199995f,
+	0.0371999964f, 0.0372800007f, 0.0373599976f, 0.0374399982f,
+	0.0375199988f, 0.0375999995f, 0.0376800001f, 0.037759997f,
+	0.0378400013f, 0.0379199982f, 0.0379999988f, 0.0380799994f,
+	0.0381599963f, 0.0382400006f, 0.0383199975f, 0.0384000018f,
+	0.0384799987f, 0.0385599993f, 0.0386399999f, 0.0387199968f,
+	0.0388000011f, 0.038879998f, 0.0389599986f, 0.0390399992f,
+	0.0391199999f, 0.0392000005f, 0.0392799973f, 0.0393600017f,
+	0.0394399986f, 0.0395199992f, 0.0395999998f, 0.0396799967f,
+	0.039760001f, 0.0398399979f, 0.0399199985f, 0.0399999991f,
+	0.0400799997f, 0.0401600003f, 0.0402399972f, 0.0403200015f,
+	0.0403999984f, 0.040479999f, 0.0405599996f, 0.0406399965f,
+	0.0407200009f, 0.0407999977f, 0.0408799984f, 0.040959999f,
+	0.0410399996f, 0.0411200002f, 0.0411999971f, 0.0412800014f,
+	0.0413599983f, 0.0414400026f, 0.0415199995f, 0.0415999964f,
+	0.0416800007f, 0.0417599976f, 0.0418400019f, 0.0419199988f,
+	0.0419999957f, 0.04208f, 0.0421599969f, 0.0422400013f,
+	0.0423199981f, 0.0424000025f, 0.0424799994f, 0.0425599962f,
+	0.0426400006f, 0.0427199975f, 0.0428000018f, 0.0428799987f,
+	0.0429599956f, 0.0430399999f, 0.0431199968f, 0.0432000011f,
+	0.043279998f, 0.0433600023f, 0.0434399992f, 0.0435199961f,
+	0.0436000004f, 0.0436799973f, 0.0437600017f, 0.0438399985f,
+	0.0439199954f, 0.0439999998f, 0.0440799966f, 0.044160001f,
+	0.0442399979f, 0.0443200022f, 0.0443999991f, 0.044479996f,
+	0.0445600003f, 0.0446399972f, 0.0447200015f, 0.0447999984f,
+	0.0448799953f, 0.0449599996f, 0.0450399965f, 0.0451200008f,
+	0.0451999977f, 0.0452800021f, 0.0453599989f, 0.0454399958f,
+	0.0455200002f, 0.045599997f, 0.0456800014f, 0.0457599983f,
+	0.0458399951f, 0.0459199995f, 0.0459999964f, 0.0460800007f,
+	0.0461599976f, 0.0462400019f, 0.0463199988f, 0.0463999957f,
+	0.04648f, 0.0465599969f, 0.0466400012f, 0.0467199981f,
+	0.0468000025f, 0.0468799993f, 0.0469599962f, 0.0470400006f,
+	0.0471199974f, 0.0472000018f, 0.0472799987f, 0.0473599955f,
+	0.0474399999f, 0.0475199968f, 0.0476000011f, 0.047679998f,
+	0.0477600023f, 0.0478399992f, 0.0479199961f, 0.0480000004f,
+	0.0480799973f, 0.0481600016f, 0.0482399985f, 0.0483199954f,
+	0.0483999997f, 0.0484799966f, 0.048560001f, 0.0486399978f,
+	0.0487200022f, 0.0487999991f, 0.0488799959f, 0.0489600003f,
+	0.0490399972f, 0.0491200015f, 0.0491999984f, 0.0492799953f,
+	0.0493599996f, 0.0494399965f, 0.0495200008f, 0.0495999977f,
+	0.049680002f, 0.0497599989f, 0.0498399958f, 0.0499200001f,
+	0.049999997f, 0.0500800014f, 0.0501599982f, 0.0502399951f,
+	0.0503199995f, 0.0503999963f, 0.0504800007f, 0.0505599976f,
+	0.0506400019f, 0.0507199988f, 0.0507999957f, 0.05088f,
+	0.0509599969f, 0.0510400012f, 0.0511199981f, 0.0512000024f,
+	0.0512799993f, 0.0513599962f, 0.0514400005f, 0.0515199974f,
+	0.0516000018f, 0.0516799986f, 0.0517599955f, 0.0518399999f,
+	0.0519199967f, 0.0520000011f, 0.052079998f, 0.0521600023f,
+	0.0522399992f, 0.0523199961f, 0.0524000004f, 0.0524799973f,
+	0.0525600016f, 0.0526399985f, 0.0527199954f, 0.0527999997f,
+	0.0528799966f, 0.0529600009f, 0.0530399978f, 0.0531200022f,
+	0.053199999f, 0.0532799959f, 0.0533600003f, 0.0534399971f,
+	0.0535200015f, 0.0535999984f, 0.0536799952f, 0.0537599996f,
+	0.0538399965f, 0.0539200008f, 0.0539999977f, 0.054080002f,
+	0.0541599989f, 0.0542399958f, 0.0543200001f, 0.054399997f,
+	0.0544800013f, 0.0545599982f, 0.0546399951f, 0.0547199994f,
+	0.0547999963f, 0.0548800007f, 0.0549599975f, 0.0550400019f,
+	0.0551199988f, 0.0551999956f, 0.05528f, 0.0553599969f,
+	0.0554400012f, 0.0555199981f, 0.055599995f, 0.0556799993f,
+	0.0557599962f, 0.0558400005f, 0.0559199974f, 0.0560000017f,
+	0.0560799986f, 0.0561599955f, 0.0562399998f, 0.0563199967f,
+	0.056400001f, 0.0564799979f, 0.0565600023f, 0.0566399992f,
+	0.056719996f, 0.0568000004f, 0.0568799973f, 0.0569600016f,
+	0.0570399985f, 0.0571199954f, 0.0571999997f, 0.0572799966f,
+	0.0573600009f, 0.0574399978f, 0.0575200021f, 0.057599999f,
+	0.0576799959f, 0.0577600002f, 0.0578399971f, 0.0579200014f,
+	0.0579999983f, 0.0580799952f, 0.0581599995f, 0.0582399964f,
+	0.0583200008f, 0.0583999977f, 0.058480002f, 0.0585599989f,
+	0.0586399958f, 0.0587200001f, 0.058799997f, 0.0588800013f,
+	0.0589599982f, 0.0590399951f, 0.0591199994f, 0.0591999963f,
+	0.0592800006f, 0.0593599975f, 0.0594400018f, 0.0595199987f,
+	0.0595999956f, 0.0596799999f, 0.0597599968f, 0.0598400012f,
+	0.059919998f, 0.0599999949f, 0.0600799993f, 0.0601599962f,
+	0.0602400005f, 0.0603199974f, 0.0604000017f, 0.0604799986f,
+	0.0605599955f, 0.0606399998f, 0.0607199967f, 0.060800001f,
+	0.0608799979f, 0.0609599948f, 0.0610399991f, 0.061119996f,
+	0.0612000003f, 0.0612799972f, 0.0613600016f, 0.0614399984f,
+	0.0615199953f, 0.0615999997f, 0.0616799966f, 0.0617600009f,
+	0.0618399978f, 0.0619200021f, 0.061999999f, 0.0620799959f,
+	0.0621600002f, 0.0622399971f, 0.0623200014f, 0.0623999983f,
+	0.0624799952f, 0.0625599995f, 0.0626399964f, 0.0627200007f,
+	0.0627999976f, 0.062880002f, 0.0629599988f, 0.0630399957f,
+	0.0631200001f, 0.0631999969f, 0.0632800013f, 0.0633599982f,
+	0.0634399951f, 0.0635199994f, 0.0635999963f, 0.0636800006f,
+	0.0637599975f, 0.0638400018f, 0.0639199987f, 0.0639999956f,
+	0.0640799999f, 0.0641599968f, 0.0642400011f, 0.064319998f,
+	0.0643999949f, 0.0644799992f, 0.0645599961f, 0.0646400005f,
+	0.0647199973f, 0.0648000017f, 0.0648799986f, 0.0649599954f,
+	0.0650399998f, 0.0651199967f, 0.065200001f, 0.0652799979f,
+	0.0653599948f, 0.0654399991f, 0.065519996f, 0.0656000003f,
+	0.0656799972f, 0.0657600015f, 0.0658399984f, 0.0659199953f,
+	0.0659999996f, 0.0660799965f, 0.0661600009f, 0.0662399977f,
+	0.0663199946f, 0.066399999f, 0.0664799958f, 0.0665600002f,
+	0.0666399971f, 0.0667200014f, 0.0667999983f, 0.0668799952f,
+	0.0669599995f, 0.0670399964f, 0.0671200007f, 0.0671999976f,
+	0.0672800019f, 0.0673599988f, 0.0674399957f, 0.06752f,
+	0.0675999969f, 0.0676800013f, 0.0677599981f, 0.067839995f,
+	0.0679199994f, 0.0679999962f, 0.0680800006f, 0.0681599975f,
+	0.0682400018f, 0.0683199987f, 0.0683999956f, 0.0684799999f,
+	0.0685599968f, 0.0686400011f, 0.068719998f, 0.0687999949f,
+	0.0688799992f, 0.0689599961f, 0.0690400004f, 0.0691199973f,
+	0.0692000017f, 0.0692799985f, 0.0693599954f, 0.0694399998f,
+	0.0695199966f, 0.069600001f, 0.0696799979f, 0.0697599947f,
+	0.0698399991f, 0.069919996f, 0.0700000003f, 0.0700799972f,
+	0.0701600015f, 0.0702399984f, 0.0703199953f, 0.0703999996f,
+	0.0704799965f, 0.0705600008f, 0.0706399977f, 0.0707199946f,
+	0.0707999989f, 0.0708799958f, 0.0709600002f, 0.071039997f,
+	0.0711200014f, 0.0711999983f, 0.0712799951f, 0.0713599995f,
+	0.0714399964f, 0.0715200007f, 0.0715999976f, 0.0716800019f,
+	0.0717599988f, 0.0718399957f, 0.07192f, 0.0719999969f,
+	0.0720800012f, 0.0721599981f, 0.072239995f, 0.0723199993f,
+	0.0723999962f, 0.0724800006f, 0.0725599974f, 0.0726399943f,
+	0.0727199987f, 0.0727999955f, 0.0728799999f, 0.0729599968f,
+	0.0730399936f, 0.073119998f, 0.0731999949f, 0.0732799992f,
+	0.0733599961f, 0.073439993f, 0.0735199973f, 0.0735999942f,
+	0.0736799985f, 0.0737599954f, 0.0738399997f, 0.0739199966f,
+	0.0739999935f, 0.0740799978f, 0.0741599947f, 0.0742399991f,
+	0.0743199959f, 0.0743999928f, 0.0744799972f, 0.074559994f,
+	0.0746399984f, 0.0747199953f, 0.0747999996f, 0.0748799965f,
+	0.0749599934f, 0.0750399977f, 0.0751199946f, 0.0751999989f,
+	0.0752799958f, 0.0753599927f, 0.075439997f, 0.0755199939f,
+	0.0755999982f, 0.0756799951f, 0.0757599995f, 0.0758399963f,
+	0.0759199932f, 0.0759999976f, 0.0760799944f, 0.0761599988f,
+	0.0762399957f, 0.0763199925f, 0.0763999969f, 0.0764799938f,
+	0.0765599981f, 0.076639995f, 0.0767199993f, 0.0767999962f,
+	0.0768799931f, 0.0769599974f, 0.0770399943f, 0.0771199986f,
+	0.0771999955f, 0.0772799999f, 0.0773599967f, 0.0774399936f,
+	0.077519998f, 0.0775999948f, 0.0776799992f, 0.0777599961f,
+	0.0778399929f, 0.0779199973f, 0.0779999942f, 0.0780799985f,
+	0.0781599954f, 0.0782399997f, 0.0783199966f, 0.0783999935f,
+	0.0784799978f, 0.0785599947f, 0.078639999f, 0.0787199959f,
+	0.0787999928f, 0.0788799971f, 0.078959994f, 0.0790399984f,
+	0.0791199952f, 0.0791999996f, 0.0792799965f, 0.0793599933f,
+	0.0794399977f, 0.0795199946f, 0.0795999989f, 0.0796799958f,
+	0.0797599927f, 0.079839997f, 0.0799199939f, 0.0799999982f,
+	0.0800799951f, 0.0801599994f, 0.0802399963f, 0.0803199932f,
+	0.0803999975f, 0.0804799944f, 0.0805599988f, 0.0806399956f,
+	0.0807199925f, 0.0807999969f, 0.0808799937f, 0.0809599981f,
+	0.081039995f, 0.0811199993f, 0.0811999962f, 0.0812799931f,
+	0.0813599974f, 0.0814399943f, 0.0815199986f, 0.0815999955f,
+	0.0816799924f, 0.0817599967f, 0.0818399936f, 0.0819199979f,
+	0.0819999948f, 0.0820799991f, 0.082159996f, 0.0822399929f,
+	0.0823199973f, 0.0823999941f, 0.0824799985f, 0.0825599954f,
+	0.0826399997f, 0.0827199966f, 0.0827999935f, 0.0828799978f,
+	0.0829599947f, 0.083039999f, 0.0831199959f, 0.0831999928f,
+	0.0832799971f, 0.083359994f, 0.0834399983f, 0.0835199952f,
+	0.0835999995f, 0.0836799964f, 0.0837599933f, 0.0838399976f,
+	0.0839199945f, 0.0839999989f, 0.0840799958f, 0.0841599926f,
+	0.084239997f, 0.0843199939f, 0.0843999982f, 0.0844799951f,
+	0.0845599994f, 0.0846399963f, 0.0847199932f, 0.0847999975f,
+	0.0848799944f, 0.0849599987f, 0.0850399956f, 0.0851199925f,
+	0.0851999968f, 0.0852799937f, 0.085359998f, 0.0854399949f,
+	0.0855199993f, 0.0855999961f, 0.085679993f, 0.0857599974f,
+	0.0858399943f, 0.0859199986f, 0.0859999955f, 0.0860799924f,
+	0.0861599967f, 0.0862399936f, 0.0863199979f, 0.0863999948f,
+	0.0864799991f, 0.086559996f, 0.0866399929f, 0.0867199972f,
+	0.0867999941f, 0.0868799984f, 0.0869599953f, 0.0870399997f,
+	0.0871199965f, 0.0871999934f, 0.0872799978f, 0.0873599946f,
+	0.087439999f, 0.0875199959f, 0.0875999928f, 0.0876799971f,
+	0.087759994f, 0.0878399983f, 0.0879199952f, 0.0879999995f,
+	0.0880799964f, 0.0881599933f, 0.0882399976f, 0.0883199945f,
+	0.0883999988f, 0.0884799957f, 0.0885599926f, 0.0886399969f,
+	0.0887199938f, 0.0887999982f, 0.088879995f, 0.0889599994f,
+	0.0890399963f, 0.0891199932f, 0.0891999975f, 0.0892799944f,
+	0.0893599987f, 0.0894399956f, 0.0895199925f, 0.0895999968f,
+	0.0896799937f, 0.089759998f, 0.0898399949f, 0.0899199992f,
+	0.0899999961f, 0.090079993f, 0.0901599973f, 0.0902399942f,
+	0.0903199986f, 0.0903999954f, 0.0904799923f, 0.0905599967f,
+	0.0906399935f, 0.0907199979f, 0.0907999948f, 0.0908799991f,
+	0.090959996f, 0.0910399929f, 0.0911199972f, 0.0911999941f,
+	0.0912799984f, 0.0913599953f, 0.0914399922f, 0.0915199965f,
+	0.0915999934f, 0.0916799977f, 0.0917599946f, 0.091839999f,
+	0.0919199958f, 0.0919999927f, 0.0920799971f, 0.0921599939f,
+	0.0922399983f, 0.0923199952f, 0.0923999995f, 0.0924799964f,
+	0.0925599933f, 0.0926399976f, 0.0927199945f, 0.0927999988f,
+	0.0928799957f, 0.0929599926f, 0.0930399969f, 0.0931199938f,
+	0.0931999981f, 0.093279995f, 0.0933599994f, 0.0934399962f,
+	0.0935199931f, 0.0935999975f, 0.0936799943f, 0.0937599987f,
+	0.0938399956f, 0.0939199924f, 0.0939999968f, 0.0940799937f,
+	0.094159998f, 0.0942399949f, 0.0943199992f, 0.0943999961f,
+	0.094479993f, 0.0945599973f, 0.0946399942f, 0.0947199985f,
+	0.0947999954f, 0.0948799923f, 0.0949599966f, 0.0950399935f,
+	0.0951199979f, 0.0951999947f, 0.0952799991f, 0.095359996f,
+	0.0954399928f, 0.0955199972f, 0.0955999941f, 0.0956799984f,
+	0.0957599953f, 0.0958399922f, 0.0959199965f, 0.0959999934f,
+	0.0960799977f, 0.0961599946f, 0.0962399989f, 0.0963199958f,
+	0.0963999927f, 0.096479997f, 0.0965599939f, 0.0966399983f,
+	0.0967199951f, 0.096799992f, 0.0968799964f, 0.0969599932f,
+	0.0970399976f, 0.0971199945f, 0.0971999988f, 0.0972799957f,
+	0.0973599926f, 0.0974399969f, 0.0975199938f, 0.0975999981f,
+	0.097679995f, 0.0977599993f, 0.0978399962f, 0.0979199931f,
+	0.0979999974f, 0.0980799943f, 0.0981599987f, 0.0982399955f,
+	0.0983199924f, 0.0983999968f, 0.0984799936f, 0.098559998f,
+	0.0986399949f, 0.0987199992f, 0.0987999961f, 0.098879993f,
+	0.0989599973f, 0.0990399942f, 0.0991199985f, 0.0991999954f,
+	0.0992799923f, 0.0993599966f, 0.0994399935f, 0.0995199978f,
+	0.0995999947f, 0.0996799991f, 0.0997599959f, 0.0998399928f,
+	0.0999199972f, 0.099999994f, 0.100079998f, 0.100159995f,
+	0.100239992f, 0.100319996f, 0.100399993f, 0.100479998f,
+	0.100559995f, 0.100639999f, 0.100719996f, 0.100799993f,
+	0.100879997f, 0.100959994f, 0.101039998f, 0.101119995f,
+	0.101199992f, 0.101279996f, 0.101359993f, 0.101439998f,
+	0.101519994f, 0.101599999f, 0.101679996f, 0.101759993f,
+	0.101839997f, 0.101919994f, 0.101999998f, 0.102079995f,
+	0.102159999f, 0.102239996f, 0.102319993f, 0.102399997f,
+	0.102479994f, 0.102559999f, 0.102639996f, 0.102719992f,
+	0.102799997f, 0.102879994f, 0.102959998f, 0.103039995f,
+	0.103119999f, 0.103199996f, 0.103279993f, 0.103359997f,
+	0.103439994f, 0.103519998f, 0.103599995f, 0.103679992f,
+	0.103759997f, 0.103839993f, 0.103919998f, 0.103999995f,
+	0.104079999f, 0.104159996f, 0.104239993f, 0.104319997f,
+	0.104399994f, 0.104479998f, 0.104559995f, 0.104639992f,
+	0.104719996f, 0.104799993f, 0.104879998f, 0.104959995f,
+	0.105039999f, 0.105119996f, 0.105199993f, 0.105279997f,
+	0.105359994f, 0.105439998f, 0.105519995f, 0.105599992f,
+	0.105679996f, 0.105759993f, 0.105839998f, 0.105919994f,
+	0.105999999f, 0.106079996f, 0.106159993f, 0.106239997f,
+	0.106319994f, 0.106399998f, 0.106479995f, 0.106559992f,
+	0.106639996f, 0.106719993f, 0.106799997f, 0.106879994f,
+	0.106959999f, 0.107039995f, 0.107119992f, 0.107199997f,
+	0.107279994f, 0.107359998f, 0.107439995f, 0.107519999f,
+	0.107599996f, 0.107679993f, 0.107759997f, 0.107839994f,
+	0.107919998f, 0.107999995f, 0.108079992f, 0.108159997f,
+	0.108239993f, 0.108319998f, 0.108399995f, 0.108479999f,
+	0.108559996f, 0.108639993f, 0.108719997f, 0.108799994f,
+	0.108879998f, 0.108959995f, 0.109039992f, 0.109119996f,
+	0.109199993f, 0.109279998f, 0.109359995f, 0.109439999f,
+	0.109519996f, 0.109599993f, 0.109679997f, 0.109759994f,
+	0.109839998f, 0.109919995f, 0.109999992f, 0.110079996f,
+	0.110159993f, 0.110239998f, 0.110319994f, 0.110399999f,
+	0.110479996f, 0.110559992f, 0.110639997f, 0.110719994f,
+	0.110799998f, 0.110879995f, 0.110959992f, 0.111039996f,
+	0.111119993f, 0.111199997f, 0.111279994f, 0.111359999f,
+	0.111439995f, 0.111519992f, 0.111599997f, 0.111679994f,
+	0.111759998f, 0.111839995f, 0.111919992f, 0.111999996f,
+	0.112079993f, 0.112159997f, 0.112239994f, 0.112319998f,
+	0.112399995f, 0.112479992f, 0.112559997f, 0.112639993f,
+	0.112719998f, 0.112799995f, 0.112879999f, 0.112959996f,
+	0.113039993f, 0.113119997f, 0.113199994f, 0.113279998f,
+	0.113359995f, 0.113439992f, 0.113519996f, 0.113599993f,
+	0.113679998f, 0.113759995f, 0.113839999f, 0.113919996f,
+	0.113999993f, 0.114079997f, 0.114159994f, 0.114239998f,
+	0.114319995f, 0.114399992f, 0.114479996f, 0.114559993f,
+	0.114639997f, 0.114719994f, 0.114799999f, 0.114879996f,
+	0.114959992f, 0.115039997f, 0.115119994f, 0.115199998f,
+	0.115279995f, 0.115359992f, 0.115439996f, 0.115519993f,
+	0.115599997f, 0.115679994f, 0.115759999f, 0.115839995f,
+	0.115919992f, 0.115999997f, 0.116079994f, 0.116159998f,
+	0.116239995f, 0.116319992f, 0.116399996f, 0.116479993f,
+	0.116559997f, 0.116639994f, 0.116719998f, 0.116799995f,
+	0.116879992f, 0.116959997f, 0.117039993f, 0.117119998f,
+	0.117199995f, 0.117279992f, 0.117359996f, 0.117439993f,
+	0.117519997f, 0.117599994f, 0.117679998f, 0.117759995f,
+	0.117839992f, 0.117919996f, 0.117999993f, 0.118079998f,
+	0.118159994f, 0.118239999f, 0.118319996f, 0.118399993f,
+	0.118479997f, 0.118559994f, 0.118639998f, 0.118719995f,
+	0.118799992f, 0.118879996f, 0.118959993f, 0.119039997f,
+	0.119119994f, 0.119199999f, 0.119279996f, 0.119359992f,
+	0.119439997f, 0.119519994f, 0.119599998f, 0.119679995f,
+	0.119759992f, 0.119839996f, 0.119919993f, 0.119999997f,
+	0.120079994f, 0.120159999f, 0.120239995f, 0.120319992f,
+	0.120399997f, 0.120479994f, 0.120559998f, 0.120639995f,
+	0.120719992f, 0.120799996f, 0.120879993f, 0.120959997f,
+	0.121039994f, 0.121119998f, 0.121199995f, 0.121279992f,
+	0.121359996f, 0.121439993f, 0.121519998f, 0.121599995f,
+	0.121679991f, 0.121759996f, 0.121839993f, 0.121919997f,
+	0.121999994f, 0.122079998f, 0.122159995f, 0.122239992f,
+	0.122319996f, 0.122399993f, 0.122479998f, 0.122559994f,
+	0.122639991f, 0.122719996f, 0.122799993f, 0.122879997f,
+	0.122959994f, 0.123039998f, 0.123119995f, 0.123199992f,
+	0.123279996f, 0.123359993f, 0.123439997f, 0.123519994f,
+	0.123599999f, 0.123679996f, 0.123759992f, 0.123839997f,
+	0.123919994f, 0.123999998f, 0.124079995f, 0.124159992f,
+	0.124239996f, 0.124319993f, 0.124399997f, 0.124479994f,
+	0.124559999f, 0.124639995f, 0.124719992f, 0.124799997f,
+	0.124879993f, 0.124959998f, 0.125039995f, 0.125119999f,
+	0.125200003f, 0.125279993f, 0.125359997f, 0.125440001f,
+	0.125520006f, 0.125599995f, 0.12568f, 0.125760004f,
+	0.125839993f, 0.125919998f, 0.126000002f, 0.126079991f,
+	0.126159996f, 0.12624f, 0.126320004f, 0.126399994f,
+	0.126479998f, 0.126560003f, 0.126639992f, 0.126719996f,
+	0.126800001f, 0.126880005f, 0.126959994f, 0.127039999f,
+	0.127120003f, 0.127199993f, 0.127279997f, 0.127360001f,
+	0.127440006f, 0.127519995f, 0.127599999f, 0.127680004f,
+	0.127759993f, 0.127839997f, 0.127920002f, 0.128000006f,
+	0.128079996f, 0.12816f, 0.128240004f, 0.128319994f,
+	0.128399998f, 0.128480002f, 0.128559992f, 0.128639996f,
+	0.12872f, 0.128800005f, 0.128879994f, 0.128959998f,
+	0.129040003f, 0.129119992f, 0.129199997f, 0.129280001f,
+	0.129360005f, 0.129439995f, 0.129519999f, 0.129600003f,
+	0.129679993f, 0.129759997f, 0.129840001f, 0.129920006f,
+	0.129999995f, 0.13008f, 0.130160004f, 0.130239993f,
+	0.130319998f, 0.130400002f, 0.130479991f, 0.130559996f,
+	0.13064f, 0.130720004f, 0.130799994f, 0.130879998f,
+	0.130960003f, 0.131039992f, 0.131119996f, 0.131200001f,
+	0.131280005f, 0.131359994f, 0.131439999f, 0.131520003f,
+	0.131599993f, 0.131679997f, 0.131760001f, 0.131840006f,
+	0.131919995f, 0.131999999f, 0.132080004f, 0.132159993f,
+	0.132239997f, 0.132320002f, 0.132399991f, 0.132479995f,
+	0.13256f, 0.132640004f, 0.132719994f, 0.132799998f,
+	0.132880002f, 0.132959992f, 0.133039996f, 0.13312f,
+	0.133200005f, 0.133279994f, 0.133359998f, 0.133440003f,
+	0.133519992f, 0.133599997f, 0.133680001f, 0.133760005f,
+	0.133839995f, 0.133919999f, 0.134000003f, 0.134079993f,
+	0.134159997f, 0.134240001f, 0.134320006f, 0.134399995f,
+	0.13448f, 0.134560004f, 0.134639993f, 0.134719998f,
+	0.134800002f, 0.134879991f, 0.134959996f, 0.13504f,
+	0.135120004f, 0.135200009f, 0.135279998f, 0.135360003f,
+	0.135440007f, 0.135519996f, 0.135600001f, 0.135680005f,
+	0.135760009f, 0.135839999f, 0.135920003f, 0.136000007f,
+	0.136079997f, 0.136160001f, 0.136240005f, 0.136319995f,
+	0.136399999f, 0.136480004f, 0.136560008f, 0.136639997f,
+	0.136720002f, 0.136800006f, 0.136879995f, 0.13696f,
+	0.137040004f, 0.137120008f, 0.137199998f, 0.137280002f,
+	0.137360007f, 0.137439996f, 0.13752f, 0.137600005f,
+	0.137680009f, 0.137759998f, 0.137840003f, 0.137920007f,
+	0.137999997f, 0.138080001f, 0.138160005f, 0.13824001f,
+	0.138319999f, 0.138400003f, 0.138480008f, 0.138559997f,
+	0.138640001f, 0.138720006f, 0.138799995f, 0.13888f,
+	0.138960004f, 0.139040008f, 0.139119998f, 0.139200002f,
+	0.139280006f, 0.139359996f, 0.13944f, 0.139520004f,
+	0.139600009f, 0.139679998f, 0.139760002f, 0.139840007f,
+	0.139919996f, 0.140000001f, 0.140080005f, 0.140160009f,
+	0.140239999f, 0.140320003f, 0.140400007f, 0.140479997f,
+	0.140560001f, 0.140640005f, 0.140719995f, 0.140799999f,
+	0.140880004f, 0.140960008f, 0.141039997f, 0.141120002f,
+	0.141200006f, 0.141279995f, 0.14136f, 0.141440004f,
+	0.141520008f, 0.141599998f, 0.141680002f, 0.141760007f,
+	0.141839996f, 0.14192f, 0.142000005f, 0.142080009f,
+	0.142159998f, 0.142240003f, 0.142320007f, 0.142399997f,
+	0.142480001f, 0.142560005f, 0.142639995f, 0.142719999f,
+	0.142800003f, 0.142880008f, 0.142959997f, 0.143040001f,
+	0.143120006f, 0.143199995f, 0.143279999f, 0.143360004f,
+	0.143440008f, 0.143519998f, 0.143600002f, 0.143680006f,
+	0.143759996f, 0.14384f, 0.143920004f, 0.144000009f,
+	0.144079998f, 0.144160002f, 0.144240007f, 0.144319996f,
+	0.144400001f, 0.144480005f, 0.144560009f, 0.144639999f,
+	0.144720003f, 0.144800007f, 0.144879997f, 0.144960001f,
+	0.145040005f, 0.145119995f, 0.145199999f, 0.145280004f,
+	0.145360008f, 0.145439997f, 0.145520002f, 0.145600006f,
+	0.145679995f, 0.14576f, 0.145840004f, 0.145920008f,
+	0.145999998f, 0.146080002f, 0.146160007f, 0.146239996f,
+	0.14632f, 0.146400005f, 0.146480009f, 0.146559998f,
+	0.146640003f, 0.146720007f, 0.146799996f, 0.146880001f,
+	0.146960005f, 0.147039995f, 0.147119999f, 0.147200003f,
+	0.147280008f, 0.147359997f, 0.147440001f, 0.147520006f,
+	0.147599995f, 0.147679999f, 0.147760004f, 0.147840008f,
+	0.147919998f, 0.148000002f, 0.148080006f, 0.148159996f,
+	0.14824f, 0.148320004f, 0.148400009f, 0.148479998f,
+	0.148560002f, 0.148640007f, 0.148719996f, 0.148800001f,
+	0.148880005f, 0.148960009f, 0.149039999f, 0.149120003f,
+	0.149200007f, 0.149279997f, 0.149360001f, 0.149440005f,
+	0.149519995f, 0.149599999f, 0.149680004f, 0.149760008f,
+	0.149839997f, 0.149920002f, 0.150000006f, 0.150079995f,
+	0.15016f, 0.150240004f, 0.150320008f, 0.150399998f,
+	0.150480002f, 0.150560006f, 0.150639996f, 0.15072f,
+	0.150800005f, 0.150880009f, 0.150959998f, 0.151040003f,
+	0.151120007f, 0.151199996f, 0.151280001f, 0.151360005f,
+	0.151439995f, 0.151519999f, 0.151600003f, 0.151680008f,
+	0.151759997f, 0.151840001f, 0.151920006f, 0.151999995f,
+	0.152079999f, 0.152160004f, 0.152240008f, 0.152319998f,
+	0.152400002f, 0.152480006f, 0.152559996f, 0.15264f,
+	0.152720004f, 0.152800009f, 0.152879998f, 0.152960002f,
+	0.153040007f, 0.153119996f, 0.153200001f, 0.153280005f,
+	0.153359994f, 0.153439999f, 0.153520003f, 0.153600007f,
+	0.153679997f, 0.153760001f, 0.153840005f, 0.153919995f,
+	0.153999999f, 0.154080003f, 0.154160008f, 0.154239997f,
+	0.154320002f, 0.154400006f, 0.154479995f, 0.15456f,
+	0.154640004f, 0.154720008f, 0.154799998f, 0.154880002f,
+	0.154960006f, 0.155039996f, 0.15512f, 0.155200005f,
+	0.155280009f, 0.155359998f, 0.155440003f, 0.155520007f,
+	0.155599996f, 0.155680001f, 0.155760005f, 0.155839995f,
+	0.155919999f, 0.156000003f, 0.156080008f, 0.156159997f,
+	0.156240001f, 0.156320006f, 0.156399995f, 0.156479999f,
+	0.156560004f, 0.156640008f, 0.156719998f, 0.156800002f,
+	0.156880006f, 0.156959996f, 0.15704f, 0.157120004f,
+	0.157200009f, 0.157279998f, 0.157360002f, 0.157440007f,
+	0.157519996f, 0.157600001f, 0.157680005f, 0.157759994f,
+	0.157839999f, 0.157920003f, 0.158000007f, 0.158079997f,
+	0.158160001f, 0.158240005f, 0.158319995f, 0.158399999f,
+	0.158480003f, 0.158560008f, 0.158639997f, 0.158720002f,
+	0.158800006f, 0.158879995f, 0.15896f, 0.159040004f,
+	0.159120008f, 0.159199998f, 0.159280002f, 0.159360006f,
+	0.159439996f, 0.15952f, 0.159600005f, 0.159680009f,
+	0.159759998f, 0.159840003f, 0.159920007f, 0.159999996f,
+	0.160080001f, 0.160160005f, 0.160239995f, 0.160319999f,
+	0.160400003f, 0.160480008f, 0.160559997f, 0.160640001f,
+	0.160720006f, 0.160799995f, 0.160879999f, 0.160960004f,
+	0.161040008f, 0.161119998f, 0.161200002f, 0.161280006f,
+	0.161359996f, 0.16144f, 0.161520004f, 0.161600009f,
+	0.161679998f, 0.161760002f, 0.161840007f, 0.161919996f,
+	0.162f, 0.162080005f, 0.162159994f, 0.162239999f,
+	0.162320003f, 0.162400007f, 0.162479997f, 0.162560001f,
+	0.162640005f, 0.162719995f, 0.162799999f, 0.162880003f,
+	0.162960008f, 0.163039997f, 0.163120002f, 0.163200006f,
+	0.163279995f, 0.16336f, 0.163440004f, 0.163520008f,
+	0.163599998f, 0.163680002f, 0.163760006f, 0.163839996f,
+	0.16392f, 0.164000005f, 0.164080009f, 0.164159998f,
+	0.164240003f, 0.164320007f, 0.164399996f, 0.164480001f,
+	0.164560005f, 0.164639995f, 0.164719999f, 0.164800003f,
+	0.164880008f, 0.164959997f, 0.165040001f, 0.165120006f,
+	0.165199995f, 0.165279999f, 0.165360004f, 0.165440008f,
+	0.165519997f, 0.165600002f, 0.165680006f, 0.165759996f,
+	0.16584f, 0.165920004f, 0.166000009f, 0.166079998f,
+	0.166160002f, 0.166240007f, 0.166319996f, 0.1664f,
+	0.166480005f, 0.166559994f, 0.166639999f, 0.166720003f,
+	0.166800007f, 0.166879997f, 0.166960001f, 0.167040005f,
+	0.167119995f, 0.167199999f, 0.167280003f, 0.167360008f,
+	0.167439997f, 0.167520002f, 0.167600006f, 0.167679995f,
+	0.16776f, 0.167840004f, 0.167920008f, 0.167999998f,
+	0.168080002f, 0.168160006f, 0.168239996f, 0.16832f,
+	0.168400005f, 0.168479994f, 0.168559998f, 0.168640003f,
+	0.168720007f, 0.168799996f, 0.168880001f, 0.168960005f,
+	0.169039994f, 0.169119999f, 0.169200003f, 0.169280007f,
+	0.169359997f, 0.169440001f, 0.169520006f, 0.169599995f,
+	0.169679999f, 0.169760004f, 0.169840008f, 0.169919997f,
+	0.170000002f, 0.170080006f, 0.170159996f, 0.17024f,
+	0.170320004f, 0.170400009f, 0.170479998f, 0.170560002f,
+	0.170640007f, 0.170719996f, 0.1708f, 0.170880005f,
+	0.170959994f, 0.171039999f, 0.171120003f, 0.171200007f,
+	0.171279997f, 0.171360001f, 0.171440005f, 0.171519995f,
+	0.171599999f, 0.171680003f, 0.171760008f, 0.171839997f,
+	0.171920002f, 0.172000006f, 0.172079995f, 0.17216f,
+	0.172240004f, 0.172320008f, 0.172399998f, 0.172480002f,
+	0.172560006f, 0.172639996f, 0.17272f, 0.172800004f,
+	0.172879994f, 0.172959998f, 0.173040003f, 0.173120007f,
+	0.173199996f, 0.173280001f, 0.173360005f, 0.173439994f,
+	0.173519999f, 0.173600003f, 0.173680007f, 0.173759997f,
+	0.173840001f, 0.173920006f, 0.173999995f, 0.174079999f,
+	0.174160004f, 0.174240008f, 0.174319997f, 0.174400002f,
+	0.174480006f, 0.174559996f, 0.17464f, 0.174720004f,
+	0.174800009f, 0.174879998f, 0.174960002f, 0.175040007f,
+	0.175119996f, 0.1752f, 0.175280005f, 0.175359994f,
+	0.175439999f, 0.175520003f, 0.175600007f, 0.175679997f,
+	0.175760001f, 0.175840005f, 0.175919995f, 0.175999999f,
+	0.176080003f, 0.176160008f, 0.176239997f, 0.176320001f,
+	0.176400006f, 0.176479995f, 0.17656f, 0.176640004f,
+	0.176720008f, 0.176799998f, 0.176880002f, 0.176960006f,
+	0.177039996f, 0.17712f, 0.177200004f, 0.177279994f,
+	0.177359998f, 0.177440003f, 0.177520007f, 0.177599996f,
+	0.177680001f, 0.177760005f, 0.177839994f, 0.177919999f,
+	0.178000003f, 0.178080007f, 0.178159997f, 0.178240001f,
+	0.178320006f, 0.178399995f, 0.178479999f, 0.178560004f,
+	0.178640008f, 0.178719997f, 0.178800002f, 0.178880006f,
+	0.178959996f, 0.17904f, 0.179120004f, 0.179200009f,
+	0.179279998f, 0.179360002f, 0.179440007f, 0.179519996f,
+	0.1796f, 0.179680005f, 0.179759994f, 0.179839998f,
+	0.179920003f, 0.180000007f, 0.180079997f, 0.180160001f,
+	0.180240005f, 0.180319995f, 0.180399999f, 0.180480003f,
+	0.180560008f, 0.180639997f, 0.180720001f, 0.180800006f,
+	0.180879995f, 0.18096f, 0.181040004f, 0.181120008f,
+	0.181199998f, 0.181280002f, 0.181360006f, 0.181439996f,
+	0.18152f, 0.181600004f, 0.181679994f, 0.181759998f,
+	0.181840003f, 0.181920007f, 0.181999996f, 0.182080001f,
+	0.182160005f, 0.182239994f, 0.182319999f, 0.182400003f,
+	0.182480007f, 0.182559997f, 0.182640001f, 0.182720006f,
+	0.182799995f, 0.182879999f, 0.182960004f, 0.183040008f,
+	0.183119997f, 0.183200002f, 0.183280006f, 0.183359995f,
+	0.18344f, 0.183520004f, 0.183599994f, 0.183679998f,
+	0.183760002f, 0.183840007f, 0.183919996f, 0.184f,
+	0.184080005f, 0.184159994f, 0.184239998f, 0.184320003f,
+	0.184400007f, 0.184479997f, 0.184560001f, 0.184640005f,
+	0.184719995f, 0.184799999f, 0.184880003f, 0.184960008f,
+	0.185039997f, 0.185120001f, 0.185200006f, 0.185279995f,
+	0.18536f, 0.185440004f, 0.185520008f, 0.185599998f,
+	0.185680002f, 0.185760006f, 0.185839996f, 0.18592f,
+	0.186000004f, 0.186079994f, 0.186159998f, 0.186240003f,
+	0.186320007f, 0.186399996f, 0.186480001f, 0.186560005f,
+	0.186639994f, 0.186719999f, 0.186800003f, 0.186880007f,
+	0.186959997f, 0.187040001f, 0.187120005f, 0.187199995f,
+	0.187279999f, 0.187360004f, 0.187440008f, 0.187519997f,
+	0.187600002f, 0.187680006f, 0.187759995f, 0.18784f,
+	0.187920004f, 0.187999994f, 0.188079998f, 0.188160002f,
+	0.188240007f, 0.188319996f, 0.1884f, 0.188480005f,
+	0.188559994f, 0.188639998f, 0.188720003f, 0.188800007f,
+	0.188879997f, 0.188960001f, 0.189040005f, 0.189119995f,
+	0.189199999f, 0.189280003f, 0.189360008f, 0.189439997f,
+	0.189520001f, 0.189600006f, 0.189679995f, 0.18976f,
+	0.189840004f, 0.189920008f, 0.189999998f, 0.190080002f,
+	0.190160006f, 0.190239996f, 0.19032f, 0.190400004f,
+	0.190479994f, 0.190559998f, 0.190640002f, 0.190720007f,
+	0.190799996f, 0.190880001f, 0.190960005f, 0.191039994f,
+	0.191119999f, 0.191200003f, 0.191280007f, 0.191359997f,
+	0.191440001f, 0.191520005f, 0.191599995f, 0.191679999f,
+	0.191760004f, 0.191840008f, 0.191919997f, 0.192000002f,
+	0.192080006f, 0.192159995f, 0.19224f, 0.192320004f,
+	0.192399994f, 0.192479998f, 0.192560002f, 0.192640007f,
+	0.192719996f, 0.1928f, 0.192880005f, 0.192959994f,
+	0.193039998f, 0.193120003f, 0.193200007f, 0.193279997f,
+	0.193360001f, 0.193440005f, 0.193519995f, 0.193599999f,
+	0.193680003f, 0.193760008f, 0.193839997f, 0.193920001f,
+	0.194000006f, 0.194079995f, 0.194159999f, 0.194240004f,
+	0.194320008f, 0.194399998f, 0.194480002f, 0.194560006f,
+	0.194639996f, 0.19472f, 0.194800004f, 0.194879994f,
+	0.194959998f, 0.195040002f, 0.195120007f, 0.195199996f,
+	0.195280001f, 0.195360005f, 0.195439994f, 0.195519999f,
+	0.195600003f, 0.195680007f, 0.195759997f, 0.195840001f,
+	0.195920005f, 0.195999995f, 0.196079999f, 0.196160004f,
+	0.196240008f, 0.196319997f, 0.196400002f, 0.196480006f,
+	0.196559995f, 0.19664f, 0.196720004f, 0.196799994f,
+	0.196879998f, 0.196960002f, 0.197040007f, 0.197119996f,
+	0.1972f, 0.197280005f, 0.197359994f, 0.197439998f,
+	0.197520003f, 0.197600007f, 0.197679996f, 0.197760001f,
+	0.197840005f, 0.197919995f, 0.197999999f, 0.198080003f,
+	0.198160008f, 0.198239997f, 0.198320001f, 0.198400006f,
+	0.198479995f, 0.198559999f, 0.198640004f, 0.198719993f,
+	0.198799998f, 0.198880002f, 0.198960006f, 0.199039996f,
+	0.19912f, 0.199200004f, 0.199279994f, 0.199359998f,
+	0.199440002f, 0.199520007f, 0.199599996f, 0.199680001f,
+	0.199760005f, 0.199839994f, 0.199919999f, 0.200000003f,
+	0.200080007f, 0.200159997f, 0.200240001f, 0.200320005f,
+	0.200399995f, 0.200479999f, 0.200560004f, 0.200640008f,
+	0.200719997f, 0.200800002f, 0.200880006f, 0.200959995f,
+	0.20104f, 0.201120004f, 0.201199993f, 0.201279998f,
+	0.201360002f, 0.201440006f, 0.201519996f, 0.2016f,
+	0.201680005f, 0.201759994f, 0.201839998f, 0.201920003f,
+	0.202000007f, 0.202079996f, 0.202160001f, 0.202240005f,
+	0.202319995f, 0.202399999f, 0.202480003f, 0.202560008f,
+	0.202639997f, 0.202720001f, 0.202800006f, 0.202879995f,
+	0.202959999f, 0.203040004f, 0.203119993f, 0.203199998f,
+	0.203280002f, 0.203360006f, 0.203439996f, 0.20352f,
+	0.203600004f, 0.203679994f, 0.203759998f, 0.203840002f,
+	0.203920007f, 0.203999996f, 0.204080001f, 0.204160005f,
+	0.204239994f, 0.204319999f, 0.204400003f, 0.204480007f,
+	0.204559997f, 0.204640001f, 0.204720005f, 0.204799995f,
+	0.204879999f, 0.204960003f, 0.205040008f, 0.205119997f,
+	0.205200002f, 0.205280006f, 0.205359995f, 0.20544f,
+	0.205520004f, 0.205599993f, 0.205679998f, 0.205760002f,
+	0.205840006f, 0.205919996f, 0.206f, 0.206080005f,
+	0.206159994f, 0.206239998f, 0.206320003f, 0.206400007f,
+	0.206479996f, 0.206560001f, 0.206640005f, 0.206719995f,
+	0.206799999f, 0.206880003f, 0.206960008f, 0.207039997f,
+	0.207120001f, 0.207200006f, 0.207279995f, 0.207359999f,
+	0.207440004f, 0.207519993f, 0.207599998f, 0.207680002f,
+	0.207760006f, 0.207839996f, 0.20792f, 0.208000004f,
+	0.208079994f, 0.208159998f, 0.208240002f, 0.208320007f,
+	0.208399996f, 0.20848f, 0.208560005f, 0.208639994f,
+	0.208719999f, 0.208800003f, 0.208880007f, 0.208959997f,
+	0.209040001f, 0.209120005f, 0.209199995f, 0.209279999f,
+	0.209360003f, 0.209439993f, 0.209519997f, 0.209600002f,
+	0.209680006f, 0.209759995f, 0.20984f, 0.209920004f,
+	0.209999993f, 0.210079998f, 0.210160002f, 0.210240006f,
+	0.210319996f, 0.2104f, 0.210480005f, 0.210559994f,
+	0.210639998f, 0.210720003f, 0.210800007f, 0.210879996f,
+	0.210960001f, 0.211040005f, 0.211119995f, 0.211199999f,
+	0.211280003f, 0.211360008f, 0.211439997f, 0.211520001f,
+	0.211600006f, 0.211679995f, 0.211759999f, 0.211840004f,
+	0.211919993f, 0.211999997f, 0.212080002f, 0.212160006f,
+	0.212239996f, 0.21232f, 0.212400004f, 0.212479994f,
+	0.212559998f, 0.212640002f, 0.212720007f, 0.212799996f,
+	0.21288f, 0.212960005f, 0.213039994f, 0.213119999f,
+	0.213200003f, 0.213280007f, 0.213359997f, 0.213440001f,
+	0.213520005f, 0.213599995f, 0.213679999f, 0.213760003f,
+	0.213839993f, 0.213919997f, 0.214000002f, 0.214080006f,
+	0.214159995f, 0.21424f, 0.214320004f, 0.214399993f,
+	0.214479998f, 0.214560002f, 0.214640006f, 0.214719996f,
+	0.2148f, 0.214880005f, 0.214959994f, 0.215039998f,
+	0.215120003f, 0.215200007f, 0.215279996f, 0.215360001f,
+	0.215440005f, 0.215519994f, 0.215599999f, 0.215680003f,
+	0.215760008f, 0.215839997f, 0.215920001f, 0.216000006f,
+	0.216079995f, 0.216159999f, 0.216240004f, 0.216319993f,
+	0.216399997f, 0.216480002f, 0.216560006f, 0.216639996f,
+	0.21672f, 0.216800004f, 0.216879994f, 0.216959998f,
+	0.217040002f, 0.217120007f, 0.217199996f, 0.21728f,
+	0.217360005f, 0.217439994f, 0.217519999f, 0.217600003f,
+	0.217680007f, 0.217759997f, 0.217840001f, 0.217920005f,
+	0.217999995f, 0.218079999f, 0.218160003f, 0.218239993f,
+	0.218319997f, 0.218400002f, 0.218480006f, 0.218559995f,
+	0.21864f, 0.218720004f, 0.218799993f, 0.218879998f,
+	0.218960002f, 0.219040006f, 0.219119996f, 0.2192f,
+	0.219280005f, 0.219359994f, 0.219439998f, 0.219520003f,
+	0.219600007f, 0.219679996f, 0.219760001f, 0.219840005f,
+	0.219919994f, 0.219999999f, 0.220080003f, 0.220160007f,
+	0.220239997f, 0.220320001f, 0.220400006f, 0.220479995f,
+	0.220559999f, 0.220640004f, 0.220719993f, 0.220799997f,
+	0.220880002f, 0.220960006f, 0.221039996f, 0.22112f,
+	0.221200004f, 0.221279994f, 0.221359998f, 0.221440002f,
+	0.221520007f, 0.221599996f, 0.22168f, 0.221760005f,
+	0.221839994f, 0.221919999f, 0.222000003f, 0.222080007f,
+	0.222159997f, 0.222240001f, 0.222320005f, 0.222399995f,
+	0.222479999f, 0.222560003f, 0.222639993f, 0.222719997f,
+	0.222800002f, 0.222880006f, 0.222959995f, 0.22304f,
+	0.223120004f, 0.223199993f, 0.223279998f, 0.223360002f,
+	0.223440006f, 0.223519996f, 0.2236f, 0.223680004f,
+	0.223759994f, 0.223839998f, 0.223920003f, 0.224000007f,
+	0.224079996f, 0.224160001f, 0.224240005f, 0.224319994f,
+	0.224399999f, 0.224480003f, 0.224559993f, 0.224639997f,
+	0.224720001f, 0.224800006f, 0.224879995f, 0.224959999f,
+	0.225040004f, 0.225119993f, 0.225199997f, 0.225280002f,
+	0.225360006f, 0.225439996f, 0.22552f, 0.225600004f,
+	0.225679994f, 0.225759998f, 0.225840002f, 0.225920007f,
+	0.225999996f, 0.22608f, 0.226160005f, 0.226239994f,
+	0.226319999f, 0.226400003f, 0.226480007f, 0.226559997f,
+	0.226640001f, 0.226720005f, 0.226799995f, 0.226879999f,
+	0.226960003f, 0.227039993f, 0.227119997f, 0.227200001f,
+	0.227280006f, 0.227359995f, 0.22744f, 0.227520004f,
+	0.227599993f, 0.227679998f, 0.227760002f, 0.227840006f,
+	0.227919996f, 0.228f, 0.228080004f, 0.228159994f,
+	0.228239998f, 0.228320003f, 0.228400007f, 0.228479996f,
+	0.228560001f, 0.228640005f, 0.228719994f, 0.228799999f,
+	0.228880003f, 0.228959993f, 0.229039997f, 0.229120001f,
+	0.229200006f, 0.229279995f, 0.229359999f, 0.229440004f,
+	0.229519993f, 0.229599997f, 0.229680002f, 0.229760006f,
+	0.229839996f, 0.22992f, 0.230000004f, 0.230079994f,
+	0.230159998f, 0.230240002f, 0.230320007f, 0.230399996f,
+	0.23048f, 0.230560005f, 0.230639994f, 0.230719998f,
+	0.230800003f, 0.230880007f, 0.230959997f, 0.231040001f,
+	0.231120005f, 0.231199995f, 0.231279999f, 0.231360003f,
+	0.231439993f, 0.231519997f, 0.231600001f, 0.231680006f,
+	0.231759995f, 0.23184f, 0.231920004f, 0.231999993f,
+	0.232079998f, 0.232160002f, 0.232240006f, 0.232319996f,
+	0.2324f, 0.232480004f, 0.232559994f, 0.232639998f,
+	0.232720003f, 0.232800007f, 0.232879996f, 0.232960001f,
+	0.233040005f, 0.233119994f, 0.233199999f, 0.233280003f,
+	0.233359993f, 0.233439997f, 0.233520001f, 0.233600006f,
+	0.233679995f, 0.233759999f, 0.233840004f, 0.233919993f,
+	0.233999997f, 0.234080002f, 0.234160006f, 0.234239995f,
+	0.23432f, 0.234400004f, 0.234479994f, 0.234559998f,
+	0.234640002f, 0.234720007f, 0.234799996f, 0.23488f,
+	0.234960005f, 0.235039994f, 0.235119998f, 0.235200003f,
+	0.235279992f, 0.235359997f, 0.235440001f, 0.235520005f,
+	0.235599995f, 0.235679999f, 0.235760003f, 0.235839993f,
+	0.235919997f, 0.236000001f, 0.236080006f, 0.236159995f,
+	0.23624f, 0.236320004f, 0.236399993f, 0.236479998f,
+	0.236560002f, 0.236640006f, 0.236719996f, 0.2368f,
+	0.236880004f, 0.236959994f, 0.237039998f, 0.237120003f,
+	0.237200007f, 0.237279996f, 0.237360001f, 0.237440005f,
+	0.237519994f, 0.237599999f, 0.237680003f, 0.237759992f,
+	0.237839997f, 0.237920001f, 0.238000005f, 0.238079995f,
+	0.238159999f, 0.238240004f, 0.238319993f, 0.238399997f,
+	0.238480002f, 0.238560006f, 0.238639995f, 0.23872f,
+	0.238800004f, 0.238879994f, 0.238959998f, 0.239040002f,
+	0.239120007f, 0.239199996f, 0.23928f, 0.239360005f,
+	0.239439994f, 0.239519998f, 0.239600003f, 0.239679992f,
+	0.239759997f, 0.239840001f, 0.239920005f, 0.239999995f,
+	0.240079999f, 0.240160003f, 0.240239993f, 0.240319997f,
+	0.240400001f, 0.240480006f, 0.240559995f, 0.24064f,
+	0.240720004f, 0.240799993f, 0.240879998f, 0.240960002f,
+	0.241040006f, 0.241119996f, 0.2412f, 0.241280004f,
+	0.241359994f, 0.241439998f, 0.241520002f, 0.241600007f,
+	0.241679996f, 0.241760001f, 0.241840005f, 0.241919994f,
+	0.241999999f, 0.242080003f, 0.242159992f, 0.242239997f,
+	0.242320001f, 0.242400005f, 0.242479995f, 0.242559999f,
+	0.242640004f, 0.242719993f, 0.242799997f, 0.242880002f,
+	0.242960006f, 0.243039995f, 0.24312f, 0.243200004f,
+	0.243279994f, 0.243359998f, 0.243440002f, 0.243520007f,
+	0.243599996f, 0.24368f, 0.243760005f, 0.243839994f,
+	0.243919998f, 0.244000003f, 0.244079992f, 0.244159997f,
+	0.244240001f, 0.244320005f, 0.244399995f, 0.244479999f,
+	0.244560003f, 0.244639993f, 0.244719997f, 0.244800001f,
+	0.244880006f, 0.244959995f, 0.245039999f, 0.245120004f,
+	0.245199993f, 0.245279998f, 0.245360002f, 0.245440006f,
+	0.245519996f, 0.2456f, 0.245680004f, 0.245759994f,
+	0.245839998f, 0.245920002f, 0.246000007f, 0.246079996f,
+	0.246160001f, 0.246240005f, 0.246319994f, 0.246399999f,
+	0.246480003f, 0.246559992f, 0.246639997f, 0.246720001f,
+	0.246800005f, 0.246879995f, 0.246959999f, 0.247040004f,
+	0.247119993f, 0.247199997f, 0.247280002f, 0.247360006f,
+	0.247439995f, 0.24752f, 0.247600004f, 0.247679994f,
+	0.247759998f, 0.247840002f, 0.247920007f, 0.247999996f,
+	0.24808f, 0.248160005f, 0.248239994f, 0.248319998f,
+	0.248400003f, 0.248479992f, 0.248559996f, 0.248640001f,
+	0.248720005f, 0.248799995f, 0.248879999f, 0.248960003f,
+	0.249039993f, 0.249119997f, 0.249200001f, 0.249280006f,
+	0.249359995f, 0.249439999f, 0.249520004f, 0.249599993f,
+	0.249679998f, 0.249760002f, 0.249840006f, 0.249919996f,
+	0.25f, 0.250079989f, 0.250159979f, 0.250239998f,
+	0.250319988f, 0.250399977f, 0.250479996f, 0.250559986f,
+	0.250640005f, 0.250719994f, 0.250799984f, 0.250880003f,
+	0.250959992f, 0.251039982f, 0.251120001f, 0.251199991f,
+	0.25127998f, 0.251359999f, 0.251439989f, 0.251519978f,
+	0.251599997f, 0.251679987f, 0.251760006f, 0.251839995f,
+	0.251919985f, 0.252000004f, 0.252079993f, 0.252159983f,
+	0.252240002f, 0.252319992f, 0.252399981f, 0.25248f,
+	0.25255999f, 0.252639979f, 0.252719998f, 0.252799988f,
+	0.252879977f, 0.252959996f, 0.253039986f, 0.253120005f,
+	0.253199995f, 0.253279984f, 0.253360003f, 0.253439993f,
+	0.253519982f, 0.253600001f, 0.253679991f, 0.25375998f,
+	0.253839999f, 0.253919989f, 0.253999978f, 0.254079998f,
+	0.254159987f, 0.254240006f, 0.254319996f, 0.254399985f,
+	0.254480004f, 0.254559994f, 0.254639983f, 0.254720002f,
+	0.254799992f, 0.254879981f, 0.254960001f, 0.25503999f,
+	0.255119979f, 0.255199999f, 0.255279988f, 0.255359977f,
+	0.255439997f, 0.255519986f, 0.255600005f, 0.255679995f,
+	0.255759984f, 0.255840003f, 0.255919993f, 0.255999982f,
+	0.256080002f, 0.256159991f, 0.25623998f, 0.25632f,
+	0.256399989f, 0.256479979f, 0.256559998f, 0.256639987f,
+	0.256720006f, 0.256799996f, 0.256879985f, 0.256960005f,
+	0.257039994f, 0.257119983f, 0.257200003f, 0.257279992f,
+	0.257359982f, 0.257440001f, 0.25751999f, 0.25759998f,
+	0.257679999f, 0.257759988f, 0.257839978f, 0.257919997f,
+	0.257999986f, 0.258080006f, 0.258159995f, 0.258239985f,
+	0.258320004f, 0.258399993f, 0.258479983f, 0.258560002f,
+	0.258639991f, 0.258719981f, 0.2588f, 0.258879989f,
+	0.258959979f, 0.259039998f, 0.259119987f, 0.259199977f,
+	0.259279996f, 0.259359986f, 0.259440005f, 0.259519994f,
+	0.259599984f, 0.259680003f, 0.259759992f, 0.259839982f,
+	0.259920001f, 0.25999999f, 0.26007998f, 0.260159969f,
+	0.260239989f, 0.260319978f, 0.260399997f, 0.260479987f,
+	0.260559976f, 0.260639995f, 0.260719985f, 0.260799974f,
+	0.260879993f, 0.260959983f, 0.261039972f, 0.261119992f,
+	0.261199981f, 0.26127997f, 0.26135999f, 0.261439979f,
+	0.261519998f, 0.261599988f, 0.261679977f, 0.261759996f,
+	0.261839986f, 0.261919975f, 0.261999995f, 0.262079984f,
+	0.262159973f, 0.262239993f, 0.262319982f, 0.262399971f,
+	0.262479991f, 0.26255998f, 0.26263997f, 0.262719989f,
+	0.262799978f, 0.262879997f, 0.262959987f, 0.263039976f,
+	0.263119996f, 0.263199985f, 0.263279974f, 0.263359994f,
+	0.263439983f, 0.263519973f, 0.263599992f, 0.263679981f,
+	0.263759971f, 0.26383999f, 0.263919979f, 0.263999999f,
+	0.264079988f, 0.264159977f, 0.264239997f, 0.264319986f,
+	0.264399976f, 0.264479995f, 0.264559984f, 0.264639974f,
+	0.264719993f, 0.264799982f, 0.264879972f, 0.264959991f,
+	0.26503998f, 0.26511997f, 0.265199989f, 0.265279979f,
+	0.265359998f, 0.265439987f, 0.265519977f, 0.265599996f,
+	0.265679985f, 0.265759975f, 0.265839994f, 0.265919983f,
+	0.265999973f, 0.266079992f, 0.266159981f, 0.266239971f,
+	0.26631999f, 0.26639998f, 0.266479999f, 0.266559988f,
+	0.266639978f, 0.266719997f, 0.266799986f, 0.266879976f,
+	0.266959995f, 0.267039984f, 0.267119974f, 0.267199993f,
+	0.267279983f, 0.267359972f, 0.267439991f, 0.267519981f,
+	0.26759997f, 0.267679989f, 0.267759979f, 0.267839998f,
+	0.267919987f, 0.267999977f, 0.268079996f, 0.268159986f,
+	0.268239975f, 0.268319994f, 0.268399984f, 0.268479973f,
+	0.268559992f, 0.268639982f, 0.268719971f, 0.26879999f,
+	0.26887998f, 0.268959969f, 0.269039989f, 0.269119978f,
+	0.269199997f, 0.269279987f, 0.269359976f, 0.269439995f,
+	0.269519985f, 0.269599974f, 0.269679993f, 0.269759983f,
+	0.269839972f, 0.269919991f, 0.269999981f, 0.27007997f,
+	0.27015999f, 0.270239979f, 0.270319998f, 0.270399988f,
+	0.270479977f, 0.270559996f, 0.270639986f, 0.270719975f,
+	0.270799994f, 0.270879984f, 0.270959973f, 0.271039993f,
+	0.271119982f, 0.271199971f, 0.271279991f, 0.27135998f,
+	0.27143997f, 0.271519989f, 0.271599978f, 0.271679997f,
+	0.271759987f, 0.271839976f, 0.271919996f, 0.271999985f,
+	0.272079974f, 0.272159994f, 0.272239983f, 0.272319973f,
+	0.272399992f, 0.272479981f, 0.272559971f, 0.27263999f,
+	0.272719979f, 0.272799999f, 0.272879988f, 0.272959977f,
+	0.273039997f, 0.273119986f, 0.273199975f, 0.273279995f,
+	0.273359984f, 0.273439974f, 0.273519993f, 0.273599982f,
+	0.273679972f, 0.273759991f, 0.27383998f, 0.27391997f,
+	0.273999989f, 0.274079978f, 0.274159998f, 0.274239987f,
+	0.274319977f, 0.274399996f, 0.274479985f, 0.274559975f,
+	0.274639994f, 0.274719983f, 0.274799973f, 0.274879992f,
+	0.274959981f, 0.275039971f, 0.27511999f, 0.27519998f,
+	0.275279969f, 0.275359988f, 0.275439978f, 0.275519997f,
+	0.275599986f, 0.275679976f, 0.275759995f, 0.275839984f,
+	0.275919974f, 0.275999993f, 0.276079983f, 0.276159972f,
+	0.276239991f, 0.276319981f, 0.27639997f, 0.276479989f,
+	0.276559979f, 0.276639998f, 0.276719987f, 0.276799977f,
+	0.276879996f, 0.276959985f, 0.277039975f, 0.277119994f,
+	0.277199984f, 0.277279973f, 0.277359992f, 0.277439982f,
+	0.277519971f, 0.27759999f, 0.27767998f, 0.277759969f,
+	0.277839988f, 0.277919978f, 0.277999997f, 0.278079987f,
+	0.278159976f, 0.278239995f, 0.278319985f, 0.278399974f,
+	0.278479993f, 0.278559983f, 0.278639972f, 0.278719991f,
+	0.278799981f, 0.27887997f, 0.27895999f, 0.279039979f,
+	0.279119998f, 0.279199988f, 0.279279977f, 0.279359996f,
+	0.279439986f, 0.279519975f, 0.279599994f, 0.279679984f,
+	0.279759973f, 0.279839993f, 0.279919982f, 0.279999971f,
+	0.280079991f, 0.28015998f, 0.280239969f, 0.280319989f,
+	0.280399978f, 0.280479997f, 0.280559987f, 0.280639976f,
+	0.280719995f, 0.280799985f, 0.280879974f, 0.280959994f,
+	0.281039983f, 0.281119972f, 0.281199992f, 0.281279981f,
+	0.281359971f, 0.28143999f, 0.281519979f, 0.281599998f,
+	0.281679988f, 0.281759977f, 0.281839997f, 0.281919986f,
+	0.281999975f, 0.282079995f, 0.282159984f, 0.282239974f,
+	0.282319993f, 0.282399982f, 0.282479972f, 0.282559991f,
+	0.28263998f, 0.28271997f, 0.282799989f, 0.282879978f,
+	0.282959998f, 0.283039987f, 0.283119977f, 0.283199996f,
+	0.283279985f, 0.283359975f, 0.283439994f, 0.283519983f,
+	0.283599973f, 0.283679992f, 0.283759981f, 0.283839971f,
+	0.28391999f, 0.283999979f, 0.284079969f, 0.284159988f,
+	0.284239978f, 0.284319997f, 0.284399986f, 0.284479976f,
+	0.284559995f, 0.284639984f, 0.284719974f, 0.284799993f,
+	0.284879982f, 0.284959972f, 0.285039991f, 0.285119981f,
+	0.28519997f, 0.285279989f, 0.285359979f, 0.285439998f,
+	0.285519987f, 0.285599977f, 0.285679996f, 0.285759985f,
+	0.285839975f, 0.285919994f, 0.285999984f, 0.286079973f,
+	0.286159992f, 0.286239982f, 0.286319971f, 0.28639999f,
+	0.28647998f, 0.286559969f, 0.286639988f, 0.286719978f,
+	0.286799997f, 0.286879987f, 0.286959976f, 0.287039995f,
+	0.287119985f, 0.287199974f, 0.287279993f, 0.287359983f,
+	0.287439972f, 0.287519991f, 0.287599981f, 0.28767997f,
+	0.28775999f, 0.287839979f, 0.287919998f, 0.287999988f,
+	0.288079977f, 0.288159996f, 0.288239986f, 0.288319975f,
+	0.288399994f, 0.288479984f, 0.288559973f, 0.288639992f,
+	0.288719982f, 0.288799971f, 0.288879991f, 0.28895998f,
+	0.289039969f, 0.289119989f, 0.289199978f, 0.289279997f,
+	0.289359987f, 0.289439976f, 0.289519995f, 0.289599985f,
+	0.289679974f, 0.289759994f, 0.289839983f, 0.289919972f,
+	0.289999992f, 0.290079981f, 0.290159971f, 0.29023999f,
+	0.290319979f, 0.290399969f, 0.290479988f, 0.290559977f,
+	0.290639997f, 0.290719986f, 0.290799975f, 0.290879995f,
+	0.290959984f, 0.291039973f, 0.291119993f, 0.291199982f,
+	0.291279972f, 0.291359991f, 0.29143998f, 0.29151997f,
+	0.291599989f, 0.291679978f, 0.291759998f, 0.291839987f,
+	0.291919976f, 0.291999996f, 0.292079985f, 0.292159975f,
+	0.292239994f, 0.292319983f, 0.292399973f, 0.292479992f,
+	0.292559981f, 0.292639971f, 0.29271999f, 0.292799979f,
+	0.292879969f, 0.292959988f, 0.293039978f, 0.293119997f,
+	0.293199986f, 0.293279976f, 0.293359995f, 0.293439984f,
+	0.293519974f, 0.293599993f, 0.293679982f, 0.293759972f,
+	0.293839991f, 0.293919981f, 0.29399997f, 0.294079989f,
+	0.294159979f, 0.294239998f, 0.294319987f, 0.294399977f,
+	0.294479996f, 0.294559985f, 0.294639975f, 0.294719994f,
+	0.294799984f, 0.294879973f, 0.294959992f, 0.295039982f,
+	0.295119971f, 0.29519999f, 0.29527998f, 0.295359969f,
+	0.295439988f, 0.295519978f, 0.295599997f, 0.295679986f,
+	0.295759976f, 0.295839995f, 0.295919985f, 0.295999974f,
+	0.296079993f, 0.296159983f, 0.296239972f, 0.296319991f,
+	0.296399981f, 0.29647997f, 0.296559989f, 0.296639979f,
+	0.296719968f, 0.296799988f, 0.296879977f, 0.296959996f,
+	0.297039986f, 0.297119975f, 0.297199994f, 0.297279984f,
+	0.297359973f, 0.297439992f, 0.297519982f, 0.297599971f,
+	0.297679991f, 0.29775998f, 0.297839969f, 0.297919989f,
+	0.297999978f, 0.298079997f, 0.298159987f, 0.298239976f,
+	0.298319995f, 0.298399985f, 0.298479974f, 0.298559994f,
+	0.298639983f, 0.298719972f, 0.298799992f, 0.298879981f,
+	0.29895997f, 0.29903999f, 0.299119979f, 0.299199969f,
+	0.299279988f, 0.299359977f, 0.299439996f, 0.299519986f,
+	0.299599975f, 0.299679995f, 0.299759984f, 0.299839973f,
+	0.299919993f, 0.299999982f, 0.300079972f, 0.300159991f,
+	0.30023998f, 0.30031997f, 0.300399989f, 0.300479978f,
+	0.300559998f, 0.300639987f, 0.300719976f, 0.300799996f,
+	0.300879985f, 0.300959975f, 0.301039994f, 0.301119983f,
+	0.301199973f, 0.301279992f, 0.301359981f, 0.301439971f,
+	0.30151999f, 0.301599979f, 0.301679969f, 0.301759988f,
+	0.301839978f, 0.301919997f, 0.301999986f, 0.302079976f,
+	0.302159995f, 0.302239984f, 0.302319974f, 0.302399993f,
+	0.302479982f, 0.302559972f, 0.302639991f, 0.30271998f,
+	0.30279997f, 0.302879989f, 0.302959979f, 0.303039998f,
+	0.303119987f, 0.303199977f, 0.303279996f, 0.303359985f,
+	0.303439975f, 0.303519994f, 0.303599983f, 0.303679973f,
+	0.303759992f, 0.303839982f, 0.303919971f, 0.30399999f,
+	0.30407998f, 0.304159969f, 0.304239988f, 0.304319978f,
+	0.304399997f, 0.304479986f, 0.304559976f, 0.304639995f,
+	0.304719985f, 0.304799974f, 0.304879993f, 0.304959983f,
+	0.305039972f, 0.305119991f, 0.305199981f, 0.30527997f,
+	0.305359989f, 0.305439979f, 0.305519968f, 0.305599988f,
+	0.305679977f, 0.305759996f, 0.305839986f, 0.305919975f,
+	0.305999994f, 0.306079984f, 0.306159973f, 0.306239992f,
+	0.306319982f, 0.306399971f, 0.30647999f, 0.30655998f,
+	0.306639969f, 0.306719989f, 0.306799978f, 0.306879997f,
+	0.306959987f, 0.307039976f, 0.307119995f, 0.307199985f,
+	0.307279974f, 0.307359993f, 0.307439983f, 0.307519972f,
+	0.307599992f, 0.307679981f, 0.30775997f, 0.30783999f,
+	0.307919979f, 0.307999969f, 0.308079988f, 0.308159977f,
+	0.308239996f, 0.308319986f, 0.308399975f, 0.308479995f,
+	0.308559984f, 0.308639973f, 0.308719993f, 0.308799982f,
+	0.308879972f, 0.308959991f, 0.30903998f, 0.30911997f,
+	0.309199989f, 0.309279978f, 0.309359998f, 0.309439987f,
+	0.309519976f, 0.309599996f, 0.309679985f, 0.309759974f,
+	0.309839994f, 0.309919983f, 0.309999973f, 0.310079992f,
+	0.310159981f, 0.310239971f, 0.31031999f, 0.310399979f,
+	0.310479969f, 0.310559988f, 0.310639977f, 0.310719997f,
+	0.310799986f, 0.310879976f, 0.310959995f, 0.311039984f,
+	0.311119974f, 0.311199993f, 0.311279982f, 0.311359972f,
+	0.311439991f, 0.31151998f, 0.31159997f, 0.311679989f,
+	0.311759979f, 0.311839968f, 0.311919987f, 0.311999977f,
+	0.312079996f, 0.312159985f, 0.312239975f, 0.312319994f,
+	0.312399983f, 0.312479973f, 0.312559992f, 0.312639982f,
+	0.312719971f, 0.31279999f, 0.31287998f, 0.312959969f,
+	0.313039988f, 0.313119978f, 0.313199997f, 0.313279986f,
+	0.313359976f, 0.313439995f, 0.313519984f, 0.313599974f,
+	0.313679993f, 0.313759983f, 0.313839972f, 0.313919991f,
+	0.313999981f, 0.31407997f, 0.314159989f, 0.314239979f,
+	0.314319968f, 0.314399987f, 0.314479977f, 0.314559996f,
+	0.314639986f, 0.314719975f, 0.314799994f, 0.314879984f,
+	0.314959973f, 0.315039992f, 0.315119982f, 0.315199971f,
+	0.31527999f, 0.31535998f, 0.315439969f, 0.315519989f,
+	0.315599978f, 0.315679997f, 0.315759987f, 0.315839976f,
+	0.315919995f, 0.315999985f, 0.316079974f, 0.316159993f,
+	0.316239983f, 0.316319972f, 0.316399992f, 0.316479981f,
+	0.31655997f, 0.31663999f, 0.316719979f, 0.316799968f,
+	0.316879988f, 0.316959977f, 0.317039996f, 0.317119986f,
+	0.317199975f, 0.317279994f, 0.317359984f, 0.317439973f,
+	0.317519993f, 0.317599982f, 0.317679971f, 0.317759991f,
+	0.31783998f, 0.31791997f, 0.317999989f, 0.318079978f,
+	0.318159997f, 0.318239987f, 0.318319976f, 0.318399996f,
+	0.318479985f, 0.318559974f, 0.318639994f, 0.318719983f,
+	0.318799973f, 0.318879992f, 0.318959981f, 0.319039971f,
+	0.31911999f, 0.319199979f, 0.319279969f, 0.319359988f,
+	0.319439977f, 0.319519997f, 0.319599986f, 0.319679976f,
+	0.319759995f, 0.319839984f, 0.319919974f, 0.319999993f,
+	0.320079982f, 0.320159972f, 0.320239991f, 0.32031998f,
+	0.32039997f, 0.320479989f, 0.320559978f, 0.320639968f,
+	0.320719987f, 0.320799977f, 0.320879996f, 0.320959985f,
+	0.321039975f, 0.321119994f, 0.321199983f, 0.321279973f,
+	0.321359992f, 0.321439981f, 0.321519971f, 0.32159999f,
+	0.32167998f, 0.321759969f, 0.321839988f, 0.321919978f,
+	0.321999997f, 0.322079986f, 0.322159976f, 0.322239995f,
+	0.322319984f, 0.322399974f, 0.322479993f, 0.322559983f,
+	0.322639972f, 0.322719991f, 0.322799981f, 0.32287997f,
+	0.322959989f, 0.323039979f, 0.323119968f, 0.323199987f,
+	0.323279977f, 0.323359996f, 0.323439986f, 0.323519975f,
+	0.323599994f, 0.323679984f, 0.323759973f, 0.323839992f,
+	0.323919982f, 0.323999971f, 0.32407999f, 0.32415998f,
+	0.324239969f, 0.324319988f, 0.324399978f, 0.324479997f,
+	0.324559987f, 0.324639976f, 0.324719995f, 0.324799985f,
+	0.324879974f, 0.324959993f, 0.325039983f, 0.325119972f,
+	0.325199991f, 0.325279981f, 0.32535997f, 0.32543999f,
+	0.325519979f, 0.325599968f, 0.325679988f, 0.325759977f,
+	0.325839996f, 0.325919986f, 0.325999975f, 0.326079994f,
+	0.326159984f, 0.326239973f, 0.326319993f, 0.326399982f,
+	0.326479971f, 0.326559991f, 0.32663998f, 0.32671997f,
+	0.326799989f, 0.326879978f, 0.326959968f, 0.327039987f,
+	0.327119976f, 0.327199996f, 0.327279985f, 0.327359974f,
+	0.327439994f, 0.327519983f, 0.327599972f, 0.327679992f,
+	0.327759981f, 0.327839971f, 0.32791999f, 0.327999979f,
+	0.328079969f, 0.328159988f, 0.328239977f, 0.328319997f,
+	0.328399986f, 0.328479975f, 0.328559995f, 0.328639984f,
+	0.328719974f, 0.328799993f, 0.328879982f, 0.328959972f,
+	0.329039991f, 0.32911998f, 0.32919997f, 0.329279989f,
+	0.329359978f, 0.329439968f, 0.329519987f, 0.329599977f,
+	0.329679996f, 0.329759985f, 0.329839975f, 0.329919994f,
+	0.329999983f, 0.330079973f, 0.330159992f, 0.330239981f,
+	0.330319971f, 0.33039999f, 0.33047998f, 0.330559969f,
+	0.330639988f, 0.330719978f, 0.330799997f, 0.330879986f,
+	0.330959976f, 0.331039995f, 0.331119984f, 0.331199974f,
+	0.331279993f, 0.331359982f, 0.331439972f, 0.331519991f,
+	0.331599981f, 0.33167997f, 0.331759989f, 0.331839979f,
+	0.331919968f, 0.331999987f, 0.332079977f, 0.332159996f,
+	0.332239985f, 0.332319975f, 0.332399994f, 0.332479984f,
+	0.332559973f, 0.332639992f, 0.332719982f, 0.332799971f,
+	0.33287999f, 0.33295998f, 0.333039969f, 0.333119988f,
+	0.333199978f, 0.333279997f, 0.333359987f, 0.333439976f,
+	0.333519995f, 0.333599985f, 0.333679974f, 0.333759993f,
+	0.333839983f, 0.333919972f, 0.333999991f, 0.334079981f,
+	0.33415997f, 0.33423999f, 0.334319979f, 0.334399968f,
+	0.334479988f, 0.334559977f, 0.334639996f, 0.334719986f,
+	0.334799975f, 0.334879994f, 0.334959984f, 0.335039973f,
+	0.335119992f, 0.335199982f, 0.335279971f, 0.335359991f,
+	0.33543998f, 0.335519969f, 0.335599989f, 0.335679978f,
+	0.335759968f, 0.335839987f, 0.335919976f, 0.335999995f,
+	0.336079985f, 0.336159974f, 0.336239994f, 0.336319983f,
+	0.336399972f, 0.336479992f, 0.336559981f, 0.336639971f,
+	0.33671999f, 0.336799979f, 0.336879969f, 0.336959988f,
+	0.337039977f, 0.337119997f, 0.337199986f, 0.337279975f,
+	0.337359995f, 0.337439984f, 0.337519974f, 0.337599993f
+};
+
+static const double temperhum_sht1x_linear_8[256] = {
+	0, 0, 0, 0,
+	0.29546480000000003, 0.87898875000000021, 1.4616958, 2.0435859500000002,
+	2.6246592000000004, 3.2049155500000004, 3.7843550000000006, 4.362977550000001,
+	4.9407832000000003, 5.5177719500000002, 6.0939438000000008, 6.6692987500000012,
+	7.2438368000000004, 7.8175579500000003, 8.3904622, 8.9625495500000003,
+	9.5338200000000022, 10.104273550000002, 10.673910200000002, 11.242729949999999,
+	11.8107328, 12.377918750000003, 12.944287800000001, 13.50983995,
+	14.0745752, 14.63849355, 15.201595000000003, 15.763879550000002,
+	16.3253472, 16.88599795, 17.445831800000001, 18.004848750000001,
+	18.563048800000001, 19.12043195, 19.6769982, 20.232747550000003,
+	20.787680000000002, 21.341795550000001, 21.895094199999999, 22.447575950000001,
+	22.999240800000003, 23.55008875, 24.100119800000002, 24.649333949999999,
+	25.1977312, 25.745311550000004, 26.292075000000001, 26.838021550000001,
+	27.3831512, 27.927463950000003, 28.470959800000003, 29.013638750000005,
+	29.555500800000001, 30.096545950000003, 30.636774200000005, 31.176185550000007,
+	31.714780000000008, 32.252557550000006, 32.78951820000001, 33.325661950000004,
+	33.860988800000008, 34.395498750000009, 34.929191800000005, 35.462067950000005,
+	35.994127200000001, 36.525369550000008, 37.05579500000001, 37.585403550000002,
+	38.114195200000005, 38.642169950000003, 39.169327800000005, 39.69566875000001,
+	40.221192800000004, 40.745899950000009, 41.26979020000001, 41.792863550000007,
+	42.315120000000007, 42.836559550000004, 43.357182200000004, 43.876987950000007,
+	44.395976800000007, 44.91414875000001, 45.431503800000002, 45.948041950000004,
+	46.46376320000001, 46.978667550000004, 47.49275500000001, 48.006025550000004,
+	48.518479200000009, 49.03011595000001, 49.540935800000007, 50.050938750000007,
+	50.560124800000004, 51.068493950000004, 51.576046200000008, 52.082781550000007,
+	52.58870000000001, 53.093801550000009, 53.598086200000004, 54.10155395000001,
+	54.604204800000005, 55.10603875000001, 55.607055800000012, 56.10725595000001,
+	56.606639200000011, 57.105205550000008, 57.602955000000016, 58.099887550000012,
+	58.596003200000006, 59.091301949999995, 59.585783800000009, 60.079448749999997,
+	60.572296799999997, 61.064327950000006, 61.555542200000005, 62.04593955,
+	62.535520000000005, 63.024283550000007, 63.512230199999998, 63.999359949999999,
+	64.485672800000003, 64.971168750000004, 65.455847800000001, 65.939709950000008,
+	66.422755199999997, 66.904983549999997, 67.386395000000007, 67.86698955,
+	68.346767200000002, 68.825727950000015, 69.30387180000001, 69.781198750000001,
+	70.257708800000003, 70.733401950000001, 71.208278200000009, 71.68233755,
+	72.155580000000015, 72.628005550000012, 73.099614200000005, 73.570405950000008,
+	74.040380800000008, 74.509538750000004, 74.977879799999997, 75.445403950000014,
+	75.912111199999998, 76.378001549999993, 76.843075000000013, 77.307331550000001,
+	77.770771199999999, 78.233393950000007, 78.695199800000012, 79.156188749999998,
+	79.61636080000001, 80.075715950000003, 80.534254200000007, 80.991975549999992,
+	81.448880000000003, 81.904967550000009, 82.360238199999998, 82.814691950000011,
+	83.268328800000006, 83.721148749999998, 84.173151800000014, 84.624337950000012,
+	85.074707200000006, 85.524259549999996, 85.972995000000012, 86.420913550000009,
+	86.868015200000002, 87.314299950000006, 87.759767800000006, 88.204418750000002,
+	88.648252800000009, 89.091269950000012, 89.533470200000011, 89.974853550000006,
+	90.415420000000012, 90.855169549999999, 91.294102199999998, 91.732217950000006,
+	92.169516800000011, 92.605998749999998, 93.041663800000009, 93.476511950000003,
+	93.910543200000006, 94.343757550000007, 94.776155000000003, 95.20773555000001,
+	95.638499199999998, 96.068445950000012, 96.497575800000007, 96.925888749999999,
+	97.353384800000015, 97.780063949999999, 98.205926200000007, 98.630971550000012,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100,
+	100, 100, 100, 100
+};
+
+static const float temperhum_sht1x_compensation_8[256] = {
+	0.00999999978f, 0.0112800002f, 0.0125599997f, 0.0138399992f,
+	0.0151199996f, 0.0164000001f, 0.0176800005f, 0.0189599991f,
+	0.0202399995f, 0.02152f, 0.0227999985f, 0.024079999f,
+	0.0253599994f, 0.0266399998f, 0.0279199984f, 0.0291999988f,
+	0.0304799993f, 0.0317599997f, 0.033040002f, 0.0343199968f,
+	0.0355999991f, 0.0368800014f, 0.0381599963f, 0.0394399986f,
+	0.0407200009f, 0.0419999957f, 0.043279998f, 0.0445600003f,
+	0.0458399951f, 0.0471199974f, 0.0483999997f, 0.049680002f,
+	0.0509599969f, 0.0522399992f, 0.0535200015f, 0.0547999963f,
+	0.0560799986f, 0.0573600009f, 0.0586399958f, 0.059919998f,
+	0.0612000003f, 0.0624799952f, 0.0637599975f, 0.0650399998f,
+	0.0663199946f, 0.0675999969f, 0.0688799992f, 0.0701600015f,
+	0.0714399964f, 0.0727199987f, 0.0739999935f, 0.0752799958f,
+	0.0765599981f, 0.0778399929f, 0.0791199952f, 0.0803999975f,
+	0.0816799924f, 0.0829599947f, 0.084239997f, 0.0855199993f,
+	0.0867999941f, 0.0880799964f, 0.0893599987f, 0.0906399935f,
+	0.0919199958f, 0.0931999981f, 0.094479993f, 0.0957599953f,
+	0.0970399976f, 0.0983199924f, 0.0995999947f, 0.100879997f,
+	0.102159999f, 0.103439994f, 0.104719996f, 0.105999999f,
+	0.107279994f, 0.108559996f, 0.109839998f, 0.111119993f,
+	0.112399995f, 0.113679998f, 0.114959992f, 0.116239995f,
+	0.117519997f, 0.118799992f, 0.120079994f, 0.121359996f,
+	0.122639991f, 0.123919994f, 0.125200003f, 0.126479998f,
+	0.127759993f, 0.129040003f, 0.130319998f, 0.131599993f,
+	0.132880002f, 0.134159997f, 0.135440007f, 0.136720002f,
+	0.137999997f, 0.139280006f, 0.140560001f, 0.141839996f,
+	0.143120006f, 0.144400001f, 0.145679995f, 0.146960005f,
+	0.14824f, 0.149519995f, 0.150800005f, 0.152079999f,
+	0.153359994f, 0.154640004f, 0.155919999f, 0.157200009f,
+	0.158480003f, 0.159759998f, 0.161040008f, 0.162320003f,
+	0.163599998f, 0.164880008f, 0.166160002f, 0.167439997f,
+	0.168720007f, 0.170000002f, 0.171279997f, 0.172560006f,
+	0.173840001f, 0.175119996f, 0.176400006f, 0.177680001f,
+	0.178959996f, 0.180240005f, 0.18152f, 0.182799995f,
+	0.184080005f, 0.18536f, 0.186639994f, 0.187920004f,
+	0.189199999f, 0.190479994f, 0.191760004f, 0.193039998f,
+	0.194320008f, 0.195600003f, 0.196879998f, 0.198160008f,
+	0.199440002f, 0.200719997f, 0.202000007f, 0.203280002f,
+	0.204559997f, 0.205840006f, 0.207120001f, 0.208399996f,
+	0.209680006f, 0.210960001f, 0.212239996f, 0.213520005f,
+	0.2148f, 0.216079995f, 0.217360005f, 0.21864f,
+	0.219919994f, 0.221200004f, 0.222479999f, 0.223759994f,
+	0.225040004f, 0.226319999f, 0.227599993f, 0.228880003f,
+	0.230159998f, 0.231439993f, 0.232720003f, 0.233999997f,
+	0.235279992f, 0.236560002f, 0.237839997f, 0.239120007f,
+	0.240400001f, 0.241679996f, 0.242960006f, 0.244240001f,
+	0.245519996f, 0.246800005f, 0.24808f, 0.249359995f,
+	0.250640005f, 0.251919985f, 0.253199995f, 0.254480004f,
+	0.255759984f, 0.257039994f, 0.258320004f, 0.259599984f,
+	0.260879993f, 0.262159973f, 0.263439983f, 0.264719993f,
+	0.265999973f, 0.267279983f, 0.268559992f, 0.269839972f,
+	0.271119982f, 0.272399992f, 0.273679972f, 0.274959981f,
+	0.276239991f, 0.277519971f, 0.278799981f, 0.280079991f,
+	0.281359971f, 0.28263998f, 0.28391999f, 0.28519997f,
+	0.28647998f, 0.28775999f, 0.289039969f, 0.290319979f,
+	0.291599989f, 0.292879969f, 0.294159979f, 0.295439988f,
+	0.296719968f, 0.297999978f, 0.299279988f, 0.300559998f,
+	0.301839978f, 0.303119987f, 0.304399997f, 0.305679977f,
+	0.306959987f, 0.308239996f, 0.309519976f, 0.310799986f,
+	0.312079996f, 0.313359976f, 0.314639986f, 0.315919995f,
+	0.317199975f, 0.318479985f, 0.319759995f, 0.321039975f,
+	0.322319984f, 0.323599994f, 0.324879974f, 0.326159984f,
+	0.327439994f, 0.328719974f, 0.329999983f, 0.331279993f,
+	0.332559973f, 0.333839983f, 0.335119992f, 0.336399972f
+};
@@ -0,0 +1,503 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Conversion of raw SHT1x readings. Calibrations are resolved once into
+ * converters, so converting a reading takes no decisions on coefficients.
+ *
+ * Batch conversion is used to recompute history with another calibration.
+ * An AVX2 kernel converts 4 readings at once where the cpu supports it,
+ * it gives the same temperature and humidity as the scalar conversion and
+ * a dew point which differs in the last bits of log() only.
+ *
+ * Fixed point conversion gives hundredths of C and % using integers only,
+ * for cpus without floating point. Against the double conversion it is off by
+ * at most 0.005 C for temperature (rounding to hundredths), 0.006 % for
+ * humidity and 0.01 C for dew point, for readings with a humidity above 1 %.
+ *
+ * Fast dew point takes the logarithm from a table of 64 steps with linear
+ * interpolation, it differs from temperhum_dew_point() by less than 0.001 C
+ * for -40 - 50 C and 0.01 - 100 %, far below the accuracy of the sensor.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-sht1x.h"
+#include "temper-hum-hid-sht1x-tables.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEMPERHUM_SHT1X_AVX2 1
+#include <immintrin.h>
+#else
+#define TEMPERHUM_SHT1X_AVX2 0
+#endif
+
+#define TEMPERHUM_SHT1X_VOLTAGES 5
+#define TEMPERHUM_LOG2_STEPS 64
+#define TEMPERHUM_FIXED_SHIFT 30
+#define TEMPERHUM_FIXED_HUMIDITY_SHIFT 16 /** precision of humidity the dew point is computed from */
+#define TEMPERHUM_FIXED(x) ((int64_t) ((x) * (double) (1LL << TEMPERHUM_FIXED_SHIFT) + ((x) < 0 ? -0.5 : 0.5)))
+#define TEMPERHUM_FIXED_LN2 744261118LL /** ln(2) scaled by 2^30 */
+#define TEMPERHUM_FIXED_LN_10000 154523870LL /** ln(10000) scaled by 2^24 */
+
+/**
+ * Datasheet SHT1x coefficients, see temperhum_sht1x_fill_temperature() and
+ * temperhum_sht1x_fill_humidity() for where they come from. Humidity tables
+ * are generated from the same coefficients by temper-hum-hid-sht1x-gen.c.
+ */
+#define TEMPERHUM_SHT1X_VOLTAGE_2_5 .d1 = -39.4, .d1_centi = -3940
+#define TEMPERHUM_SHT1X_VOLTAGE_3_0 .d1 = -39.6, .d1_centi = -3960
+#define TEMPERHUM_SHT1X_VOLTAGE_3_5 .d1 = -39.7, .d1_centi = -3970
+#define TEMPERHUM_SHT1X_VOLTAGE_4_0 .d1 = -39.8, .d1_centi = -3980
+#define TEMPERHUM_SHT1X_VOLTAGE_5_0 .d1 = -40.1, .d1_centi = -4010
+#define TEMPERHUM_SHT1X_TEMPERATURE_14 .d2 = 0.01, .d2_centi = 1
+#define TEMPERHUM_SHT1X_TEMPERATURE_12 .d2 = 0.04, .d2_centi = 4
+#define TEMPERHUM_SHT1X_HUMIDITY_12 \
+	.c1 = -2.0468, .c2 = 0.0367, .c3 = -1.5955e-6, .t1 = 0.01, .t2 = 0.00008, \
+	.mask = 4095, .linear = temperhum_sht1x_linear_12, .compensation = temperhum_sht1x_compensation_12, \
+	.c1_fixed = TEMPERHUM_FIXED(-204.68), .c2_fixed = TEMPERHUM_FIXED(3.67), .c3_fixed = TEMPERHUM_FIXED(-1.5955e-4), \
+	.t1_fixed = TEMPERHUM_FIXED(0.01), .t2_fixed = TEMPERHUM_FIXED(0.00008)
+#define TEMPERHUM_SHT1X_HUMIDITY_8 \
+	.c1 = -2.0468, .c2 = 0.5872, .c3 = -4.0845e-4, .t1 = 0.01, .t2 = 0.00128, \
+	.mask = 255, .linear = temperhum_sht1x_linear_8, .compensation = temperhum_sht1x_compensation_8, \
+	.c1_fixed = TEMPERHUM_FIXED(-204.68), .c2_fixed = TEMPERHUM_FIXED(58.72), .c3_fixed = TEMPERHUM_FIXED(-4.0845e-2), \
+	.t1_fixed = TEMPERHUM_FIXED(0.01), .t2_fixed = TEMPERHUM_FIXED(0.00128)
+#define TEMPERHUM_SHT1X_CONVERTERS(voltage) { \
+	{{voltage, TEMPERHUM_SHT1X_TEMPERATURE_14, TEMPERHUM_SHT1X_HUMIDITY_12}, {voltage, TEMPERHUM_SHT1X_TEMPERATURE_14, TEMPERHUM_SHT1X_HUMIDITY_8}}, \
+	{{voltage, TEMPERHUM_SHT1X_TEMPERATURE_12, TEMPERHUM_SHT1X_HUMIDITY_12}, {voltage, TEMPERHUM_SHT1X_TEMPERATURE_12, TEMPERHUM_SHT1X_HUMIDITY_8}} \
+}
+
+/**
+ * D1 of a voltage applies above the previous voltage, the lowest one matches exactly only
+ */
+static const double temperhum_sht1x_voltages[TEMPERHUM_SHT1X_VOLTAGES] = {2.5, 3.0, 3.5, 4.0, 5.0};
+static const int temperhum_sht1x_temperatures[2] = {14, 12};
+static const int temperhum_sht1x_humidities[2] = {12, 8};
+
+/**
+ * Converter of every calibration by voltage, temperature and humidity
+ * resolution, in the order of the tables above
+ */
+static const struct temperhum_sht1x temperhum_sht1x_converters[TEMPERHUM_SHT1X_VOLTAGES][2][2] = {
+	TEMPERHUM_SHT1X_CONVERTERS(TEMPERHUM_SHT1X_VOLTAGE_2_5),
+	TEMPERHUM_SHT1X_CONVERTERS(TEMPERHUM_SHT1X_VOLTAGE_3_0),
+	TEMPERHUM_SHT1X_CONVERTERS(TEMPERHUM_SHT1X_VOLTAGE_3_5),
+	TEMPERHUM_SHT1X_CONVERTERS(TEMPERHUM_SHT1X_VOLTAGE_4_0),
+	TEMPERHUM_SHT1X_CONVERTERS(TEMPERHUM_SHT1X_VOLTAGE_5_0)
+};
+
+/**
+ * log2(1 + i / 64), the error of interpolating between steps is below 4.4e-5
+ */
+static const double temperhum_log2_table[TEMPERHUM_LOG2_STEPS + 1] = {
+	0, 0.02236781302845451, 0.044394119358453436, 0.066089190457772437,
+	0.087462841250339401, 0.10852445677816905, 0.12928301694496647, 0.14974711950468206,
+	0.16992500144231237, 0.18982455888001723, 0.20945336562894978, 0.22881869049588088,
+	0.24792751344358549, 0.26678654069490138, 0.28540221886224837, 0.30378074817710293,
+	0.32192809488736235, 0.33985000288462475, 0.35755200461808367, 0.37503943134692475,
+	0.39231742277876031, 0.40939093613770178, 0.42626475470209796, 0.44294349584872827,
+	0.45943161863729726, 0.47573343096639775, 0.49185309632967472, 0.50779464019869625,
+	0.52356195605701283, 0.53915881110803143, 0.55458885167763738, 0.56985560833094784,
+	0.58496250072115619, 0.5999128421871277, 0.61470984411520824, 0.62935662007960957,
+	0.6438561897747247, 0.65821148275179475, 0.67242534197149562, 0.68650052718321841,
+	0.70043971814109218, 0.71424551766612265, 0.7279204545631992, 0.74146698640114694,
+	0.75488750216346856, 0.76818432477692633, 0.7813597135246596, 0.79441586635010597,
+	0.80735492205760406, 0.82017896241518773, 0.83289001416474162, 0.84549005094437524,
+	0.85798099512757209, 0.87036471958340456, 0.88264304936184124, 0.89481776330794349,
+	0.90689059560851848, 0.91886323727459451, 0.93073733756288624, 0.94251450533923986,
+	0.95419631038687525, 0.96578428466208699, 0.97727992349991644, 0.98868468677216581,
+	1
+};
+
+static int temperhum_sht1x_simd = -1; /** -1 until the cpu is checked */
+
+/**
+ * Clamped linear humidity of a reading, computed from the coefficients
+ */
+double temperhum_sht1x_humidity_linear(const struct temperhum_sht1x * sht1x, int sorh)
+{
+	double humidity_linear = sht1x->c1 + sht1x->c2 * sorh + sht1x->c3 * sorh * sorh;
+	if (humidity_linear < 0) {
+		humidity_linear = 0;
+	}
+	if (humidity_linear > 99) {
+		humidity_linear = 100;
+	}
+
+	return humidity_linear;
+}
+
+/**
+ * Converter for a calibration, NULL if the calibration is not supported
+ */
+const struct temperhum_sht1x * temperhum_sht1x_converter(const struct temperhum_calibration * calibration)
+{
+	double voltage = calibration->sensor_voltage ? calibration->sensor_voltage : DEFAULT_SENSOR_VOLTAGE;
+	int resolution_temperature = calibration->measurement_resolution_temperature ? calibration->measurement_resolution_temperature : DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE;
+	int resolution_humidity = calibration->measurement_resolution_humidity ? calibration->measurement_resolution_humidity : DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY;
+	int v, t, h;
+
+	for (v = 0; v < TEMPERHUM_SHT1X_VOLTAGES; v++) {
+		if (v ? voltage > temperhum_sht1x_voltages[v - 1] && voltage <= temperhum_sht1x_voltages[v] : voltage == temperhum_sht1x_voltages[v]) {
+			break;
+		}
+	}
+	if (v == TEMPERHUM_SHT1X_VOLTAGES) {
+		temperhum_error(0, "Wrong value for sensor voltage: %.1f", voltage);
+		return NULL;
+	}
+
+	for (t = 0; t < 2 && temperhum_sht1x_temperatures[t] != resolution_temperature; t++);
+	if (t == 2) {
+		temperhum_error(0, "Wrong value of measurement resolution for temperature: %i", resolution_temperature);
+		return NULL;
+	}
+
+	for (h = 0; h < 2 && temperhum_sht1x_humidities[h] != resolution_humidity; h++);
+	if (h == 2) {
+		temperhum_error(0, "Wrong value of measurement resolution for humidity: %i", resolution_humidity);
+		return NULL;
+	}
+
+	return &temperhum_sht1x_converters[v][t][h];
+}
+
+/**
+ * Converts readings one by one the way temperhum_fill() does
+ */
+static void temperhum_sht1x_convert_scalar(const struct temperhum_sht1x * sht1x, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, double * temperature, double * humidity, double * dew_point)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		int sot = raw_temperature[i];
+		int sorh = temperhum_sht1x_index(sht1x, raw_humidity[i]);
+
+		temperature[i] = sht1x->d1 + sht1x->d2 * sot;
+		humidity[i] = (temperature[i] - 25) * sht1x->compensation[sorh] + sht1x->linear[sorh];
+		dew_point[i] = temperhum_dew_point(temperature[i], humidity[i]);
+	}
+}
+
+/**
+ * Division rounding to the nearest integer, divisor has to be positive
+ */
+static int64_t temperhum_fixed_divide(int64_t dividend, int64_t divisor)
+{
+	return dividend >= 0 ? (dividend + divisor / 2) / divisor : -((-dividend + divisor / 2) / divisor);
+}
+
+/**
+ * Temperature in hundredths of C of a reading
+ */
+int32_t temperhum_sht1x_temperature_fixed(const struct temperhum_sht1x * sht1x, int sot)
+{
+	return sht1x->d1_centi + sht1x->d2_centi * sot;
+}
+
+/**
+ * Compensated humidity in hundredths of % scaled by 2^16 of a reading,
+ * temperature is in hundredths of C. The dew point needs humidity more
+ * precise than hundredths as the logarithm of it is taken.
+ */
+static int64_t temperhum_sht1x_humidity_precise(const struct temperhum_sht1x * sht1x, int32_t temperature, int sorh)
+{
+	int64_t humidity_linear = sht1x->c1_fixed + sht1x->c2_fixed * sorh + sht1x->c3_fixed * sorh * sorh;
+	if (humidity_linear < 0) {
+		humidity_linear = 0;
+	}
+	if (humidity_linear > (9900LL << TEMPERHUM_FIXED_SHIFT)) {
+		humidity_linear = 10000LL << TEMPERHUM_FIXED_SHIFT;
+	}
+
+	int64_t compensation = sht1x->t1_fixed + sht1x->t2_fixed * sorh;
+
+	return temperhum_fixed_divide(humidity_linear + (temperature - 2500) * compensation, 1LL << (TEMPERHUM_FIXED_SHIFT - TEMPERHUM_FIXED_HUMIDITY_SHIFT));
+}
+
+/**
+ * Compensated humidity in hundredths of % of a reading, temperature is in hundredths of C
+ */
+int32_t temperhum_sht1x_humidity_fixed(const struct temperhum_sht1x * sht1x, int32_t temperature, int sorh)
+{
+	return temperhum_fixed_divide(temperhum_sht1x_humidity_precise(sht1x, temperature, sorh), 1LL << TEMPERHUM_FIXED_HUMIDITY_SHIFT);
+}
+
+/**
+ * Natural logarithm of a positive integer below 2^31 scaled by 2^24. The binary logarithm
+ * of the mantissa is found bit by bit: squaring it doubles the logarithm,
+ * a square of 2 or more means the next bit is set.
+ */
+static int64_t temperhum_fixed_log(uint32_t x)
+{
+	int exponent = 31 - __builtin_clz(x);
+	uint64_t mantissa = (uint64_t) x << (30 - exponent); // 1.0 is 2^30
+	int64_t log2 = (int64_t) exponent << 24;
+	int64_t bit;
+
+	for (bit = 1 << 23; bit; bit >>= 1) {
+		mantissa = (mantissa * mantissa) >> 30;
+		if (mantissa >= (2ULL << 30)) {
+			mantissa >>= 1;
+			log2 += bit;
+		}
+	}
+
+	return (log2 * TEMPERHUM_FIXED_LN2) >> 30;
+}
+
+/**
+ * Dew point in hundredths of C for a temperature in hundredths of C and a
+ * relative humidity in hundredths of % scaled by 2^shift, see temperhum_dew_point()
+ */
+static int32_t temperhum_dew_point_scaled(int32_t temperature, int64_t humidity, int shift)
+{
+	int64_t tn = 24312; // Tn in hundredths of C
+	int64_t m = 295614546; // m scaled by 2^24
+	if (temperature < 0) {
+		tn = 27262;
+		m = 376816271;
+	}
+
+	if (humidity <= 0 || humidity > INT32_MAX || tn + temperature <= 0) {
+		return TEMPERHUM_FIXED_INVALID;
+	}
+
+	int64_t gamma = temperhum_fixed_log(humidity) - ((shift * TEMPERHUM_FIXED_LN2) >> 6) - TEMPERHUM_FIXED_LN_10000 + m * temperature / (tn + temperature);
+	if (m - gamma <= 0) {
+		return TEMPERHUM_FIXED_INVALID;
+	}
+
+	return temperhum_fixed_divide(tn * gamma, m - gamma);
+}
+
+/**
+ * Dew point in hundredths of C of a reading, temperature is in hundredths of C
+ */
+int32_t temperhum_sht1x_dew_point_fixed(const struct temperhum_sht1x * sht1x, int32_t temperature, int sorh)
+{
+	return temperhum_dew_point_scaled(temperature, temperhum_sht1x_humidity_precise(sht1x, temperature, sorh), TEMPERHUM_FIXED_HUMIDITY_SHIFT);
+}
+
+/**
+ * Dew point in hundredths of C for a temperature in hundredths of C and a
+ * relative humidity in hundredths of %, see temperhum_dew_point()
+ */
+int32_t temperhum_dew_point_fixed(int32_t temperature, int32_t humidity)
+{
+	return temperhum_dew_point_scaled(temperature, humidity, 0);
+}
+
+/**
+ * Natural logarithm of a positive normal double from the table, by the
+ * exponent and the fraction of the mantissa taken from its bits
+ */
+static double temperhum_fast_log(double x)
+{
+	uint64_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+
+	int exponent = (int) (bits >> 52) - 1023;
+	uint64_t fraction = bits & 0x000FFFFFFFFFFFFFULL;
+	int step = fraction >> (52 - 6);
+	double position = (fraction & ((1ULL << (52 - 6)) - 1)) * (1.0 / (1ULL << (52 - 6)));
+	double log2 = exponent + temperhum_log2_table[step] + (temperhum_log2_table[step + 1] - temperhum_log2_table[step]) * position;
+
+	return log2 * M_LN2;
+}
+
+/**
+ * Dew point like temperhum_dew_point() with a table based logarithm
+ */
+double temperhum_dew_point_fast(double temperature, double humidity)
+{
+	double Tn = 243.12;
+	double m = 17.62;
+	if (temperature < 0) {
+		Tn = 272.62;
+		m = 22.46;
+	}
+
+	double x = humidity / 100;
+	// zero, negative, subnormal, infinite and NaN humidity behave the same as with log()
+	double logarithm = x >= 2.2250738585072014e-308 && x < INFINITY ? temperhum_fast_log(x) : log(x);
+	// gamma = logarithm + m * T / (Tn + T) multiplied by (Tn + T) saves a division
+	double denominator = Tn + temperature;
+	double gamma = logarithm * denominator + m * temperature;
+
+	return Tn * gamma / (m * denominator - gamma);
+}
+
+#if TEMPERHUM_SHT1X_AVX2
+/**
+ * Natural logarithm of 4 positive normal doubles: x = 2^e * m with m in
+ * [sqrt(2)/2, sqrt(2)), log(m) = 2 * atanh((m - 1) / (m + 1)) as a series
+ */
+__attribute__((target("avx2")))
+static __m256d temperhum_sht1x_log(__m256d x)
+{
+	const __m256i mantissa_mask = _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL);
+	const __m256i one_bits = _mm256_set1_epi64x(0x3FF0000000000000LL);
+	const __m256i magic_bits = _mm256_set1_epi64x(0x4330000000000000LL); // 2^52
+	const __m256d one = _mm256_set1_pd(1);
+
+	__m256i bits = _mm256_castpd_si256(x);
+	__m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, mantissa_mask), one_bits));
+	// exponent bits fit into the mantissa of 2^52, which turns them into a double
+	__m256i exponent_bits = _mm256_srli_epi64(bits, 52);
+	__m256d e = _mm256_sub_pd(
+		_mm256_castsi256_pd(_mm256_or_si256(exponent_bits, magic_bits)),
+		_mm256_set1_pd(4503599627370496.0 + 1023)
+	);
+
+	__m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(M_SQRT2), _CMP_GT_OQ);
+	m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+	e = _mm256_add_pd(e, _mm256_and_pd(big, one));
+
+	__m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+	__m256d z = _mm256_mul_pd(s, s);
+	// |s| < 0.1716, terms after z^9 / 19 are below double precision
+	__m256d series = _mm256_set1_pd(1.0 / 19);
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 17));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 15));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 13));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 11));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 9));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 7));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 5));
+	series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 3));
+	series = _mm256_mul_pd(series, z);
+	__m256d log_m = _mm256_add_pd(_mm256_add_pd(s, s), _mm256_mul_pd(_mm256_add_pd(s, s), series));
+
+	// ln(2) split in a part exact when multiplied by the exponent and the rest
+	return _mm256_add_pd(
+		_mm256_mul_pd(e, _mm256_set1_pd(6.93147180369123816490e-01)),
+		_mm256_add_pd(log_m, _mm256_mul_pd(e, _mm256_set1_pd(1.90821492927058770002e-10)))
+	);
+}
+
+/**
+ * Converts 4 readings at once, blocks with a humidity log() is not defined
+ * for (dry sensors below 0 %) are left to the scalar conversion
+ */
+__attribute__((target("avx2")))
+static void temperhum_sht1x_convert_avx2(const struct temperhum_sht1x * sht1x, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, double * temperature, double * humidity, double * dew_point)
+{
+	const __m128 d1 = _mm_set1_ps(sht1x->d1);
+	const __m128 d2 = _mm_set1_ps(sht1x->d2);
+	const __m128 t1 = _mm_set1_ps(sht1x->t1);
+	const __m128 t2 = _mm_set1_ps(sht1x->t2);
+	const __m256d c1 = _mm256_set1_pd(sht1x->c1);
+	const __m256d c2 = _mm256_set1_pd(sht1x->c2);
+	const __m256d c3 = _mm256_set1_pd(sht1x->c3);
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d smallest = _mm256_set1_pd(2.2250738585072014e-308 * 100); // log() series needs normal numbers
+	const __m128i mask = _mm_set1_epi32(sht1x->mask);
+	size_t i;
+
+	for (i = 0; i + 4 <= count; i += 4) {
+		__m128i sot = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *) (raw_temperature + i)));
+		__m128i sorh = _mm_min_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *) (raw_humidity + i))), mask);
+
+		// float math as in the scalar conversion, so results are the same
+		__m256d t = _mm256_cvtps_pd(_mm_add_ps(d1, _mm_mul_ps(d2, _mm_cvtepi32_ps(sot))));
+
+		__m256d rh = _mm256_cvtepi32_pd(sorh);
+		__m256d linear = _mm256_add_pd(_mm256_add_pd(c1, _mm256_mul_pd(c2, rh)), _mm256_mul_pd(_mm256_mul_pd(c3, rh), rh));
+		linear = _mm256_blendv_pd(linear, zero, _mm256_cmp_pd(linear, zero, _CMP_LT_OQ));
+		linear = _mm256_blendv_pd(linear, _mm256_set1_pd(100), _mm256_cmp_pd(linear, _mm256_set1_pd(99), _CMP_GT_OQ));
+		__m256d compensation = _mm256_cvtps_pd(_mm_add_ps(t1, _mm_mul_ps(t2, _mm_cvtepi32_ps(sorh))));
+		__m256d h = _mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(t, _mm256_set1_pd(25)), compensation), linear);
+
+		_mm256_storeu_pd(temperature + i, t);
+		_mm256_storeu_pd(humidity + i, h);
+
+		if (_mm256_movemask_pd(_mm256_cmp_pd(h, smallest, _CMP_GE_OQ)) != 0xF) {
+			int j;
+			for (j = 0; j < 4; j++) {
+				dew_point[i + j] = temperhum_dew_point(temperature[i + j], humidity[i + j]);
+			}
+			continue;
+		}
+
+		// above ice below 0 C, see temperhum_dew_point()
+		__m256d ice = _mm256_cmp_pd(t, zero, _CMP_LT_OQ);
+		__m256d tn = _mm256_blendv_pd(_mm256_set1_pd(243.12), _mm256_set1_pd(272.62), ice);
+		__m256d m = _mm256_blendv_pd(_mm256_set1_pd(17.62), _mm256_set1_pd(22.46), ice);
+		__m256d gamma = _mm256_add_pd(
+			temperhum_sht1x_log(_mm256_div_pd(h, _mm256_set1_pd(100))),
+			_mm256_div_pd(_mm256_mul_pd(m, t), _mm256_add_pd(tn, t))
+		);
+		_mm256_storeu_pd(dew_point + i, _mm256_div_pd(_mm256_mul_pd(tn, gamma), _mm256_sub_pd(m, gamma)));
+	}
+
+	temperhum_sht1x_convert_scalar(sht1x, raw_temperature + i, raw_humidity + i, count - i, temperature + i, humidity + i, dew_point + i);
+}
+#endif
+
+/**
+ * Enables or disables the SIMD conversion, returns whether it is used,
+ * it never is on cpus without AVX2
+ */
+int temperhum_set_simd(int enabled)
+{
+#if TEMPERHUM_SHT1X_AVX2
+	__builtin_cpu_init();
+	temperhum_sht1x_simd = enabled && __builtin_cpu_supports("avx2");
+#else
+	temperhum_sht1x_simd = 0;
+#endif
+
+	return temperhum_sht1x_simd;
+}
+
+/**
+ * Converts arrays of raw temperature (SOT) and humidity (SORH) readings of
+ * a sensor with given calibration into temperature, humidity and dew point
+ */
+int temperhum_sht1x_convert(const struct temperhum_calibration * calibration, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, double * temperature, double * humidity, double * dew_point)
+{
+	const struct temperhum_sht1x *sht1x = temperhum_sht1x_converter(calibration);
+
+	if (!sht1x) {
+		return -1;
+	}
+	if (temperhum_sht1x_simd < 0) {
+		temperhum_set_simd(1);
+	}
+
+#if TEMPERHUM_SHT1X_AVX2
+	if (temperhum_sht1x_simd) {
+		temperhum_sht1x_convert_avx2(sht1x, raw_temperature, raw_humidity, count, temperature, humidity, dew_point);
+		return 0;
+	}
+#endif
+	temperhum_sht1x_convert_scalar(sht1x, raw_temperature, raw_humidity, count, temperature, humidity, dew_point);
+
+	return 0;
+}
+
+/**
+ * Converts arrays of raw readings like temperhum_sht1x_convert() does, into
+ * hundredths of C and % computed with integers only
+ */
+int temperhum_sht1x_convert_fixed(const struct temperhum_calibration * calibration, const uint16_t * raw_temperature, const uint16_t * raw_humidity, size_t count, int32_t * temperature, int32_t * humidity, int32_t * dew_point)
+{
+	const struct temperhum_sht1x *sht1x = temperhum_sht1x_converter(calibration);
+	size_t i;
+
+	if (!sht1x) {
+		return -1;
+	}
+
+	for (i = 0; i < count; i++) {
+		temperature[i] = temperhum_sht1x_temperature_fixed(sht1x, raw_temperature[i]);
+		int64_t precise = temperhum_sht1x_humidity_precise(sht1x, temperature[i], raw_humidity[i]);
+		humidity[i] = temperhum_fixed_divide(precise, 1LL << TEMPERHUM_FIXED_HUMIDITY_SHIFT);
+		dew_point[i] = temperhum_dew_point_scaled(temperature[i], precise, TEMPERHUM_FIXED_HUMIDITY_SHIFT);
+	}
+
+	return 0;
+}
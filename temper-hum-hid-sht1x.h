@@ -0,0 +1,58 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Internal: SHT1x conversion coefficients shared by the per-device and batch conversions
+ */
+
+#ifndef TEMPER_HUM_HID_SHT1X
+#define TEMPER_HUM_HID_SHT1X
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "temper-hum-hid-api.h"
+
+#define DEFAULT_SENSOR_VOLTAGE 3.5
+#define DEFAULT_MEASUREMENT_RESOLUTION_TEMPERATURE 14
+#define DEFAULT_MEASUREMENT_RESOLUTION_HUMIDITY 12
+
+/**
+ * Converter specialized for a calibration, float coefficients are kept float
+ * as the conversion always rounded them to float. Humidity readings are
+ * converted by tables generated at build time, which give the very same
+ * values as the formulas. Readings above the resolution can only be garbage,
+ * they take the entry of the largest reading.
+ */
+struct temperhum_sht1x {
+	float d1, d2; /** temperature = D1 + D2 * SOT */
+	double c1, c2, c3; /** linear humidity = C1 + C2 * SORH + C3 * SORH^2 */
+	float t1, t2; /** humidity = (temperature - 25) * (T1 + T2 * SORH) + linear humidity */
+	int mask; /** largest humidity reading in the tables */
+	const double *linear; /** clamped linear humidity by SORH */
+	const float *compensation; /** T1 + T2 * SORH by SORH */
+	int32_t d1_centi, d2_centi; /** D1 and D2 in hundredths of C, both are exact */
+	int64_t c1_fixed, c2_fixed, c3_fixed; /** C1, C2 and C3 in hundredths of %, scaled by 2^30 */
+	int64_t t1_fixed, t2_fixed; /** T1 and T2 scaled by 2^30 */
+};
+
+const struct temperhum_sht1x * temperhum_sht1x_converter(const struct temperhum_calibration * calibration);
+double temperhum_sht1x_humidity_linear(const struct temperhum_sht1x * sht1x, int sorh);
+int32_t temperhum_sht1x_temperature_fixed(const struct temperhum_sht1x * sht1x, int sot);
+int32_t temperhum_sht1x_humidity_fixed(const struct temperhum_sht1x * sht1x, int32_t temperature, int sorh);
+int32_t temperhum_sht1x_dew_point_fixed(const struct temperhum_sht1x * sht1x, int32_t temperature, int sorh);
+
+/**
+ * Index of a humidity reading in the tables of a converter
+ */
+static inline int temperhum_sht1x_index(const struct temperhum_sht1x * sht1x, int sorh)
+{
+	return sorh < sht1x->mask ? sorh : sht1x->mask;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_SHT1X */
@@ -0,0 +1,604 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Simulated temperhum devices answering the Tenx HID protocol in process,
+ * used for benchmarks and load tests without sensors. Enabled with
+ * temperhum_set_transport("sim:devices=100,latency=1000,measure=400,sot=6500,sorh=1400,timeout=0.01,garbage=0.01,seed=1")
+ *   devices  amount of simulated devices
+ *   latency  time in us every transfer takes
+ *   measure  time in ms the sensor needs for a measurement, reading earlier returns 0xFF garbage
+ *   sot      raw temperature the sensors report, every next device reports 0.1 C more
+ *   sorh     raw humidity the sensors report
+ *   timeout  probability of a transfer timing out
+ *   garbage  probability of a measurement returning 0xFF garbage
+ *   seed     seed for the random failures
+ *
+ * Replayed devices answer with transfers recorded by temperhum_capture_start(),
+ * enabled with temperhum_set_transport("replay:file=capture.thhc,speed=1")
+ *   file     capture to replay
+ *   speed    how many times faster than recorded transfers complete, 0 completes them at once
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-transport.h"
+#include "temper-hum-hid-capture.h"
+
+#define TEMPERHUM_SIM_RESPONSE_LENGTH 8
+
+/**
+ * State of a simulated sensor
+ */
+struct temperhum_sim_device {
+	int index;
+	int initialized; /** 0x52 init command was received */
+	unsigned char pending; /** last command received, answered by the next Get_Report */
+	int64_t ready_at; /** monotonic time in us the measurement is done */
+};
+
+/**
+ * Asynchronous transfer waiting for its completion time
+ */
+struct temperhum_sim_transfer {
+	int64_t due;
+	void *user_data;
+	int status;
+	unsigned char *data;
+	int size;
+};
+
+static struct {
+	int devices;
+	int latency;
+	int measure;
+	int sot;
+	int sorh;
+	double timeout;
+	double garbage;
+	uint64_t random;
+} temperhum_sim;
+
+/**
+ * State of a replayed device, cursor is the next record to look at
+ */
+struct temperhum_replay_device {
+	int index;
+	int cursor;
+	int attached;
+};
+
+static struct {
+	struct temperhum_capture capture;
+	struct temperhum_replay_device *devices;
+	double speed;
+} temperhum_replay;
+
+static struct temperhum_sim_device **temperhum_sim_devices = NULL;
+static struct temperhum_sim_transfer *temperhum_sim_transfers = NULL;
+static int temperhum_sim_transfer_count = 0;
+static int temperhum_sim_transfer_size = 0;
+
+/**
+ * Current monotonic time in microseconds
+ */
+static int64_t temperhum_sim_now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * Sleeps given amount of us, if any
+ */
+static void temperhum_sim_sleep(int64_t time)
+{
+	if (time > 0) {
+		usleep(time);
+	}
+}
+
+/**
+ * Uniform random number in [0, 1), xorshift64* so runs with the same seed repeat
+ */
+static double temperhum_sim_random()
+{
+	temperhum_sim.random ^= temperhum_sim.random >> 12;
+	temperhum_sim.random ^= temperhum_sim.random << 25;
+	temperhum_sim.random ^= temperhum_sim.random >> 27;
+
+	return ((temperhum_sim.random * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Parses options and allocates simulated devices
+ */
+static int temperhum_sim_init(const char * options)
+{
+	char buffer[256], *item, *state;
+
+	temperhum_sim.devices = 1;
+	temperhum_sim.latency = 1000;
+	temperhum_sim.measure = 400; /** 14 bit temperature and 12 bit humidity of a real sensor */
+	temperhum_sim.sot = 6500;
+	temperhum_sim.sorh = 1400;
+	temperhum_sim.timeout = 0;
+	temperhum_sim.garbage = 0;
+	temperhum_sim.random = 1;
+
+	snprintf(buffer, sizeof(buffer), "%s", options);
+	for (item = strtok_r(buffer, ",", &state); item; item = strtok_r(NULL, ",", &state)) {
+		char key[32];
+		double value;
+
+		if (sscanf(item, "%31[^=]=%lf", key, &value) != 2) {
+			temperhum_error(0, "Wrong simulation option '%s'", item);
+			return -1;
+		}
+		if (!strcmp(key, "devices")) {
+			temperhum_sim.devices = value;
+		} else if (!strcmp(key, "latency")) {
+			temperhum_sim.latency = value;
+		} else if (!strcmp(key, "measure")) {
+			temperhum_sim.measure = value;
+		} else if (!strcmp(key, "sot")) {
+			temperhum_sim.sot = value;
+		} else if (!strcmp(key, "sorh")) {
+			temperhum_sim.sorh = value;
+		} else if (!strcmp(key, "timeout")) {
+			temperhum_sim.timeout = value;
+		} else if (!strcmp(key, "garbage")) {
+			temperhum_sim.garbage = value;
+		} else if (!strcmp(key, "seed")) {
+			temperhum_sim.random = value ? (uint64_t) value : 1;
+		} else {
+			temperhum_error(0, "Unknown simulation option '%s'", key);
+			return -1;
+		}
+	}
+
+	if (temperhum_sim.devices < 0 || temperhum_sim.sot <= 0 || temperhum_sim.sorh <= 0) {
+		temperhum_error(0, "Wrong simulation options '%s'", options);
+		return -1;
+	}
+
+	temperhum_sim_devices = calloc(temperhum_sim.devices + 1, sizeof(struct temperhum_sim_device *));
+	if (!temperhum_sim_devices) {
+		return -1;
+	}
+
+	temperhum_debug("Simulating %i devices", temperhum_sim.devices);
+
+	return 0;
+}
+
+/**
+ * Frees transfers still pending
+ */
+static void temperhum_sim_free_transfers()
+{
+	free(temperhum_sim_transfers);
+	temperhum_sim_transfers = NULL;
+	temperhum_sim_transfer_count = 0;
+	temperhum_sim_transfer_size = 0;
+}
+
+/**
+ * Frees simulation state, devices are closed by the api before
+ */
+static void temperhum_sim_exit()
+{
+	free(temperhum_sim_devices);
+	temperhum_sim_devices = NULL;
+	temperhum_sim_free_transfers();
+}
+
+/**
+ * Attaches simulated devices which are not attached
+ */
+static int temperhum_sim_scan()
+{
+	int i;
+
+	for (i = 0; i < temperhum_sim.devices; i++) {
+		char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+
+		if (temperhum_sim_devices[i]) {
+			continue;
+		}
+
+		struct temperhum_sim_device *sim = calloc(1, sizeof(struct temperhum_sim_device));
+		if (!sim) {
+			return -1;
+		}
+		sim->index = i;
+
+		// simulated devices have no libusb handle, their state stands in for it
+		snprintf(port_path, sizeof(port_path), "sim-%i", i + 1);
+		if (!temperhum_transport_attach(1 + i / 127, 1 + i % 127, 1, port_path, sim)) {
+			free(sim);
+			return -1;
+		}
+		temperhum_sim_devices[i] = sim;
+	}
+
+	return 0;
+}
+
+/**
+ * Lets a simulated sensor process a transfer happening at given time.
+ * Returns amount of bytes transferred, status is set as libusb sets it on a timeout.
+ */
+static int temperhum_sim_process(temperhum_device * device, int direction, unsigned char * data, int length, int64_t at, int * status)
+{
+	struct temperhum_sim_device *sim = (struct temperhum_sim_device *) device->handle;
+
+	*status = 0;
+	if (temperhum_sim.timeout > 0 && temperhum_sim_random() < temperhum_sim.timeout) {
+		*status = LIBUSB_TRANSFER_TIMED_OUT;
+		return 0;
+	}
+
+	if (direction == TEMPERHUM_TRANSFER_OUT) {
+		sim->pending = length > 8 ? data[8] : 0x00;
+		if (sim->pending == 0x52) {
+			sim->initialized = 1;
+			sim->ready_at = at;
+		} else if (sim->pending == 0x48) {
+			sim->ready_at = at + temperhum_sim.measure * 1000LL;
+		}
+		return length;
+	}
+
+	int size = length < TEMPERHUM_SIM_RESPONSE_LENGTH ? length : TEMPERHUM_SIM_RESPONSE_LENGTH;
+	memset(data, 0x00, size);
+
+	if (sim->pending == 0x48) {
+		int garbage = temperhum_sim.garbage > 0 && temperhum_sim_random() < temperhum_sim.garbage;
+		if (!sim->initialized || at < sim->ready_at || garbage) {
+			memset(data, 0xFF, size);
+		} else if (size >= 4) {
+			int sot = temperhum_sim.sot + (sim->index % 100) * 10;
+			data[0] = sot >> 8;
+			data[1] = sot & 0xFF;
+			data[2] = temperhum_sim.sorh >> 8;
+			data[3] = temperhum_sim.sorh & 0xFF;
+		}
+	}
+	sim->pending = 0x00;
+
+	return size;
+}
+
+/**
+ * Synchronous transfer to a simulated device
+ */
+static int temperhum_sim_control(temperhum_device * device, int direction, unsigned char * data, int length, int timeout)
+{
+	int status;
+	int64_t at = temperhum_sim_now() + temperhum_sim.latency;
+	int size = temperhum_sim_process(device, direction, data, length, at, &status);
+
+	if (status) {
+		temperhum_sim_sleep(timeout * 1000LL);
+		return LIBUSB_ERROR_TIMEOUT;
+	}
+	temperhum_sim_sleep(at - temperhum_sim_now());
+
+	return size;
+}
+
+/**
+ * Adds a pending transfer, its fields are set by the caller
+ */
+static struct temperhum_sim_transfer *temperhum_sim_queue(void * user_data, unsigned char * buffer)
+{
+	if (temperhum_sim_transfer_count == temperhum_sim_transfer_size) {
+		int size = temperhum_sim_transfer_size ? temperhum_sim_transfer_size * 2 : 64;
+		struct temperhum_sim_transfer *transfers = realloc(temperhum_sim_transfers, size * sizeof(struct temperhum_sim_transfer));
+		if (!transfers) {
+			return NULL;
+		}
+		temperhum_sim_transfers = transfers;
+		temperhum_sim_transfer_size = size;
+	}
+
+	struct temperhum_sim_transfer *transfer = &temperhum_sim_transfers[temperhum_sim_transfer_count++];
+	transfer->user_data = user_data;
+	transfer->data = buffer + TEMPERHUM_TRANSPORT_HEADER;
+
+	return transfer;
+}
+
+/**
+ * Queues an asynchronous transfer to a simulated device, it completes
+ * in temperhum_sim_handle_events() after the latency or the timeout
+ */
+static int temperhum_sim_submit(temperhum_device * device, int direction, unsigned char * buffer, int length, int timeout, void * user_data)
+{
+	struct temperhum_sim_transfer *transfer = temperhum_sim_queue(user_data, buffer);
+	if (!transfer) {
+		return -1;
+	}
+
+	int64_t at = temperhum_sim_now() + temperhum_sim.latency;
+	transfer->size = temperhum_sim_process(device, direction, transfer->data, length, at, &transfer->status);
+	transfer->due = transfer->status ? at + timeout * 1000LL : at;
+
+	return 0;
+}
+
+/**
+ * Completes transfers which are due, waits up to timeout us for the first one
+ */
+static int temperhum_sim_handle_events(int64_t timeout)
+{
+	int64_t now = temperhum_sim_now();
+	int64_t until = now + timeout;
+	int i, count = 0;
+
+	for (i = 0; i < temperhum_sim_transfer_count; i++) {
+		if (temperhum_sim_transfers[i].due < until) {
+			until = temperhum_sim_transfers[i].due;
+		}
+	}
+	temperhum_sim_sleep(until - now);
+	now = temperhum_sim_now();
+
+	// completions may submit new transfers, so due ones are taken out first
+	struct temperhum_sim_transfer *done = malloc((temperhum_sim_transfer_count + 1) * sizeof(struct temperhum_sim_transfer));
+	if (!done) {
+		return -1;
+	}
+	int kept = 0;
+	for (i = 0; i < temperhum_sim_transfer_count; i++) {
+		if (temperhum_sim_transfers[i].due <= now) {
+			done[count++] = temperhum_sim_transfers[i];
+		} else {
+			temperhum_sim_transfers[kept++] = temperhum_sim_transfers[i];
+		}
+	}
+	temperhum_sim_transfer_count = kept;
+
+	for (i = 0; i < count; i++) {
+		temperhum_transport_complete(done[i].user_data, done[i].status, done[i].data, done[i].size);
+	}
+	free(done);
+
+	return count;
+}
+
+/**
+ * Resetting a simulated sensor makes it forget its initialization
+ */
+static int temperhum_sim_reset(temperhum_device * device)
+{
+	struct temperhum_sim_device *sim = (struct temperhum_sim_device *) device->handle;
+
+	sim->initialized = 0;
+	sim->pending = 0x00;
+
+	return 0;
+}
+
+/**
+ * Frees a simulated device, it gets attached again by the next scan
+ */
+static void temperhum_sim_close(temperhum_device * device)
+{
+	struct temperhum_sim_device *sim = (struct temperhum_sim_device *) device->handle;
+
+	if (temperhum_sim_devices) {
+		temperhum_sim_devices[sim->index] = NULL;
+	}
+	free(sim);
+	device->handle = NULL;
+}
+
+const struct temperhum_transport temperhum_sim_transport = {
+	"sim",
+	temperhum_sim_init,
+	temperhum_sim_exit,
+	temperhum_sim_scan,
+	temperhum_sim_control,
+	temperhum_sim_submit,
+	temperhum_sim_handle_events,
+	temperhum_sim_reset,
+	temperhum_sim_close
+};
+
+/**
+ * Loads the capture to replay
+ */
+static int temperhum_replay_init(const char * options)
+{
+	char buffer[256], file[256] = "", *item, *state;
+
+	temperhum_replay.speed = 1;
+
+	snprintf(buffer, sizeof(buffer), "%s", options);
+	for (item = strtok_r(buffer, ",", &state); item; item = strtok_r(NULL, ",", &state)) {
+		if (!strncmp(item, "file=", 5)) {
+			snprintf(file, sizeof(file), "%s", item + 5);
+		} else if (sscanf(item, "speed=%lf", &temperhum_replay.speed) != 1 || temperhum_replay.speed < 0) {
+			temperhum_error(0, "Wrong replay option '%s'", item);
+			return -1;
+		}
+	}
+
+	if (!file[0]) {
+		temperhum_error(0, "No capture to replay given in '%s'", options);
+		return -1;
+	}
+	if (temperhum_capture_load(file, &temperhum_replay.capture)) {
+		return -1;
+	}
+
+	temperhum_replay.devices = calloc(temperhum_replay.capture.device_count + 1, sizeof(struct temperhum_replay_device));
+	if (!temperhum_replay.devices) {
+		temperhum_capture_free(&temperhum_replay.capture);
+		return -1;
+	}
+
+	// sensors measure faster in an accelerated replay, so the api waits less
+	temperhum_transport_set_time_scale(temperhum_replay.speed > 0 ? 1 / temperhum_replay.speed : 0);
+	temperhum_debug("Replaying %i transfers of %i devices from %s",
+		temperhum_replay.capture.record_count, temperhum_replay.capture.device_count, file);
+
+	return 0;
+}
+
+/**
+ * Frees the capture, devices are closed by the api before
+ */
+static void temperhum_replay_exit()
+{
+	free(temperhum_replay.devices);
+	temperhum_replay.devices = NULL;
+	temperhum_capture_free(&temperhum_replay.capture);
+	temperhum_sim_free_transfers();
+}
+
+/**
+ * Attaches devices of the capture which are not attached
+ */
+static int temperhum_replay_scan()
+{
+	int i;
+
+	for (i = 0; i < temperhum_replay.capture.device_count; i++) {
+		struct temperhum_capture_device *captured = &temperhum_replay.capture.devices[i];
+		struct temperhum_replay_device *replay = &temperhum_replay.devices[i];
+
+		if (replay->attached) {
+			continue;
+		}
+
+		replay->index = i;
+		if (!temperhum_transport_attach(captured->bus_number, captured->device_number, captured->interface_number, captured->port_path, replay)) {
+			return -1;
+		}
+		replay->attached = 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Takes the next recorded transfer of a device in given direction.
+ * Returns amount of bytes transferred, status is set to the recorded one
+ * or to -1 if the capture has ended, duration to the time it should take.
+ */
+static int temperhum_replay_process(temperhum_device * device, int direction, unsigned char * data, int length, int * status, int64_t * duration)
+{
+	struct temperhum_replay_device *replay = (struct temperhum_replay_device *) device->handle;
+	struct temperhum_capture *capture = &temperhum_replay.capture;
+	uint16_t id = capture->devices[replay->index].id;
+
+	for (; replay->cursor < capture->record_count; replay->cursor++) {
+		struct temperhum_capture_record *record = &capture->records[replay->cursor];
+
+		if (record->device != id || (record->request_type & 0x80 ? TEMPERHUM_TRANSFER_IN : TEMPERHUM_TRANSFER_OUT) != direction) {
+			continue;
+		}
+		replay->cursor++;
+
+		*status = record->status;
+		*duration = temperhum_replay.speed > 0 ? record->duration / temperhum_replay.speed : 0;
+		if (record->status) {
+			return 0;
+		}
+
+		int size = record->length < length ? record->length : length;
+		if (direction == TEMPERHUM_TRANSFER_IN) {
+			memcpy(data, record->data, size);
+		}
+		return size;
+	}
+
+	temperhum_debug("Capture of device %s has ended", device->port_path);
+	*status = -1;
+	*duration = 0;
+
+	return 0;
+}
+
+/**
+ * Synchronous transfer to a replayed device
+ */
+static int temperhum_replay_control(temperhum_device * device, int direction, unsigned char * data, int length, int timeout)
+{
+	int status;
+	int64_t duration;
+	int size = temperhum_replay_process(device, direction, data, length, &status, &duration);
+
+	temperhum_sim_sleep(duration);
+
+	// synchronous transfers were recorded with libusb errors, asynchronous ones with a status
+	if (status == LIBUSB_TRANSFER_TIMED_OUT) {
+		return LIBUSB_ERROR_TIMEOUT;
+	}
+
+	if (status) {
+		return status < 0 ? status : -1;
+	}
+
+	return size;
+}
+
+/**
+ * Queues an asynchronous transfer to a replayed device, it completes
+ * in temperhum_sim_handle_events() after the recorded duration
+ */
+static int temperhum_replay_submit(temperhum_device * device, int direction, unsigned char * buffer, int length, int timeout, void * user_data)
+{
+	struct temperhum_sim_transfer *transfer = temperhum_sim_queue(user_data, buffer);
+	if (!transfer) {
+		return -1;
+	}
+
+	int64_t duration;
+	transfer->size = temperhum_replay_process(device, direction, transfer->data, length, &transfer->status, &duration);
+	transfer->due = temperhum_sim_now() + duration;
+
+	return 0;
+}
+
+/**
+ * Replayed devices answer what was recorded after a reset as well
+ */
+static int temperhum_replay_reset(temperhum_device * device)
+{
+	return 0;
+}
+
+/**
+ * Detaches a replayed device, it gets attached again by the next scan
+ * and continues from where it was
+ */
+static void temperhum_replay_close(temperhum_device * device)
+{
+	struct temperhum_replay_device *replay = (struct temperhum_replay_device *) device->handle;
+
+	replay->attached = 0;
+	device->handle = NULL;
+}
+
+const struct temperhum_transport temperhum_replay_transport = {
+	"replay",
+	temperhum_replay_init,
+	temperhum_replay_exit,
+	temperhum_replay_scan,
+	temperhum_replay_control,
+	temperhum_replay_submit,
+	temperhum_sim_handle_events,
+	temperhum_replay_reset,
+	temperhum_replay_close
+};
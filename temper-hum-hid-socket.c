@@ -0,0 +1,403 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include "temper-hum-hid-api.h"
+#include "temper-hum-hid-socket.h"
+#include "temper-hum-hid-report.h"
+
+#define TEMPERHUM_SOCKET_DEVICES 64
+#define TEMPERHUM_SOCKET_TIMEOUT 5 /** seconds a client waits for an answer */
+#define TEMPERHUM_SOCKET_READ_TIMEOUT 5000 /** ms a client waits for a hardware read */
+
+/**
+ * Latest readings handed out to clients and the state of hardware reads requested by them.
+ * A read is requested by bumping demanded, every client needing fresh values
+ * meanwhile waits for the same read instead of requesting another one.
+ */
+static pthread_mutex_t temperhum_socket_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t temperhum_socket_demand = PTHREAD_COND_INITIALIZER; /** acquisition waits for requests here */
+static pthread_cond_t temperhum_socket_updated = PTHREAD_COND_INITIALIZER; /** clients wait for a read here */
+static struct temperhum_sample temperhum_socket_latest[TEMPERHUM_SOCKET_DEVICES];
+static int temperhum_socket_count = 0;
+static unsigned int temperhum_socket_demand_serial = 0;
+static unsigned int temperhum_socket_served_serial = 0;
+static temperhum_socket_formatter temperhum_socket_format = NULL;
+static char temperhum_socket_path[108];
+static int temperhum_socket_listener = -1;
+
+/**
+ * Current wall clock time in milliseconds
+ */
+static int64_t temperhum_socket_now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+
+	return (int64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/**
+ * Converts wall clock time in ms to a timespec for timed waits
+ */
+static void temperhum_socket_timespec(int64_t time, struct timespec *result)
+{
+	result->tv_sec = time / 1000;
+	result->tv_nsec = (time % 1000) * 1000000;
+}
+
+/**
+ * Keeps a sample as the latest one of its device, called by the acquisition thread
+ */
+void temperhum_socket_publish(const struct temperhum_sample * sample)
+{
+	int i;
+
+	pthread_mutex_lock(&temperhum_socket_lock);
+	for (i = 0; i < temperhum_socket_count; i++) {
+		if (!strcmp(temperhum_socket_latest[i].port_path, sample->port_path) && temperhum_socket_latest[i].interface_number == sample->interface_number) {
+			break;
+		}
+	}
+	if (i < TEMPERHUM_SOCKET_DEVICES) {
+		temperhum_socket_latest[i] = *sample;
+		if (i == temperhum_socket_count) {
+			temperhum_socket_count++;
+		}
+	}
+	pthread_mutex_unlock(&temperhum_socket_lock);
+}
+
+/**
+ * Drops the latest readings of devices no longer in the list, called by the
+ * acquisition thread whenever devices were plugged in or removed. Readings of
+ * a removed device would never be fresh again and make every client wait.
+ */
+void temperhum_socket_attached(temperhum_device * devices)
+{
+	temperhum_device *device;
+	int i, kept = 0;
+
+	pthread_mutex_lock(&temperhum_socket_lock);
+	for (i = 0; i < temperhum_socket_count; i++) {
+		for (device = devices; device; device = device->next) {
+			if (!strcmp(temperhum_socket_latest[i].port_path, device->port_path) && temperhum_socket_latest[i].interface_number == device->interface_number) {
+				break;
+			}
+		}
+		if (device) {
+			temperhum_socket_latest[kept++] = temperhum_socket_latest[i];
+		}
+	}
+	temperhum_socket_count = kept;
+	pthread_mutex_unlock(&temperhum_socket_lock);
+}
+
+/**
+ * Number of the hardware read requested by clients, 0 if there is nothing to do
+ */
+unsigned int temperhum_socket_demanded()
+{
+	unsigned int demand = 0;
+
+	pthread_mutex_lock(&temperhum_socket_lock);
+	if (temperhum_socket_demand_serial != temperhum_socket_served_serial) {
+		demand = temperhum_socket_demand_serial;
+	}
+	pthread_mutex_unlock(&temperhum_socket_lock);
+
+	return demand;
+}
+
+/**
+ * Sleeps until given wall clock time in ms or until a client requests a read,
+ * returns number of the requested read or 0
+ */
+unsigned int temperhum_socket_wait(int64_t deadline)
+{
+	struct timespec wakeup;
+	unsigned int demand = 0;
+
+	temperhum_socket_timespec(deadline, &wakeup);
+
+	pthread_mutex_lock(&temperhum_socket_lock);
+	while (temperhum_socket_demand_serial == temperhum_socket_served_serial) {
+		if (pthread_cond_timedwait(&temperhum_socket_demand, &temperhum_socket_lock, &wakeup) == ETIMEDOUT) {
+			break;
+		}
+	}
+	if (temperhum_socket_demand_serial != temperhum_socket_served_serial) {
+		demand = temperhum_socket_demand_serial;
+	}
+	pthread_mutex_unlock(&temperhum_socket_lock);
+
+	return demand;
+}
+
+/**
+ * Called by the acquisition thread once a requested read is published,
+ * wakes up all clients waiting for it
+ */
+void temperhum_socket_served(unsigned int demand)
+{
+	pthread_mutex_lock(&temperhum_socket_lock);
+	temperhum_socket_served_serial = demand;
+	pthread_cond_broadcast(&temperhum_socket_updated);
+	pthread_mutex_unlock(&temperhum_socket_lock);
+}
+
+/**
+ * Checks if all devices were read within max_age ms, called with the lock held
+ */
+static int temperhum_socket_fresh(int max_age)
+{
+	int64_t now = temperhum_socket_now();
+	int i;
+
+	if (!temperhum_socket_count) {
+		return 0;
+	}
+	for (i = 0; i < temperhum_socket_count; i++) {
+		if (now - temperhum_socket_latest[i].timestamp > max_age) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Answers a client: "<max age in ms> <machine>\n" is expected,
+ * reports of all devices are sent back
+ */
+static void *temperhum_socket_client(void *arg)
+{
+	int client = (int) (intptr_t) arg;
+	char request[64];
+	int max_age = 0, machine = 0;
+	size_t received = 0;
+
+	while (received < sizeof(request) - 1) {
+		ssize_t result = recv(client, request + received, sizeof(request) - 1 - received, 0);
+		if (result < 0 && errno == EINTR) {
+			continue;
+		}
+		if (result <= 0) {
+			break;
+		}
+		received += result;
+		request[received] = 0x00;
+		if (strchr(request, '\n')) {
+			break;
+		}
+	}
+	request[received] = 0x00;
+
+	if (sscanf(request, "%i %i", &max_age, &machine) < 1) {
+		const char *answer = "Error: wrong request\n";
+		send(client, answer, strlen(answer), MSG_NOSIGNAL);
+		close(client);
+		return NULL;
+	}
+
+	pthread_mutex_lock(&temperhum_socket_lock);
+	if (!temperhum_socket_fresh(max_age)) {
+		// join the read in flight or start a new one, a single usb read answers all waiting clients
+		if (temperhum_socket_demand_serial == temperhum_socket_served_serial) {
+			temperhum_socket_demand_serial++;
+			if (!temperhum_socket_demand_serial) {
+				temperhum_socket_demand_serial++;
+			}
+			pthread_cond_signal(&temperhum_socket_demand);
+		}
+		unsigned int demand = temperhum_socket_demand_serial;
+
+		struct timespec wakeup;
+		temperhum_socket_timespec(temperhum_socket_now() + TEMPERHUM_SOCKET_READ_TIMEOUT, &wakeup);
+		while (temperhum_socket_served_serial != demand) {
+			if (pthread_cond_timedwait(&temperhum_socket_updated, &temperhum_socket_lock, &wakeup) == ETIMEDOUT) {
+				break;
+			}
+		}
+	}
+
+	int count = temperhum_socket_count, i;
+	struct temperhum_sample samples[TEMPERHUM_SOCKET_DEVICES];
+	for (i = 0; i < count; i++) {
+		samples[i] = temperhum_socket_latest[i];
+	}
+	pthread_mutex_unlock(&temperhum_socket_lock);
+
+	for (i = 0; i < count; i++) {
+		char report[TEMPERHUM_REPORT_SIZE];
+		size_t length, sent = 0;
+
+		temperhum_socket_format(&samples[i], machine, report);
+		length = strlen(report);
+		while (sent < length) {
+			ssize_t result = send(client, report + sent, length - sent, MSG_NOSIGNAL);
+			if (result < 0 && errno == EINTR) {
+				continue;
+			}
+			if (result <= 0) {
+				break;
+			}
+			sent += result;
+		}
+	}
+
+	close(client);
+	return NULL;
+}
+
+/**
+ * Accepts clients, each one is answered in its own thread
+ * as it may have to wait for a hardware read
+ */
+static void *temperhum_socket_thread(void *arg)
+{
+	struct timeval timeout = {TEMPERHUM_SOCKET_TIMEOUT, 0};
+	pthread_attr_t attributes;
+
+	pthread_attr_init(&attributes);
+	pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+
+	while (1) {
+		pthread_t thread;
+		int client = accept(temperhum_socket_listener, NULL, NULL);
+		if (client < 0) {
+			if (errno != EINTR && errno != ECONNABORTED) {
+				temperhum_error(0, "Cannot accept socket client, error %i", errno);
+				sleep(1);
+			}
+			continue;
+		}
+
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+		if (pthread_create(&thread, &attributes, temperhum_socket_client, (void *) (intptr_t) client) != 0) {
+			temperhum_error(0, "Cannot start thread for socket client");
+			close(client);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Listens for queries on a unix socket
+ */
+int temperhum_socket_start(const char * path, temperhum_socket_formatter formatter)
+{
+	struct sockaddr_un address;
+	pthread_t thread;
+
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		temperhum_error(0, "Socket path '%s' is too long", path);
+		return -1;
+	}
+
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+	strcpy(temperhum_socket_path, path);
+	temperhum_socket_format = formatter;
+
+	temperhum_socket_listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (temperhum_socket_listener < 0) {
+		temperhum_error(0, "Cannot create socket");
+		return -1;
+	}
+
+	// socket left behind by a daemon which was killed
+	unlink(path);
+	if (bind(temperhum_socket_listener, (struct sockaddr *) &address, sizeof(address)) < 0 || listen(temperhum_socket_listener, 16) < 0) {
+		temperhum_error(0, "Cannot listen on socket '%s'", path);
+		close(temperhum_socket_listener);
+		temperhum_socket_listener = -1;
+		return -1;
+	}
+
+	if (pthread_create(&thread, NULL, temperhum_socket_thread, NULL) != 0) {
+		temperhum_error(0, "Cannot start socket thread");
+		temperhum_socket_stop();
+		return -1;
+	}
+	pthread_detach(thread);
+
+	temperhum_debug("Answering queries on socket %s", path);
+
+	return 0;
+}
+
+/**
+ * Removes the socket file
+ */
+void temperhum_socket_stop()
+{
+	if (temperhum_socket_listener >= 0) {
+		close(temperhum_socket_listener);
+		unlink(temperhum_socket_path);
+		temperhum_socket_listener = -1;
+	}
+}
+
+/**
+ * Asks a running daemon for readings and prints them, returns -1 if
+ * there is no daemon listening on the socket
+ */
+int temperhum_socket_query(const char * path, int max_age, int machine)
+{
+	struct sockaddr_un address;
+	struct timeval timeout = {TEMPERHUM_SOCKET_TIMEOUT + TEMPERHUM_SOCKET_READ_TIMEOUT / 1000, 0};
+	char buffer[4096];
+
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		return -1;
+	}
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+
+	int server = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (server < 0) {
+		return -1;
+	}
+	setsockopt(server, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	if (connect(server, (struct sockaddr *) &address, sizeof(address)) < 0) {
+		close(server);
+		return -1;
+	}
+
+	int length = snprintf(buffer, sizeof(buffer), "%i %i\n", max_age, machine);
+	if (send(server, buffer, length, MSG_NOSIGNAL) != length) {
+		close(server);
+		return -1;
+	}
+
+	while (1) {
+		ssize_t result = recv(server, buffer, sizeof(buffer), 0);
+		if (result < 0 && errno == EINTR) {
+			continue;
+		}
+		if (result <= 0) {
+			break;
+		}
+		fwrite(buffer, 1, result, stdout);
+	}
+	close(server);
+
+	return 0;
+}
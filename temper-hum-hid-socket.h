@@ -0,0 +1,34 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_SOCKET
+#define TEMPER_HUM_HID_SOCKET
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "temper-hum-hid-ring.h"
+
+/**
+ * Formats a sample for a client, machine is set if the client asked for --machine output
+ */
+typedef void (*temperhum_socket_formatter)(struct temperhum_sample * sample, int machine, char * report);
+
+int temperhum_socket_start(const char * path, temperhum_socket_formatter formatter);
+void temperhum_socket_publish(const struct temperhum_sample * sample);
+void temperhum_socket_attached(temperhum_device * devices);
+unsigned int temperhum_socket_demanded();
+unsigned int temperhum_socket_wait(int64_t deadline);
+void temperhum_socket_served(unsigned int demand);
+void temperhum_socket_stop();
+int temperhum_socket_query(const char * path, int max_age, int machine);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_SOCKET */
@@ -0,0 +1,141 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Windows are rings of buckets: adding a value updates one bucket, old buckets
+ * are cleared as time moves on, so nothing is ever recomputed from history.
+ * A summary merges the buckets of a window, min and max are exact for the
+ * buckets in the window, which may reach 1/60 of the window further back.
+ */
+
+#include <string.h>
+#include <math.h>
+#include "temper-hum-hid-stats.h"
+
+static const int64_t temperhum_stats_bucket_length[TEMPERHUM_STATS_WINDOWS] = {1000, 15000, 60000}; /** ms */
+static const char *temperhum_stats_window_names[TEMPERHUM_STATS_WINDOWS] = {"1m", "15m", "1h"};
+
+/**
+ * Adds a value to an accumulator
+ */
+static inline void temperhum_accumulate(struct temperhum_accumulator * accumulator, double value)
+{
+	double delta = value - accumulator->mean;
+
+	if (!accumulator->count || value < accumulator->min) {
+		accumulator->min = value;
+	}
+	if (!accumulator->count || value > accumulator->max) {
+		accumulator->max = value;
+	}
+	accumulator->count++;
+	accumulator->mean += delta / accumulator->count;
+	accumulator->m2 += delta * (value - accumulator->mean);
+}
+
+/**
+ * Merges an accumulator into another one (Chan et al.)
+ */
+static inline void temperhum_accumulator_merge(struct temperhum_accumulator * total, const struct temperhum_accumulator * part)
+{
+	if (!part->count) {
+		return;
+	}
+	if (!total->count) {
+		*total = *part;
+		return;
+	}
+
+	uint32_t count = total->count + part->count;
+	double delta = part->mean - total->mean;
+
+	total->mean += delta * part->count / count;
+	total->m2 += part->m2 + delta * delta * ((double) total->count * part->count / count);
+	total->count = count;
+	if (part->min < total->min) {
+		total->min = part->min;
+	}
+	if (part->max > total->max) {
+		total->max = part->max;
+	}
+}
+
+/**
+ * Adds temperature, humidity and dew point read at given wall clock time
+ * in ms, values which are not finite are left out
+ */
+void temperhum_stats_add(struct temperhum_stats * stats, int64_t timestamp, const double * values)
+{
+	int w, v;
+
+	for (w = 0; w < TEMPERHUM_STATS_WINDOWS; w++) {
+		struct temperhum_window *window = &stats->window[w];
+		int64_t index = timestamp / temperhum_stats_bucket_length[w];
+
+		if (index > window->head) {
+			// buckets between the newest one and now have fallen out of the window
+			int64_t expired = index - window->head, i;
+			if (expired > TEMPERHUM_STATS_BUCKETS) {
+				expired = TEMPERHUM_STATS_BUCKETS;
+			}
+			for (i = 1; i <= expired; i++) {
+				memset(window->bucket[(window->head + i) % TEMPERHUM_STATS_BUCKETS], 0, sizeof(window->bucket[0]));
+			}
+			window->head = index;
+		} else if (window->head - index >= TEMPERHUM_STATS_BUCKETS) {
+			// wall clock went back further than the window
+			memset(window->bucket, 0, sizeof(window->bucket));
+			window->head = index;
+		}
+
+		struct temperhum_accumulator *bucket = window->bucket[index % TEMPERHUM_STATS_BUCKETS];
+		for (v = 0; v < TEMPERHUM_STATS_VALUES; v++) {
+			if (isfinite(values[v])) {
+				temperhum_accumulate(&bucket[v], values[v]);
+			}
+		}
+	}
+}
+
+/**
+ * Statistics of all windows ending at given wall clock time in ms
+ */
+void temperhum_stats_summarize(const struct temperhum_stats * stats, int64_t timestamp, struct temperhum_summary summary[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES])
+{
+	int w, v, i;
+
+	for (w = 0; w < TEMPERHUM_STATS_WINDOWS; w++) {
+		const struct temperhum_window *window = &stats->window[w];
+		int64_t index = timestamp / temperhum_stats_bucket_length[w];
+		struct temperhum_accumulator total[TEMPERHUM_STATS_VALUES];
+
+		memset(total, 0, sizeof(total));
+		for (i = 0; i < TEMPERHUM_STATS_BUCKETS; i++) {
+			int64_t bucket = index - i;
+			if (bucket > window->head || bucket <= window->head - TEMPERHUM_STATS_BUCKETS) {
+				continue;
+			}
+			for (v = 0; v < TEMPERHUM_STATS_VALUES; v++) {
+				temperhum_accumulator_merge(&total[v], &window->bucket[bucket % TEMPERHUM_STATS_BUCKETS][v]);
+			}
+		}
+
+		for (v = 0; v < TEMPERHUM_STATS_VALUES; v++) {
+			struct temperhum_summary *s = &summary[w][v];
+			s->count = total[v].count;
+			s->min = total[v].count ? total[v].min : NAN;
+			s->max = total[v].count ? total[v].max : NAN;
+			s->mean = total[v].count ? total[v].mean : NAN;
+			s->stddev = total[v].count > 1 ? sqrt(total[v].m2 / (total[v].count - 1)) : 0;
+		}
+	}
+}
+
+/**
+ * Short name of a window like 15m
+ */
+const char *temperhum_stats_window_name(int window)
+{
+	return temperhum_stats_window_names[window];
+}
@@ -0,0 +1,65 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Rolling statistics of the last minute, 15 minutes and hour of a device
+ */
+
+#ifndef TEMPER_HUM_HID_STATS
+#define TEMPER_HUM_HID_STATS
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#define TEMPERHUM_STATS_WINDOWS 3 /** 1 minute, 15 minutes, 1 hour */
+#define TEMPERHUM_STATS_BUCKETS 60 /** a window is a ring of this many buckets */
+#define TEMPERHUM_STATS_VALUES 3 /** temperature, humidity, dew point */
+
+/**
+ * Running count, mean and sum of squared differences from the mean (Welford)
+ * of the values in a bucket
+ */
+struct temperhum_accumulator {
+	uint32_t count;
+	double mean;
+	double m2;
+	double min;
+	double max;
+};
+
+/**
+ * Ring of buckets, each one holds the values of 1/60 of the window
+ */
+struct temperhum_window {
+	int64_t head; /** number of the newest bucket, wall clock time divided by the bucket length */
+	struct temperhum_accumulator bucket[TEMPERHUM_STATS_BUCKETS][TEMPERHUM_STATS_VALUES];
+};
+
+struct temperhum_stats {
+	struct temperhum_window window[TEMPERHUM_STATS_WINDOWS];
+};
+
+/**
+ * Statistics of one value over a window, min, max and mean are nan if
+ * the window has no values
+ */
+struct temperhum_summary {
+	uint32_t count;
+	double min;
+	double max;
+	double mean;
+	double stddev;
+};
+
+void temperhum_stats_add(struct temperhum_stats * stats, int64_t timestamp, const double * values);
+void temperhum_stats_summarize(const struct temperhum_stats * stats, int64_t timestamp, struct temperhum_summary summary[TEMPERHUM_STATS_WINDOWS][TEMPERHUM_STATS_VALUES]);
+const char *temperhum_stats_window_name(int window);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_STATS */
@@ -0,0 +1,749 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Columns are compressed as in Facebook's Gorilla: timestamps are stored as
+ * the change of the interval between samples, which is mostly 0 for a device
+ * read on a grid, values as XOR against the previous one, which is 0 while
+ * the reading does not change and has few meaningful bits when it changes
+ * a little. A chunk is written and synced with one call when it is sealed.
+ *
+ * The index next to the store has an entry per chunk with its time span and
+ * the aggregates of its values, and points to the aggregates of every minute
+ * of the chunk in the minutes file, a range query decodes only the chunks
+ * neither can answer. The index is not synced, it is checked against
+ * the chunks whenever the store is opened and rebuilt where they differ.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include "temper-hum-hid-store.h"
+
+/**
+ * Reads 8 bytes as a big endian word
+ */
+static inline uint64_t temperhum_store_load(const uint8_t * data)
+{
+	uint64_t word;
+	memcpy(&word, data, sizeof(word));
+
+	return __builtin_bswap64(word);
+}
+
+/**
+ * Appends up to 64 bits to a zeroed buffer
+ */
+static inline void temperhum_store_put(uint8_t * data, size_t * position, uint64_t value, int count)
+{
+	if (count > 56) {
+		temperhum_store_put(data, position, value >> 32, count - 32);
+		temperhum_store_put(data, position, value & 0xFFFFFFFF, 32);
+		return;
+	}
+	if (!count) {
+		return;
+	}
+
+	uint8_t *byte = data + (*position >> 3);
+	uint64_t word = temperhum_store_load(byte);
+	word |= (value & ((UINT64_C(1) << count) - 1)) << (64 - (*position & 7) - count);
+	word = __builtin_bswap64(word);
+	memcpy(byte, &word, sizeof(word));
+	*position += count;
+}
+
+/**
+ * Reads up to 64 bits
+ */
+static inline uint64_t temperhum_store_get(const uint8_t * data, size_t * position, int count)
+{
+	if (count > 56) {
+		uint64_t high = temperhum_store_get(data, position, count - 32);
+		return high << 32 | temperhum_store_get(data, position, 32);
+	}
+	if (!count) {
+		return 0;
+	}
+
+	uint64_t word = temperhum_store_load(data + (*position >> 3));
+	uint64_t value = (word << (*position & 7)) >> (64 - count);
+	*position += count;
+
+	return value;
+}
+
+/**
+ * Moves a bit position to the next byte
+ */
+static inline size_t temperhum_store_align(size_t position)
+{
+	return (position + 7) & ~(size_t) 7;
+}
+
+/**
+ * Bits needed for a value
+ */
+static inline int temperhum_store_width(unsigned int value)
+{
+	return value ? 32 - __builtin_clz(value) : 0;
+}
+
+/**
+ * Maps a difference to an unsigned value, small ones of both signs stay small
+ */
+static inline unsigned int temperhum_store_zigzag(int difference)
+{
+	return ((unsigned int) difference << 1) ^ (difference >> 31);
+}
+
+/**
+ * Reverses temperhum_store_zigzag()
+ */
+static inline int temperhum_store_unzigzag(unsigned int value)
+{
+	return (int) (value >> 1) ^ -(int) (value & 1);
+}
+
+/**
+ * Appends timestamps after the first one as changes of their interval:
+ * 0 is 1 bit, small changes take 9, 12 or 16 bits, others 68 bits
+ */
+static void temperhum_store_put_timestamps(uint8_t * data, size_t * position, const struct temperhum_store_sample * samples, int count)
+{
+	int64_t previous = samples[0].timestamp, interval = 0;
+	int i;
+
+	for (i = 1; i < count; i++) {
+		int64_t delta = samples[i].timestamp - previous;
+		int64_t change = delta - interval;
+
+		if (!change) {
+			temperhum_store_put(data, position, 0, 1);
+		} else if (change >= -63 && change <= 64) {
+			temperhum_store_put(data, position, 2, 2);
+			temperhum_store_put(data, position, change, 7);
+		} else if (change >= -255 && change <= 256) {
+			temperhum_store_put(data, position, 6, 3);
+			temperhum_store_put(data, position, change, 9);
+		} else if (change >= -2047 && change <= 2048) {
+			temperhum_store_put(data, position, 14, 4);
+			temperhum_store_put(data, position, change, 12);
+		} else {
+			temperhum_store_put(data, position, 15, 4);
+			temperhum_store_put(data, position, change, 64);
+		}
+		previous = samples[i].timestamp;
+		interval = delta;
+	}
+}
+
+/**
+ * Sign extends the lowest bits of a value
+ */
+static inline int64_t temperhum_store_signed(uint64_t value, int bits)
+{
+	// the ranges above are -2^(n-1)+1 .. 2^(n-1), the top value wraps to the bottom
+	int64_t result = (int64_t) (value << (64 - bits)) >> (64 - bits);
+
+	return result == -((int64_t) 1 << (bits - 1)) ? -result : result;
+}
+
+/**
+ * Reads timestamps written by temperhum_store_put_timestamps(), they are
+ * stored stride bytes apart
+ */
+static void temperhum_store_get_timestamps(const uint8_t * data, const struct temperhum_store_chunk * chunk, char * timestamps, size_t stride)
+{
+	size_t position = 0;
+	int64_t previous = chunk->first, interval = 0;
+	uint32_t i;
+
+	memcpy(timestamps, &previous, sizeof(previous));
+	for (i = 1; i < chunk->count; i++) {
+		int64_t change;
+
+		if (!temperhum_store_get(data, &position, 1)) {
+			change = 0;
+		} else if (!temperhum_store_get(data, &position, 1)) {
+			change = temperhum_store_signed(temperhum_store_get(data, &position, 7), 7);
+		} else if (!temperhum_store_get(data, &position, 1)) {
+			change = temperhum_store_signed(temperhum_store_get(data, &position, 9), 9);
+		} else if (!temperhum_store_get(data, &position, 1)) {
+			change = temperhum_store_signed(temperhum_store_get(data, &position, 12), 12);
+		} else {
+			change = temperhum_store_get(data, &position, 64);
+		}
+		interval += change;
+		previous += interval;
+		memcpy(timestamps + i * stride, &previous, sizeof(previous));
+	}
+}
+
+/**
+ * Appends a column of values XORed with the previous one: 0 is 1 bit, bits
+ * within the meaningful bits of the previous XOR take 2 bits more, otherwise
+ * 5 bits of leading zeros and 6 bits of length describe the meaningful bits
+ */
+static void temperhum_store_put_values(uint8_t * data, size_t * position, const struct temperhum_store_sample * samples, int count, size_t offset)
+{
+	uint64_t previous, value;
+	int leading = 64, trailing = 0, i;
+
+	memcpy(&previous, (const char *) &samples[0] + offset, sizeof(previous));
+	temperhum_store_put(data, position, previous, 64);
+
+	for (i = 1; i < count; i++) {
+		memcpy(&value, (const char *) &samples[i] + offset, sizeof(value));
+		uint64_t difference = value ^ previous;
+		previous = value;
+
+		if (!difference) {
+			temperhum_store_put(data, position, 0, 1);
+			continue;
+		}
+
+		int zeros = __builtin_clzll(difference), tail = __builtin_ctzll(difference);
+		if (zeros > 31) {
+			zeros = 31;
+		}
+		if (zeros >= leading && tail >= trailing) {
+			temperhum_store_put(data, position, 2, 2);
+			temperhum_store_put(data, position, difference >> trailing, 64 - leading - trailing);
+			continue;
+		}
+
+		leading = zeros;
+		trailing = tail;
+		temperhum_store_put(data, position, 3, 2);
+		temperhum_store_put(data, position, leading, 5);
+		temperhum_store_put(data, position, 64 - leading - trailing - 1, 6);
+		temperhum_store_put(data, position, difference >> trailing, 64 - leading - trailing);
+	}
+}
+
+/**
+ * Reads a column written by temperhum_store_put_values(), values are stored
+ * stride bytes apart
+ */
+static void temperhum_store_get_values(const uint8_t * data, uint32_t count, char * values, size_t stride)
+{
+	size_t position = 0;
+	uint64_t value = temperhum_store_get(data, &position, 64);
+	int leading = 0, length = 0;
+	uint32_t i;
+
+	memcpy(values, &value, sizeof(value));
+	for (i = 1; i < count; i++) {
+		if (temperhum_store_get(data, &position, 1)) {
+			if (temperhum_store_get(data, &position, 1) || !length) {
+				leading = temperhum_store_get(data, &position, 5);
+				length = temperhum_store_get(data, &position, 6) + 1;
+			}
+			value ^= temperhum_store_get(data, &position, length) << (64 - leading - length);
+		}
+		memcpy(values + i * stride, &value, sizeof(value));
+	}
+}
+
+/**
+ * Largest payload of a chunk of given amount of samples
+ */
+size_t temperhum_store_bound(int count)
+{
+	// 68 bits of timestamp, 2 * 77 bits of values and 2 * 17 bits of raw words at most
+	return (size_t) count * 32 + 4 * 8 + 4 + TEMPERHUM_STORE_PADDING;
+}
+
+/**
+ * Compresses samples into a chunk, payload has to be temperhum_store_bound()
+ * bytes. Returns size of the payload.
+ */
+size_t temperhum_store_encode(const struct temperhum_store_sample * samples, int count, struct temperhum_store_chunk * chunk, uint8_t * payload)
+{
+	unsigned int raw_temperature = 0, raw_humidity = 0;
+	size_t position = 0;
+	int i;
+
+	memset(chunk, 0, sizeof(struct temperhum_store_chunk));
+	memcpy(chunk->magic, TEMPERHUM_STORE_CHUNK_MAGIC, 4);
+	chunk->count = count;
+	chunk->first = samples[0].timestamp;
+	chunk->last = samples[count - 1].timestamp;
+	memset(payload, 0, temperhum_store_bound(count));
+
+	temperhum_store_put_timestamps(payload, &position, samples, count);
+	chunk->column[0] = temperhum_store_align(position) >> 3;
+	position = temperhum_store_align(position);
+	temperhum_store_put_values(payload, &position, samples, count, offsetof(struct temperhum_store_sample, temperature));
+	chunk->column[1] = temperhum_store_align(position) >> 3;
+	position = temperhum_store_align(position);
+	temperhum_store_put_values(payload, &position, samples, count, offsetof(struct temperhum_store_sample, humidity));
+	chunk->column[2] = temperhum_store_align(position) >> 3;
+	position = temperhum_store_align(position);
+
+	// raw words change by a step or two, their differences take the width of the largest one in the chunk
+	for (i = 1; i < count; i++) {
+		raw_temperature |= temperhum_store_zigzag(samples[i].raw_temperature - samples[i - 1].raw_temperature);
+		raw_humidity |= temperhum_store_zigzag(samples[i].raw_humidity - samples[i - 1].raw_humidity);
+	}
+	chunk->raw_temperature_bits = temperhum_store_width(raw_temperature);
+	chunk->raw_humidity_bits = temperhum_store_width(raw_humidity);
+	temperhum_store_put(payload, &position, samples[0].raw_temperature, 16);
+	temperhum_store_put(payload, &position, samples[0].raw_humidity, 16);
+	for (i = 1; i < count; i++) {
+		temperhum_store_put(payload, &position, temperhum_store_zigzag(samples[i].raw_temperature - samples[i - 1].raw_temperature), chunk->raw_temperature_bits);
+		temperhum_store_put(payload, &position, temperhum_store_zigzag(samples[i].raw_humidity - samples[i - 1].raw_humidity), chunk->raw_humidity_bits);
+	}
+
+	chunk->size = temperhum_store_align(temperhum_store_align(position) + TEMPERHUM_STORE_PADDING * 8) >> 3;
+
+	return chunk->size;
+}
+
+/**
+ * Checks that the header of a chunk describes a payload that can be decoded
+ */
+static int temperhum_store_valid(const struct temperhum_store_chunk * chunk)
+{
+	if (memcmp(chunk->magic, TEMPERHUM_STORE_CHUNK_MAGIC, 4) || !chunk->count || chunk->raw_temperature_bits > 17 || chunk->raw_humidity_bits > 17) {
+		return 0;
+	}
+
+	return chunk->column[0] <= chunk->column[1] && chunk->column[1] <= chunk->column[2] && (uint64_t) chunk->column[2] + TEMPERHUM_STORE_PADDING <= chunk->size;
+}
+
+/**
+ * Decompresses a chunk into its count samples, returns -1 if the chunk is damaged
+ */
+int temperhum_store_decode(const struct temperhum_store_chunk * chunk, const uint8_t * payload, struct temperhum_store_sample * samples)
+{
+	uint32_t i;
+
+	if (!temperhum_store_valid(chunk)) {
+		return -1;
+	}
+
+	temperhum_store_get_timestamps(payload, chunk, (char *) &samples[0].timestamp, sizeof(struct temperhum_store_sample));
+	temperhum_store_get_values(payload + chunk->column[0], chunk->count, (char *) &samples[0].temperature, sizeof(struct temperhum_store_sample));
+	temperhum_store_get_values(payload + chunk->column[1], chunk->count, (char *) &samples[0].humidity, sizeof(struct temperhum_store_sample));
+
+	size_t position = 0;
+	const uint8_t *raw = payload + chunk->column[2];
+	samples[0].raw_temperature = temperhum_store_get(raw, &position, 16);
+	samples[0].raw_humidity = temperhum_store_get(raw, &position, 16);
+	for (i = 1; i < chunk->count; i++) {
+		samples[i].raw_temperature = samples[i - 1].raw_temperature + temperhum_store_unzigzag(temperhum_store_get(raw, &position, chunk->raw_temperature_bits));
+		samples[i].raw_humidity = samples[i - 1].raw_humidity + temperhum_store_unzigzag(temperhum_store_get(raw, &position, chunk->raw_humidity_bits));
+	}
+
+	return 0;
+}
+
+/**
+ * Decompresses timestamps, temperatures and humidities of a chunk into arrays
+ * of its count values each, raw words are skipped. Returns -1 if the chunk is
+ * damaged.
+ */
+int temperhum_store_decode_columns(const struct temperhum_store_chunk * chunk, const uint8_t * payload, int64_t * timestamps, double * temperature, double * humidity)
+{
+	if (!temperhum_store_valid(chunk)) {
+		return -1;
+	}
+
+	temperhum_store_get_timestamps(payload, chunk, (char *) timestamps, sizeof(int64_t));
+	temperhum_store_get_values(payload + chunk->column[0], chunk->count, (char *) temperature, sizeof(double));
+	temperhum_store_get_values(payload + chunk->column[1], chunk->count, (char *) humidity, sizeof(double));
+
+	return 0;
+}
+
+/**
+ * Start of the minute of a wall clock time in ms, also before 1970
+ */
+static inline int64_t temperhum_store_minute_start(int64_t timestamp)
+{
+	int64_t rest = timestamp % TEMPERHUM_STORE_MINUTE;
+
+	return timestamp - (rest < 0 ? rest + TEMPERHUM_STORE_MINUTE : rest);
+}
+
+/**
+ * Fills the index entry of a chunk written at offset of the store and the
+ * aggregates per minute of its samples, minutes holds count of them at least.
+ * The entry gets the amount of minutes, the offset of the first is left to
+ * the caller.
+ */
+static void temperhum_store_summarize(const struct temperhum_store_sample * samples, int count, int64_t offset, struct temperhum_store_index * entry, struct temperhum_store_minute * minutes)
+{
+	struct temperhum_store_minute *minute = NULL;
+	int i;
+
+	memset(entry, 0, sizeof(struct temperhum_store_index));
+	entry->offset = offset;
+	entry->first = entry->last = samples[0].timestamp;
+	entry->count = count;
+	entry->min[0] = entry->max[0] = samples[0].temperature;
+	entry->min[1] = entry->max[1] = samples[0].humidity;
+
+	for (i = 0; i < count; i++) {
+		const double values[2] = {samples[i].temperature, samples[i].humidity};
+		int64_t start = temperhum_store_minute_start(samples[i].timestamp);
+		int v;
+
+		// clocks may be set back, the span covers every sample of the chunk
+		if (samples[i].timestamp < entry->first) {
+			entry->first = samples[i].timestamp;
+		}
+		if (samples[i].timestamp > entry->last) {
+			entry->last = samples[i].timestamp;
+		}
+		// a sample of an earlier minute after a clock was set back starts another one
+		if (!minute || minute->start != start) {
+			minute = &minutes[entry->minutes++];
+			memset(minute, 0, sizeof(struct temperhum_store_minute));
+			minute->start = start;
+			minute->min[0] = minute->max[0] = values[0];
+			minute->min[1] = minute->max[1] = values[1];
+		}
+		minute->count++;
+		for (v = 0; v < 2; v++) {
+			entry->sum[v] += values[v];
+			minute->sum[v] += values[v];
+			if (values[v] < entry->min[v]) {
+				entry->min[v] = values[v];
+			}
+			if (values[v] > entry->max[v]) {
+				entry->max[v] = values[v];
+			}
+			if (values[v] < minute->min[v]) {
+				minute->min[v] = values[v];
+			}
+			if (values[v] > minute->max[v]) {
+				minute->max[v] = values[v];
+			}
+		}
+	}
+}
+
+/**
+ * Finds the end of the last complete chunk, a chunk cut by a crash is dropped
+ */
+static off_t temperhum_store_end(int fd, off_t size)
+{
+	struct temperhum_store_chunk chunk;
+	off_t position = sizeof(struct temperhum_store_header);
+
+	while (position + (off_t) sizeof(chunk) <= size) {
+		if (pread(fd, &chunk, sizeof(chunk), position) != sizeof(chunk) || memcmp(chunk.magic, TEMPERHUM_STORE_CHUNK_MAGIC, 4)) {
+			break;
+		}
+		if (position + (off_t) sizeof(chunk) + chunk.size > size) {
+			break;
+		}
+		position += sizeof(chunk) + chunk.size;
+	}
+
+	return position;
+}
+
+/**
+ * Opens a file next to the store for reading and writing, returns the descriptor or -1
+ */
+static int temperhum_store_open_next(const char * path, const char * suffix)
+{
+	char next_path[4096];
+
+	if (snprintf(next_path, sizeof(next_path), "%s%s", path, suffix) >= (int) sizeof(next_path)) {
+		return -1;
+	}
+
+	return open(next_path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+}
+
+/**
+ * Opens the index and the minutes file of a store whose chunks end at end,
+ * entries of chunks no longer in the store are dropped and missing ones are
+ * added. Returns the descriptor of the index and sets the one of the minutes
+ * file, or returns -1.
+ */
+static int temperhum_store_index_open(int fd, const char * path, off_t end, int * minutes_fd)
+{
+	struct temperhum_store_index_header header;
+	struct temperhum_store_index entry;
+	struct temperhum_store_chunk chunk;
+	struct stat status, minutes_status;
+
+	int index = temperhum_store_open_next(path, TEMPERHUM_STORE_INDEX_SUFFIX);
+	if (index < 0) {
+		return -1;
+	}
+	int minutes = temperhum_store_open_next(path, TEMPERHUM_STORE_MINUTES_SUFFIX);
+	if (minutes < 0 || fstat(minutes, &minutes_status) < 0) {
+		if (minutes >= 0) {
+			close(minutes);
+		}
+		close(index);
+		return -1;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TEMPERHUM_STORE_INDEX_MAGIC, 4);
+	header.version = TEMPERHUM_STORE_INDEX_VERSION;
+
+	struct temperhum_store_index_header existing;
+	if (fstat(index, &status) < 0 || status.st_size < (off_t) sizeof(existing) || pread(index, &existing, sizeof(existing), 0) != sizeof(existing) || memcmp(&existing, &header, sizeof(header))) {
+		// missing, not an index or of an older version, it is built from the chunks
+		if (ftruncate(index, 0) < 0 || pwrite(index, &header, sizeof(header), 0) != sizeof(header)) {
+			close(minutes);
+			close(index);
+			return -1;
+		}
+		status.st_size = sizeof(header);
+	}
+
+	off_t position = sizeof(struct temperhum_store_header), slot = sizeof(header), minute = 0;
+	struct temperhum_store_sample *samples = NULL;
+	struct temperhum_store_minute *aggregates = NULL;
+	uint8_t *payload = NULL;
+	int result = 0;
+
+	// entries matching the chunks and the minutes file are kept, the rest is rebuilt
+	while (position < end && slot + (off_t) sizeof(entry) <= status.st_size) {
+		if (pread(index, &entry, sizeof(entry), slot) != sizeof(entry) || entry.offset != position
+				|| entry.minute != minute || minute + (off_t) (entry.minutes * sizeof(struct temperhum_store_minute)) > minutes_status.st_size
+				|| pread(fd, &chunk, sizeof(chunk), position) != sizeof(chunk) || entry.count != chunk.count) {
+			break;
+		}
+		position += sizeof(chunk) + chunk.size;
+		slot += sizeof(entry);
+		minute += entry.minutes * sizeof(struct temperhum_store_minute);
+	}
+	if ((slot != status.st_size && ftruncate(index, slot) < 0) || (minute != minutes_status.st_size && ftruncate(minutes, minute) < 0)) {
+		close(minutes);
+		close(index);
+		return -1;
+	}
+
+	while (position < end && result == 0) {
+		result = -1;
+		// every sample takes a bit of the payload at least
+		if (pread(fd, &chunk, sizeof(chunk), position) != sizeof(chunk) || !temperhum_store_valid(&chunk) || chunk.count > (uint64_t) chunk.size * 8) {
+			break;
+		}
+		samples = realloc(samples, chunk.count * sizeof(struct temperhum_store_sample));
+		aggregates = realloc(aggregates, chunk.count * sizeof(struct temperhum_store_minute));
+		payload = realloc(payload, chunk.size);
+		if (!samples || !aggregates || !payload || pread(fd, payload, chunk.size, position + sizeof(chunk)) != (ssize_t) chunk.size
+				|| temperhum_store_decode(&chunk, payload, samples) < 0) {
+			break;
+		}
+		temperhum_store_summarize(samples, chunk.count, position, &entry, aggregates);
+		entry.minute = minute;
+		size_t size = entry.minutes * sizeof(struct temperhum_store_minute);
+		if (pwrite(minutes, aggregates, size, minute) != (ssize_t) size || pwrite(index, &entry, sizeof(entry), slot) != sizeof(entry)) {
+			break;
+		}
+		position += sizeof(chunk) + chunk.size;
+		slot += sizeof(entry);
+		minute += size;
+		result = 0;
+	}
+	free(samples);
+	free(aggregates);
+	free(payload);
+
+	if (result < 0) {
+		close(minutes);
+		close(index);
+		return -1;
+	}
+	lseek(index, slot, SEEK_SET);
+	lseek(minutes, minute, SEEK_SET);
+	*minutes_fd = minutes;
+
+	return index;
+}
+
+/**
+ * Opens the store of a device for appending, creating it if it does not
+ * exist. Returns NULL if it cannot be opened or is not a store.
+ */
+struct temperhum_store *temperhum_store_open(const char * path, const char * port_path, uint8_t interface_number, int chunk_samples)
+{
+	struct temperhum_store_header header;
+	struct stat status;
+
+	if (chunk_samples < 2) {
+		return NULL;
+	}
+
+	int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		return NULL;
+	}
+	if (fstat(fd, &status) < 0) {
+		close(fd);
+		return NULL;
+	}
+
+	if (!status.st_size) {
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, TEMPERHUM_STORE_MAGIC, 4);
+		header.version = TEMPERHUM_STORE_VERSION;
+		header.interface_number = interface_number;
+		strncpy(header.port_path, port_path, TEMPERHUM_PORT_PATH_LENGTH - 1);
+		if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+			close(fd);
+			return NULL;
+		}
+	} else {
+		if (pread(fd, &header, sizeof(header), 0) != sizeof(header) || memcmp(header.magic, TEMPERHUM_STORE_MAGIC, 4) || header.version != TEMPERHUM_STORE_VERSION) {
+			close(fd);
+			return NULL;
+		}
+		off_t end = temperhum_store_end(fd, status.st_size);
+		if (end != status.st_size && ftruncate(fd, end) < 0) {
+			close(fd);
+			return NULL;
+		}
+	}
+	off_t end = lseek(fd, 0, SEEK_END);
+
+	int minutes;
+	int index = temperhum_store_index_open(fd, path, end, &minutes);
+	if (index < 0) {
+		close(fd);
+		return NULL;
+	}
+
+	struct temperhum_store *store = calloc(1, sizeof(struct temperhum_store));
+	if (!store) {
+		close(fd);
+		close(index);
+		close(minutes);
+		return NULL;
+	}
+	store->fd = fd;
+	store->index_fd = index;
+	store->minutes_fd = minutes;
+	store->chunk_samples = chunk_samples;
+	store->pending = malloc(chunk_samples * sizeof(struct temperhum_store_sample));
+	store->minutes = malloc(chunk_samples * sizeof(struct temperhum_store_minute));
+	store->buffer = malloc(sizeof(struct temperhum_store_chunk) + temperhum_store_bound(chunk_samples));
+	if (!store->pending || !store->minutes || !store->buffer) {
+		temperhum_store_close(store);
+		return NULL;
+	}
+
+	return store;
+}
+
+/**
+ * Adds a sample, the chunk is sealed once it has chunk_samples samples.
+ * Returns -1 if sealing failed, the samples are kept for the next try.
+ */
+int temperhum_store_append(struct temperhum_store * store, const struct temperhum_store_sample * sample)
+{
+	if (store->count == store->chunk_samples && temperhum_store_seal(store) < 0) {
+		return -1;
+	}
+	store->pending[store->count++] = *sample;
+
+	if (store->count == store->chunk_samples) {
+		return temperhum_store_seal(store);
+	}
+
+	return 0;
+}
+
+/**
+ * Seals samples waiting in memory if the oldest of them was taken max_age ms
+ * or longer before now, bounding the samples lost with a crash. Returns -1 if
+ * sealing failed.
+ */
+int temperhum_store_expire(struct temperhum_store * store, int64_t now, int64_t max_age)
+{
+	if (!store->count || now - store->pending[0].timestamp < max_age) {
+		return 0;
+	}
+
+	return temperhum_store_seal(store);
+}
+
+/**
+ * Writes samples waiting in memory as a chunk and syncs it to disk
+ */
+int temperhum_store_seal(struct temperhum_store * store)
+{
+	if (!store->count) {
+		return 0;
+	}
+
+	struct temperhum_store_chunk *chunk = (struct temperhum_store_chunk *) store->buffer;
+	size_t size = sizeof(struct temperhum_store_chunk) + temperhum_store_encode(store->pending, store->count, chunk, store->buffer + sizeof(struct temperhum_store_chunk));
+	off_t end = lseek(store->fd, 0, SEEK_CUR);
+
+	size_t written = 0;
+	while (written < size) {
+		ssize_t result = write(store->fd, store->buffer + written, size - written);
+		if (result <= 0) {
+			// a partial chunk would hide every later one from readers
+			if (ftruncate(store->fd, end) == 0) {
+				lseek(store->fd, end, SEEK_SET);
+			}
+			return -1;
+		}
+		written += result;
+	}
+
+	// an entry lost with a crash is added back when the store is opened
+	struct temperhum_store_index entry;
+	temperhum_store_summarize(store->pending, store->count, end, &entry, store->minutes);
+	entry.minute = lseek(store->minutes_fd, 0, SEEK_CUR);
+	size_t minutes = entry.minutes * sizeof(struct temperhum_store_minute);
+	if (write(store->minutes_fd, store->minutes, minutes) != (ssize_t) minutes) {
+		// queries decode the chunk instead
+		if (ftruncate(store->minutes_fd, entry.minute) == 0) {
+			lseek(store->minutes_fd, entry.minute, SEEK_SET);
+		}
+		entry.minutes = 0;
+	}
+	if (write(store->index_fd, &entry, sizeof(entry)) != sizeof(entry)) {
+		lseek(store->index_fd, 0, SEEK_END);
+	}
+
+	store->count = 0;
+	store->chunks++;
+	store->bytes += size;
+
+	return fdatasync(store->fd) < 0 ? -1 : 0;
+}
+
+/**
+ * Seals samples waiting in memory and closes the store, returns -1 if they could not be written
+ */
+int temperhum_store_close(struct temperhum_store * store)
+{
+	int result = 0;
+
+	if (!store) {
+		return 0;
+	}
+	if (store->pending && store->minutes && store->buffer) {
+		result = temperhum_store_seal(store);
+	}
+	close(store->fd);
+	close(store->index_fd);
+	close(store->minutes_fd);
+	free(store->pending);
+	free(store->minutes);
+	free(store->buffer);
+	free(store);
+
+	return result;
+}
@@ -0,0 +1,129 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ *
+ * Append only store of the raw readings of a device: a file header followed
+ * by compressed chunks of a fixed amount of samples, a sparse index of the
+ * chunks in a file of the same name with TEMPERHUM_STORE_INDEX_SUFFIX and the
+ * aggregates of every minute of the chunks with TEMPERHUM_STORE_MINUTES_SUFFIX
+ */
+
+#ifndef TEMPER_HUM_HID_STORE
+#define TEMPER_HUM_HID_STORE
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "temper-hum-hid-api.h"
+
+#define TEMPERHUM_STORE_MAGIC "THCS"
+#define TEMPERHUM_STORE_CHUNK_MAGIC "THCK"
+#define TEMPERHUM_STORE_INDEX_MAGIC "THCI"
+#define TEMPERHUM_STORE_INDEX_SUFFIX ".idx"
+#define TEMPERHUM_STORE_MINUTES_SUFFIX ".min"
+#define TEMPERHUM_STORE_VERSION 1
+#define TEMPERHUM_STORE_INDEX_VERSION 2 /** entries point to the aggregates per minute since 2 */
+#define TEMPERHUM_STORE_MINUTE 60000 /** ms of an entry of the minutes file */
+#define TEMPERHUM_STORE_PADDING 8 /** zero bytes after every payload, decoding reads a word at a time */
+
+struct temperhum_store_header {
+	char magic[4];
+	uint16_t version;
+	uint8_t interface_number;
+	uint8_t reserved;
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+};
+
+/**
+ * Header of a chunk, its payload follows: timestamps as delta of delta, temperature
+ * and humidity XOR compressed against the previous value, raw words as bit packed
+ * differences
+ */
+struct temperhum_store_chunk {
+	char magic[4];
+	uint32_t count; /** samples */
+	int64_t first; /** wall clock time in ms of the first sample */
+	int64_t last; /** wall clock time in ms of the last sample */
+	uint32_t size; /** bytes of payload including padding */
+	uint32_t column[3]; /** payload offsets of the temperature, humidity and raw columns, timestamps start at 0 */
+	uint8_t raw_temperature_bits; /** width of the differences of raw temperatures */
+	uint8_t raw_humidity_bits; /** width of the differences of raw humidities */
+	uint8_t reserved[6];
+};
+
+struct temperhum_store_sample {
+	int64_t timestamp; /** wall clock time in ms */
+	double temperature;
+	double humidity;
+	uint16_t raw_temperature; /** SOT */
+	uint16_t raw_humidity; /** SORH */
+};
+
+struct temperhum_store_index_header {
+	char magic[4];
+	uint16_t version;
+	uint8_t reserved[10];
+};
+
+/**
+ * Entry of the index per chunk, in the order of the chunks
+ */
+struct temperhum_store_index {
+	int64_t offset; /** of the chunk header in the store */
+	int64_t first; /** earliest wall clock time in ms of the chunk */
+	int64_t last; /** latest wall clock time in ms of the chunk */
+	int64_t minute; /** offset of the first aggregate per minute of the chunk in the minutes file */
+	uint32_t count; /** samples */
+	uint32_t minutes; /** aggregates per minute of the chunk, 0 if they could not be written */
+	double min[2]; /** of temperature and humidity */
+	double max[2];
+	double sum[2];
+};
+
+/**
+ * Aggregates of the samples of a chunk within one minute, a chunk has one per
+ * run of samples in the same minute
+ */
+struct temperhum_store_minute {
+	int64_t start; /** wall clock time in ms, a whole multiple of TEMPERHUM_STORE_MINUTE */
+	uint32_t count; /** samples */
+	uint32_t reserved;
+	double min[2]; /** of temperature and humidity */
+	double max[2];
+	double sum[2];
+};
+
+/**
+ * Store opened for appending, samples are kept in memory until the chunk is full
+ */
+struct temperhum_store {
+	int fd;
+	int index_fd;
+	int minutes_fd;
+	int chunk_samples; /** samples sealed into a chunk */
+	int count; /** samples waiting in pending */
+	struct temperhum_store_sample *pending;
+	struct temperhum_store_minute *minutes; /** aggregates per minute of the chunk being sealed */
+	uint8_t *buffer; /** chunk being encoded */
+	unsigned long chunks; /** chunks written since opened */
+	unsigned long bytes; /** bytes written since opened */
+};
+
+struct temperhum_store *temperhum_store_open(const char * path, const char * port_path, uint8_t interface_number, int chunk_samples);
+int temperhum_store_append(struct temperhum_store * store, const struct temperhum_store_sample * sample);
+int temperhum_store_seal(struct temperhum_store * store);
+int temperhum_store_expire(struct temperhum_store * store, int64_t now, int64_t max_age);
+int temperhum_store_close(struct temperhum_store * store);
+size_t temperhum_store_encode(const struct temperhum_store_sample * samples, int count, struct temperhum_store_chunk * chunk, uint8_t * payload);
+size_t temperhum_store_bound(int count);
+int temperhum_store_decode(const struct temperhum_store_chunk * chunk, const uint8_t * payload, struct temperhum_store_sample * samples);
+int temperhum_store_decode_columns(const struct temperhum_store_chunk * chunk, const uint8_t * payload, int64_t * timestamps, double * temperature, double * humidity);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_STORE */
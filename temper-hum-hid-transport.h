@@ -0,0 +1,47 @@
+/**
+ * @author Oleg Stepura <oleg.stepura@gmail.com>
+ * @copyright Copyright (c) Oleg Stepura
+ * @version $Id$
+ */
+
+#ifndef TEMPER_HUM_HID_TRANSPORT
+#define TEMPER_HUM_HID_TRANSPORT
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "temper-hum-hid-api.h"
+
+#define TEMPERHUM_TRANSPORT_HEADER 8 /** bytes reserved in front of asynchronous transfer data for the backend */
+#define TEMPERHUM_TRANSFER_OUT 0 /** HID Set_Report carrying a command to the sensor */
+#define TEMPERHUM_TRANSFER_IN 1 /** HID Get_Report reading a response of the sensor */
+
+/**
+ * Backend moving commands and responses between the api and temperhum devices
+ */
+struct temperhum_transport {
+	const char *name;
+	int (*init)(const char *options); /** options follow the name in the transport spec, 4ex. sim:devices=10 */
+	void (*exit)();
+	int (*scan)(); /** attaches devices which are not attached yet using temperhum_transport_attach() or alike */
+	int (*control)(temperhum_device *device, int direction, unsigned char *data, int length, int timeout); /** returns amount of bytes transferred, 0 on timeout or negative error */
+	int (*submit)(temperhum_device *device, int direction, unsigned char *buffer, int length, int timeout, void *user_data); /** data follows TEMPERHUM_TRANSPORT_HEADER bytes of buffer, completion is reported with temperhum_transport_complete() */
+	int (*handle_events)(int64_t timeout); /** completes transfers, waits up to timeout us */
+	int (*reset)(temperhum_device *device); /** -1 if the device has to be found again, the handle is closed then */
+	void (*close)(temperhum_device *device);
+};
+
+extern const struct temperhum_transport temperhum_usb_transport;
+extern const struct temperhum_transport temperhum_sim_transport;
+extern const struct temperhum_transport temperhum_replay_transport;
+
+void temperhum_transport_complete(void *user_data, int status, unsigned char *data, int size);
+void temperhum_transport_set_time_scale(double scale);
+temperhum_device * temperhum_transport_attach(uint8_t bus_number, uint8_t device_number, uint8_t interface_number, const char * port_path, void * handle);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* TEMPER_HUM_HID_TRANSPORT */
@@ -4,17 +4,81 @@
  * @version $Id$
  */
 
+#define _GNU_SOURCE /** strptime() and timegm() */
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <syslog.h>
 #include <string.h>
+#include <stddef.h>
 #include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdatomic.h>
 #include "temper-hum-hid-api.h"
 #include "temper-hum-hid-cmd.h"
+#include "temper-hum-hid-scheduler.h"
+#include "temper-hum-hid-ring.h"
+#include "temper-hum-hid-report.h"
+#include "temper-hum-hid-log.h"
+#include "temper-hum-hid-http.h"
+#include "temper-hum-hid-socket.h"
+#include "temper-hum-hid-archive.h"
+#include "temper-hum-hid-store.h"
+#include "temper-hum-hid-query.h"
+
+#define TEMPERHUM_QUEUE_SIZE 1024 /** samples waiting for output */
+#define TEMPERHUM_LATEST_DEVICES 64 /** devices kept in the output file and metrics */
+#define TEMPERHUM_METRICS_LINE (144 + TEMPERHUM_PORT_PATH_LENGTH) /** longest line of a device: name, labels and value */
+#define TEMPERHUM_METRICS_LINES (4 + TEMPERHUM_STATS_VALUES * 4 * TEMPERHUM_STATS_WINDOWS) /** lines of a device */
+#define TEMPERHUM_METRICS_SIZE (TEMPERHUM_LATEST_DEVICES * TEMPERHUM_METRICS_LINES * TEMPERHUM_METRICS_LINE + 16384) /** with HELP and TYPE lines */
+#define TEMPERHUM_HISTORY_BUCKETS 1000000 /** steps printed by --history at most */
 
 struct gengetopt_args_info cmd_args;
-FILE * log_file;
+struct temperhum_log * log_file;
+struct temperhum_log log_writer;
+
+struct temperhum_ring sample_queue;
+struct temperhum_table * latest_table;
+sem_t samples_ready;
+struct temperhum_sample latest[TEMPERHUM_LATEST_DEVICES];
+int latest_count;
+
+/**
+ * Files of a device in --archive and --store, NULL if not used or if they could not be opened
+ */
+struct temperhum_storage {
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	uint8_t interface_number;
+	struct temperhum_archive * archive;
+	struct temperhum_store * store;
+};
+
+struct temperhum_storage storages[TEMPERHUM_LATEST_DEVICES];
+int storage_count;
+
+/**
+ * Self metrics of a device as copied for SIGUSR1
+ */
+struct temperhum_metrics_copy {
+	char port_path[TEMPERHUM_PORT_PATH_LENGTH];
+	uint8_t bus_number;
+	uint8_t device_number;
+	uint8_t interface_number;
+	struct temperhum_metrics metrics;
+};
+
+struct temperhum_metrics_dump {
+	int64_t timestamp; /** wall clock time in ms of the copy */
+	int count;
+	struct temperhum_metrics_copy device[];
+};
+
+volatile sig_atomic_t metrics_requested;
+volatile sig_atomic_t termination_requested;
+struct temperhum_metrics_dump * _Atomic metrics_dump; /** waiting to be written by the output thread */
 
 /**
  * Opens log file or reopens it if it's already opened
@@ -22,162 +86,807 @@ FILE * log_file;
 void open_log_file(int exit_on_error)
 {
 	if (log_file) {
-		fclose(log_file);
+		if (temperhum_log_reopen(log_file) < 0) {
+			temperhum_error(exit_on_error, "Cannot open log file '%s' for writing (a)", cmd_args.log_arg);
+		}
+		return;
 	}
 
 	if (cmd_args.log_given) {
-		log_file = fopen(cmd_args.log_arg, "a");
-		if (!log_file) {
+		int sync = temperhum_log_parse_sync(cmd_args.log_sync_arg);
+		if (sync < 0) {
+			temperhum_error(1, "Unknown log durability level '%s'", cmd_args.log_sync_arg);
+		}
+		if (cmd_args.log_buffer_arg < 512) {
+			temperhum_error(1, "Log buffer of %i bytes is too small", cmd_args.log_buffer_arg);
+		}
+		if (temperhum_log_open(&log_writer, cmd_args.log_arg, cmd_args.log_buffer_arg, cmd_args.log_window_arg, sync) < 0) {
 			temperhum_error(exit_on_error, "Cannot open log file '%s' for writing (a)", cmd_args.log_arg);
 		}
+		log_file = &log_writer;
 	} else {
 		openlog("temper-hum-hid", LOG_PID | LOG_CONS, LOG_USER);
 	}
 }
 
 /**
- * Prints reading values from all found devices
+ * Builds a report of a sample as set up on the command line
  */
-int temperhum_print_devices(temperhum_device * device)
+void temperhum_format_output(struct temperhum_sample * sample, char * report)
 {
-	FILE * out_file;
-	char full_report[4096] = {0x00};
-	char log_report_data[512];
-	int print_result = 1;
+	temperhum_format_report(sample, cmd_args.machine_given, report);
 
+	if (cmd_args.repeat_arg || cmd_args.interval_given || cmd_args.socket_given) {
+		strcat(report, "--------------------------------\n");
+	}
+}
+
+/**
+ * Writes a sample to the log file or syslog
+ */
+void temperhum_log_sample(struct temperhum_sample * sample)
+{
+	char log_report_data[512];
 	time_t rawtime;
 	struct tm * timeinfo;
-	char time_string[24];
 
-	while (device != NULL) {
-		device->measurement_resolution_temperature = 14;
-		device->measurement_resolution_humidity = 12;
-		device->sensor_voltage = 3.5;
+	temperhum_format_log(sample, log_report_data, sizeof(log_report_data));
 
-		char report[512] = {0x00};
-		char report_line[128];
+	if (log_file) {
+		static time_t time_second = -1;
+		static char time_string[24];
+		char log_report[512];
 
-		int result = temperhum_fill(device);
-		if (result < 0) {
-			device = device->next;
-			print_result = -1;
+		// samples of one cycle share the second, the time is formatted once for them
+		rawtime = sample->timestamp / 1000;
+		if (rawtime != time_second) {
+			timeinfo = localtime(&rawtime);
+			strftime(time_string, 24, "%Y-%m-%d %H:%M:%S", timeinfo);
+			time_second = rawtime;
+		}
+
+		int length = snprintf(
+			log_report,
+			sizeof(log_report),
+			"[%s] TemperHum %s\n",
+			time_string,
+			log_report_data
+		);
+		if (temperhum_log_append(log_file, log_report, length) < 0) {
+			open_log_file(0);
+		}
+	} else {
+		syslog(LOG_INFO, log_report_data);	
+	}
+}
+
+/**
+ * Keeps the sample as the latest one of its device for the output file,
+ * devices which were not read for 2 of their intervals are dropped
+ */
+void temperhum_update_latest(struct temperhum_sample * sample)
+{
+	int i, kept = 0;
+
+	for (i = 0; i < latest_count; i++) {
+		if (!strcmp(latest[i].port_path, sample->port_path) && latest[i].interface_number == sample->interface_number) {
 			continue;
 		}
-		
-		if (!cmd_args.machine_given) {
-			sprintf(report_line, "Temperhum device @ %03u:%03u:\n", device->bus_number, device->device_number);
-			strcat(report, report_line);
-			sprintf(report_line, "  Temperature: %.2f C\n", device->temperature);
-			strcat(report, report_line);
-			sprintf(report_line, "  Relative humidity: %.2f %%\n", device->humidity);
-			strcat(report, report_line);
-			sprintf(report_line, "  Dew point: %.2f C\n", device->dew_point);
-			strcat(report, report_line);
-
-			/**
-			 * Calculate Human perception for this dew point according to Wikipedia table
-			 * @see http://en.wikipedia.org/wiki/Dew_point
-			 */
-			char * perception;
-			if (device->dew_point < 10) {
-				perception = "A bit dry for some";
-			} else if (10 <= device->dew_point && device->dew_point < 12.5) {
-				perception = "Very comfortable";
-			} else if (12.5 <= device->dew_point && device->dew_point < 16) {
-				perception = "Comfortable";
-			} else if (16 <= device->dew_point && device->dew_point < 18) {
-				perception = "OK for most, but all perceive the humidity at upper edge";
-			} else if (18 <= device->dew_point && device->dew_point < 21) {
-				perception = "Somewhat uncomfortable for most people at upper edge";
-			} else if (21 <= device->dew_point && device->dew_point < 24) {
-				perception = "Very humid, quite uncomfortable";
-			} else if (24 <= device->dew_point && device->dew_point < 26) {
-				perception = "Extremely uncomfortable, fairly oppressive";
-			} else {
-				perception = "Severely high! Even deadly for asthma related illnesses";
-			}
-			sprintf(report_line, "  Human perception: %s\n", perception);
-			strcat(report, report_line);
+		if (latest[i].interval && sample->timestamp - latest[i].timestamp > 2 * (int64_t) latest[i].interval) {
+			continue;
+		}
+		latest[kept++] = latest[i];
+	}
+	latest_count = kept;
+
+	if (latest_count < TEMPERHUM_LATEST_DEVICES) {
+		latest[latest_count++] = *sample;
+	}
+}
+
+/**
+ * Adds a sample to the archive and the store of its device, which are opened
+ * or created when the device is seen for the first time
+ */
+void temperhum_store_sample(struct temperhum_sample * sample)
+{
+	struct temperhum_storage * storage = NULL;
+	int i;
 
-			if ((device->temperature - 2) < device->dew_point && device->dew_point < (device->temperature + 2)) {
-				strcat(report, "\n  Warning! Dew point almost same as current temperature.\n  Humid air may condense into liquid water!\n");
+	for (i = 0; i < storage_count; i++) {
+		if (!strcmp(storages[i].port_path, sample->port_path) && storages[i].interface_number == sample->interface_number) {
+			storage = &storages[i];
+			break;
+		}
+	}
+
+	if (!storage) {
+		if (storage_count == TEMPERHUM_LATEST_DEVICES) {
+			return;
+		}
+		char path[1024];
+		storage = &storages[storage_count++];
+		memset(storage, 0, sizeof(struct temperhum_storage));
+		memcpy(storage->port_path, sample->port_path, TEMPERHUM_PORT_PATH_LENGTH);
+		storage->interface_number = sample->interface_number;
+
+		// reported once, the device is not stored until restart
+		if (cmd_args.archive_given) {
+			snprintf(path, sizeof(path), "%s/%s-i%u.thra", cmd_args.archive_arg, sample->port_path, sample->interface_number);
+			storage->archive = temperhum_archive_open(path, sample->port_path, sample->interface_number, sample->interval / 1000);
+			if (!storage->archive) {
+				temperhum_error(0, "Cannot open archive '%s'", path);
 			}
+		}
+		if (cmd_args.store_given) {
+			snprintf(path, sizeof(path), "%s/%s-i%u.thcs", cmd_args.store_arg, sample->port_path, sample->interface_number);
+			storage->store = temperhum_store_open(path, sample->port_path, sample->interface_number, cmd_args.store_chunk_arg);
+			if (!storage->store) {
+				temperhum_error(0, "Cannot open store '%s'", path);
+			}
+		}
+	}
+
+	if (storage->archive) {
+		double values[TEMPERHUM_ARCHIVE_VALUES] = {sample->temperature, sample->humidity, sample->dew_point};
+		temperhum_archive_update(storage->archive, sample->timestamp, values);
+	}
+	if (storage->store) {
+		struct temperhum_store_sample stored = {sample->timestamp, sample->temperature, sample->humidity, sample->raw_temperature, sample->raw_humidity};
+		if (temperhum_store_append(storage->store, &stored) < 0) {
+			temperhum_error(0, "Cannot write to store of device in port %s", sample->port_path);
+		}
+	}
+}
+
+/**
+ * Parses an amount of time with a suffix s, m, h, d or w, seconds without one.
+ * Returns milliseconds or -1.
+ */
+int64_t temperhum_parse_duration(const char * text)
+{
+	char *end;
+	double value = strtod(text, &end);
+	const char *units = "smhdw";
+	const int64_t lengths[] = {1000, 60000, 3600000, 86400000, 604800000};
+
+	if (end == text || value <= 0) {
+		return -1;
+	}
+	if (!*end) {
+		return value * 1000;
+	}
+	if (end[1] || !strchr(units, *end)) {
+		return -1;
+	}
+
+	return value * lengths[strchr(units, *end) - units];
+}
+
+/**
+ * Parses a UTC time as seconds since the epoch or as 2014-05-13, 2014-05-13T17:00
+ * or 2014-05-13T17:00:00. Returns wall clock time in ms or -1.
+ */
+int64_t temperhum_parse_time(const char * text)
+{
+	const char *formats[] = {"%Y-%m-%dT%H:%M:%S", "%Y-%m-%dT%H:%M", "%Y-%m-%d"};
+	struct tm time;
+	char *end;
+	int i;
+
+	long long seconds = strtoll(text, &end, 10);
+	if (end != text && !*end) {
+		return seconds * 1000;
+	}
+	for (i = 0; i < 3; i++) {
+		memset(&time, 0, sizeof(time));
+		end = strptime(text, formats[i], &time);
+		if (end && !*end) {
+			return (int64_t) timegm(&time) * 1000;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Prints readings of a device in --store aggregated over a range of time,
+ * options are device=<port path>-i<interface> and last=<duration> or
+ * from=<time>,to=<time>, and step=<duration>. Returns the exit code.
+ */
+int temperhum_history(const char * options)
+{
+	char buffer[256], device[128] = "", path[1024], *item, *state;
+	int64_t now = temperhum_realtime_ms(), from = -1, to = now, last = 86400000, step = 3600000;
+	struct temperhum_query_stats stats;
+
+	snprintf(buffer, sizeof(buffer), "%s", options);
+	for (item = strtok_r(buffer, ",", &state); item; item = strtok_r(NULL, ",", &state)) {
+		char *value = strchr(item, '=');
+		if (!value) {
+			temperhum_error(1, "Wrong history option '%s'", item);
+		}
+		*value++ = '\0';
+
+		if (!strcmp(item, "device")) {
+			snprintf(device, sizeof(device), "%s", value);
+		} else if (!strcmp(item, "last")) {
+			last = temperhum_parse_duration(value);
+		} else if (!strcmp(item, "step")) {
+			step = temperhum_parse_duration(value);
+		} else if (!strcmp(item, "from")) {
+			from = temperhum_parse_time(value);
+		} else if (!strcmp(item, "to")) {
+			to = temperhum_parse_time(value);
 		} else {
-			sprintf(report_line, "%03u-%03u-i%u-temp: %.2f\n", device->bus_number, device->device_number, device->interface_number, device->temperature);
-			strcat(report, report_line);
-			sprintf(report_line, "%03u-%03u-i%u-hum: %.2f\n", device->bus_number, device->device_number, device->interface_number, device->humidity);
-			strcat(report, report_line);
-			sprintf(report_line, "%03u-%03u-i%u-dew: %.2f\n", device->bus_number, device->device_number, device->interface_number, device->dew_point);
-			strcat(report, report_line);
-		}
-
-		sprintf(
-			log_report_data,
-			"%03u:%03u-i%u/driver: %i; voltage: %.1f; temperature: %.2f (%i, {0x%02X, 0x%02X}) @ %ibit; humidity: %.2f (%i, {0x%02X, 0x%02X}) @ %ibit; dew point: %.2f",
-			device->bus_number,
-			device->device_number,
-			device->interface_number,
-			device->kernel_driver_detached,
-			device->sensor_voltage,
-			device->temperature,
-			device->raw_temperature,
-			device->raw_temperature_bytes[0] & 0xFF,
-			device->raw_temperature_bytes[1] & 0xFF,
-			device->measurement_resolution_temperature,
-			device->humidity,
-			device->raw_humidity,
-			device->raw_humidity_bytes[0] & 0xFF,
-			device->raw_humidity_bytes[1] & 0xFF,
-			device->measurement_resolution_humidity,
-			device->dew_point
+			temperhum_error(1, "Unknown history option '%s'", item);
+		}
+	}
+
+	if (!*device || strchr(device, '/')) {
+		temperhum_error(1, "Option --history needs a device, 4ex. device=1-1.4-i1");
+	}
+	if (last <= 0 || step <= 0 || to < 0) {
+		temperhum_error(1, "Wrong history options '%s'", options);
+	}
+	if (from < 0) {
+		from = to - last;
+	}
+	// buckets are aligned to the step, hours and days of UTC
+	from = from / step * step;
+	if (to <= from || (to - from) / step >= TEMPERHUM_HISTORY_BUCKETS) {
+		temperhum_error(1, "History of '%s' needs more than %i steps", options, TEMPERHUM_HISTORY_BUCKETS);
+	}
+
+	struct temperhum_query_bucket *buckets = malloc(((to - from - 1) / step + 1) * sizeof(struct temperhum_query_bucket));
+	if (!buckets) {
+		temperhum_error(1, "Cannot allocate memory for history");
+	}
+
+	snprintf(path, sizeof(path), "%s/%s.thcs", cmd_args.store_arg, device);
+	int64_t start = temperhum_realtime_ms();
+	int count = temperhum_query(path, from, to, step, buckets, (to - from - 1) / step + 1, &stats);
+	if (count < 0) {
+		temperhum_error(1, "Cannot read store '%s'", path);
+	}
+	int64_t spent = temperhum_realtime_ms() - start;
+
+	int i;
+	printf("# time count temperature-min temperature-mean temperature-max humidity-min humidity-mean humidity-max\n");
+	for (i = 0; i < count; i++) {
+		const struct temperhum_query_bucket *bucket = &buckets[i];
+		time_t seconds = bucket->start / 1000;
+		struct tm time;
+		char text[32];
+
+		strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", gmtime_r(&seconds, &time));
+		printf(
+			"%s %u %.2f %.2f %.2f %.2f %.2f %.2f\n",
+			text, bucket->count,
+			bucket->min[0], bucket->mean[0], bucket->max[0],
+			bucket->min[1], bucket->mean[1], bucket->max[1]
 		);
+	}
+	printf("# %i buckets, %llu readings, %lu of %lu chunks decoded, %lli ms\n", count, (unsigned long long) stats.readings, stats.decoded, stats.chunks, (long long) spent);
+	free(buckets);
 
-		if (log_file) {
-			char log_report[512];
+	return 0;
+}
 
-			time(&rawtime);
-			timeinfo = localtime(&rawtime);
-			strftime(time_string, 24, "%Y-%m-%d %H:%M:%S", timeinfo);
-			
-			sprintf(
-				log_report,
-				"[%s] TemperHum %s\n",
-				time_string,
-				log_report_data
+/**
+ * Writes latest values of all devices to the output file
+ */
+void temperhum_write_out_file()
+{
+	FILE * out_file;
+	static char full_report[TEMPERHUM_LATEST_DEVICES * TEMPERHUM_REPORT_SIZE];
+	size_t length = 0;
+	int i;
+
+	full_report[0] = 0x00;
+	for (i = 0; i < latest_count; i++) {
+		if (length + TEMPERHUM_REPORT_SIZE >= sizeof(full_report)) {
+			break;
+		}
+		temperhum_format_output(&latest[i], full_report + length);
+		length += strlen(full_report + length);
+	}
+
+	// readers never see a half written file, the new one replaces the old one at once
+	char out_temp[1024];
+	snprintf(out_temp, sizeof(out_temp), "%s.tmp", cmd_args.out_arg);
+	out_file = fopen(out_temp, "w");
+	if (!out_file) {
+		temperhum_error(1, "Cannot open output file '%s' for writing (a)", out_temp);
+	}
+	fputs(full_report, out_file);
+	if (fclose(out_file) != 0 || rename(out_temp, cmd_args.out_arg) < 0) {
+		temperhum_error(0, "Cannot replace output file '%s'", cmd_args.out_arg);
+		unlink(out_temp);
+	}
+}
+
+/**
+ * Appends one gauge of every device to metrics
+ */
+int temperhum_render_gauge(char * metrics, int length, int size, const char * name, const char * help, int offset)
+{
+	int i;
+
+	if (length >= size) {
+		return length;
+	}
+	length += snprintf(metrics + length, size - length, "# HELP %s %s\n# TYPE %s gauge\n", name, help, name);
+	for (i = 0; i < latest_count && length < size; i++) {
+		double value = *(double *) ((char *) &latest[i] + offset);
+		length += snprintf(
+			metrics + length,
+			size - length,
+			"%s{bus=\"%03u\",device=\"%03u\",interface=\"%u\",port=\"%s\"} %.2f\n",
+			name,
+			latest[i].bus_number,
+			latest[i].device_number,
+			latest[i].interface_number,
+			latest[i].port_path,
+			value
+		);
+	}
+
+	return length;
+}
+
+/**
+ * Appends one rolling statistic of a value of every device for every window to metrics
+ */
+int temperhum_render_window_gauge(char * metrics, int length, int size, const char * name, const char * help, int value, int offset)
+{
+	int i, w;
+
+	if (length >= size) {
+		return length;
+	}
+	length += snprintf(metrics + length, size - length, "# HELP %s %s\n# TYPE %s gauge\n", name, help, name);
+	for (i = 0; i < latest_count && length < size; i++) {
+		for (w = 0; w < TEMPERHUM_STATS_WINDOWS && length < size; w++) {
+			double statistic = *(double *) ((char *) &latest[i].stats[w][value] + offset);
+			length += snprintf(
+				metrics + length,
+				size - length,
+				"%s{bus=\"%03u\",device=\"%03u\",interface=\"%u\",port=\"%s\",window=\"%s\"} %.2f\n",
+				name,
+				latest[i].bus_number,
+				latest[i].device_number,
+				latest[i].interface_number,
+				latest[i].port_path,
+				temperhum_stats_window_name(w),
+				statistic
 			);
-			int result = fputs(log_report, log_file);
-			if (result < 0) {
-				open_log_file(0);
-			} else {
-				fflush(log_file);
-			}
-		} else {
-			syslog(LOG_INFO, log_report_data);	
 		}
+	}
+
+	return length;
+}
+
+/**
+ * Renders latest values of all devices in Prometheus text format
+ */
+void temperhum_render_metrics()
+{
+	static char metrics[TEMPERHUM_METRICS_SIZE];
+	int size = sizeof(metrics), length = 0, i, v, s;
+
+	length = temperhum_render_gauge(metrics, length, size, "temperhum_temperature_celsius", "Temperature measured by the sensor.", offsetof(struct temperhum_sample, temperature));
+	length = temperhum_render_gauge(metrics, length, size, "temperhum_relative_humidity_percent", "Relative humidity measured by the sensor.", offsetof(struct temperhum_sample, humidity));
+	length = temperhum_render_gauge(metrics, length, size, "temperhum_dew_point_celsius", "Dew point calculated from temperature and humidity.", offsetof(struct temperhum_sample, dew_point));
 
-		if (cmd_args.repeat_arg) {
-			strcat(report, "--------------------------------\n");
+	static const char * values[TEMPERHUM_STATS_VALUES] = {"temperhum_temperature_celsius", "temperhum_relative_humidity_percent", "temperhum_dew_point_celsius"};
+	static const char * statistics[4] = {"min", "max", "mean", "stddev"};
+	static const int offsets[4] = {offsetof(struct temperhum_summary, min), offsetof(struct temperhum_summary, max), offsetof(struct temperhum_summary, mean), offsetof(struct temperhum_summary, stddev)};
+	for (v = 0; v < TEMPERHUM_STATS_VALUES && length < size; v++) {
+		for (s = 0; s < 4 && length < size; s++) {
+			char name[64], help[64];
+			snprintf(name, sizeof(name), "%s_%s", values[v], statistics[s]);
+			snprintf(help, sizeof(help), "Rolling %s over the window.", statistics[s]);
+			length = temperhum_render_window_gauge(metrics, length, size, name, help, v, offsets[s]);
 		}
+	}
 
-		if (cmd_args.out_given) {
-			strcat(full_report, report);
-		} else {
+	if (length < size) {
+		length += snprintf(metrics + length, size - length, "# HELP temperhum_sample_timestamp_seconds Time of the latest reading.\n# TYPE temperhum_sample_timestamp_seconds gauge\n");
+	}
+	for (i = 0; i < latest_count && length < size; i++) {
+		length += snprintf(
+			metrics + length,
+			size - length,
+			"temperhum_sample_timestamp_seconds{bus=\"%03u\",device=\"%03u\",interface=\"%u\",port=\"%s\"} %.3f\n",
+			latest[i].bus_number,
+			latest[i].device_number,
+			latest[i].interface_number,
+			latest[i].port_path,
+			latest[i].timestamp / 1000.0
+		);
+	}
+
+	if (length < size) {
+		length += snprintf(
+			metrics + length,
+			size - length,
+			"# HELP temperhum_queue_samples Samples waiting for output.\n# TYPE temperhum_queue_samples gauge\ntemperhum_queue_samples %u\n"
+			"# HELP temperhum_queue_dropped_total Samples dropped because output was too slow.\n# TYPE temperhum_queue_dropped_total counter\ntemperhum_queue_dropped_total %lu\n",
+			temperhum_ring_occupancy(&sample_queue),
+			temperhum_ring_dropped(&sample_queue)
+		);
+	}
+
+	if (length >= size) {
+		// Prometheus rejects a scrape ending in the middle of a line
+		char * end = memrchr(metrics, '\n', size - 1);
+		temperhum_error(0, "Too many devices, metrics are cut");
+		length = end ? end + 1 - metrics : 0;
+	}
+
+	if (temperhum_http_update(metrics, length) < 0) {
+		temperhum_error(0, "Cannot allocate memory for metrics");
+	}
+}
+
+/**
+ * Prints and logs all samples waiting in the queue, returns amount of samples
+ */
+int temperhum_output_samples()
+{
+	struct temperhum_sample sample;
+	int count = 0;
+
+	while (temperhum_ring_pop(&sample_queue, &sample)) {
+		temperhum_log_sample(&sample);
+		if (cmd_args.archive_given || cmd_args.store_given) {
+			temperhum_store_sample(&sample);
+		}
+
+		temperhum_update_latest(&sample);
+		if (!cmd_args.out_given) {
+			char report[TEMPERHUM_REPORT_SIZE];
+			temperhum_format_output(&sample, report);
 			printf("%s", report);
 		}
+		count++;
+	}
+
+	if (count && cmd_args.out_given) {
+		temperhum_write_out_file();
+	}
+
+	// also chunks of devices no longer read, their readings would wait until exit
+	if (cmd_args.store_age_arg > 0) {
+		int64_t now = temperhum_realtime_ms();
+		int i;
+		for (i = 0; i < storage_count; i++) {
+			if (storages[i].store && temperhum_store_expire(storages[i].store, now, cmd_args.store_age_arg * 1000LL) < 0) {
+				temperhum_error(0, "Cannot write to store of device in port %s", storages[i].port_path);
+			}
+		}
+	}
+
+	// metrics are rendered once per cycle, scrapes only copy the ready buffer
+	if (count && cmd_args.metrics_port_given) {
+		temperhum_render_metrics();
+	}
+
+	// lines of all devices read in a cycle go to the log file with one write
+	if (log_file && temperhum_log_commit(log_file) < 0) {
+		temperhum_error(0, "Cannot write to log file '%s', error %i, retrying in %i ms", cmd_args.log_arg, errno, log_file->retry);
+		open_log_file(0);
+	}
+
+	return count;
+}
+
+/**
+ * Reads the interval for a device from --device-interval list of
+ * port=milliseconds or bus:device=milliseconds items
+ */
+int device_interval(temperhum_device * device, int interval)
+{
+	if (!cmd_args.device_interval_given) {
+		return interval;
+	}
+
+	char * list = cmd_args.device_interval_arg;
+	while (*list) {
+		char key[TEMPERHUM_PORT_PATH_LENGTH];
+		unsigned int bus, address;
+		int milliseconds, length;
+
+		if (sscanf(list, "%39[^=,]=%i%n", key, &milliseconds, &length) != 2) {
+			temperhum_error(1, "Wrong device interval list '%s'", cmd_args.device_interval_arg);
+		}
+		list += length;
+		if (*list == ',') {
+			list++;
+		}
+
+		if (!strcmp(key, device->port_path)) {
+			return milliseconds;
+		}
+		if (sscanf(key, "%u:%u", &bus, &address) == 2 && bus == device->bus_number && address == device->device_number) {
+			return milliseconds;
+		}
+	}
+
+	return interval;
+}
+
+/**
+ * Sets up calibration and interval of devices
+ */
+void configure_devices(temperhum_device * device, int interval)
+{
+	for (; device != NULL; device = device->next) {
+		device->measurement_resolution_temperature = 14;
+		device->measurement_resolution_humidity = 12;
+		device->sensor_voltage = 3.5;
+		if (temperhum_calibrate(device) < 0) {
+			temperhum_error(1, "Wrong calibration for device in port %s", device->port_path);
+		}
+		device->interval = device_interval(device, interval);
+		if (device->interval < 0) {
+			temperhum_error(1, "Wrong interval %i ms for device in port %s", device->interval, device->port_path);
+		}
+		// devices without an interval are only read when socket clients ask for them
+		if (!device->interval) {
+			device->next_sample = INT64_MAX;
+		}
+	}
+}
+
+/**
+ * Reads given devices and queues their samples for output
+ */
+int temperhum_acquire_devices(temperhum_device ** devices, int count)
+{
+	int result = 1, i;
+
+	temperhum_fill_devices(devices, count);
+	temperhum_capture_flush();
+
+	for (i = 0; i < count; i++) {
+		struct temperhum_sample sample;
+
+		// devices which are backed off or being reset are not read in this cycle
+		if (devices[i]->fill_result <= 0) {
+			if (devices[i]->fill_result < 0) {
+				result = -1;
+			}
+			continue;
+		}
+
+		if (latest_table && temperhum_table_publish(latest_table, devices[i]) < 0) {
+			temperhum_debug("Shared memory table is full, device in port %s is not published", devices[i]->port_path);
+		}
+
+		temperhum_sample_fill(&sample, devices[i]);
+		if (cmd_args.socket_given) {
+			temperhum_socket_publish(&sample);
+		}
+		if (temperhum_ring_push(&sample_queue, &sample) < 0) {
+			temperhum_debug("Sample queue is full, dropping sample of device in port %s", devices[i]->port_path);
+			continue;
+		}
+		sem_post(&samples_ready);
+	}
+
+	return result;
+}
+
+/**
+ * Copies self metrics of all devices when SIGUSR1 asks for them, called by
+ * the acquisition thread between cycles. The copy is written by the output
+ * thread, so reading of devices does not wait for it.
+ */
+void temperhum_take_metrics(temperhum_device * device)
+{
+	temperhum_device * d;
+	int count = 0;
+
+	for (d = device; d; d = d->next) {
+		count++;
+	}
+
+	struct temperhum_metrics_dump * dump = malloc(sizeof(struct temperhum_metrics_dump) + count * sizeof(struct temperhum_metrics_copy));
+	if (!dump) {
+		temperhum_error(0, "Cannot allocate memory for metrics of %i devices", count);
+		return;
+	}
+	dump->timestamp = temperhum_realtime_ms();
+	dump->count = count;
+	for (d = device, count = 0; d; d = d->next, count++) {
+		struct temperhum_metrics_copy * copy = &dump->device[count];
+		memcpy(copy->port_path, d->port_path, TEMPERHUM_PORT_PATH_LENGTH);
+		copy->bus_number = d->bus_number;
+		copy->device_number = d->device_number;
+		copy->interface_number = d->interface_number;
+		copy->metrics = d->metrics;
+	}
+
+	// a copy the output thread has not written yet is replaced
+	free(atomic_exchange(&metrics_dump, dump));
+	sem_post(&samples_ready);
+}
+
+/**
+ * Writes self metrics copied for SIGUSR1 to stderr, if there are any
+ */
+void temperhum_write_metrics()
+{
+	struct temperhum_metrics_dump * dump = atomic_exchange(&metrics_dump, NULL);
+	int i, j;
+
+	if (!dump) {
+		return;
+	}
+
+	time_t seconds = dump->timestamp / 1000;
+	struct tm time;
+	char text[24];
+	strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", localtime_r(&seconds, &time));
+	fprintf(stderr, "Metrics of %i devices at %s, latencies in us\n", dump->count, text);
+
+	for (i = 0; i < dump->count; i++) {
+		struct temperhum_metrics_copy * copy = &dump->device[i];
+		char prefix[64];
+
+		fprintf(stderr, "Device @ %03u:%03u (port %s):\n", copy->bus_number, copy->device_number, copy->port_path);
+		for (j = 0; j < TEMPERHUM_COUNTERS; j++) {
+			fprintf(stderr, "%03u-%03u-i%u-%s: %llu\n", copy->bus_number, copy->device_number, copy->interface_number, temperhum_counter_name(j), (unsigned long long) copy->metrics.counter[j]);
+		}
+		for (j = 0; j < TEMPERHUM_LATENCIES; j++) {
+			snprintf(prefix, sizeof(prefix), "%03u-%03u-i%u-%s", copy->bus_number, copy->device_number, copy->interface_number, temperhum_latency_name(j));
+			temperhum_histogram_print(&copy->metrics.latency[j], stderr, prefix);
+		}
+	}
+	fflush(stderr);
+	free(dump);
+}
+
+/**
+ * Asks for a copy of the self metrics, see temperhum_take_metrics()
+ */
+void temperhum_request_metrics(int signal)
+{
+	metrics_requested = 1;
+}
+
+/**
+ * Handles SIGTERM and SIGINT, both threads finish and pending readings are
+ * written before exiting
+ */
+void temperhum_request_termination(int signal)
+{
+	termination_requested = 1;
+	sem_post(&samples_ready);
+}
 
-		device = device->next;
+/**
+ * Puts devices which were just read back into the schedule at the next
+ * deadline of their interval, devices without one wait for socket clients
+ */
+void temperhum_reschedule(struct temperhum_schedule * schedule, temperhum_device ** devices, int count)
+{
+	int64_t now = temperhum_realtime_ms();
+	int i;
+
+	for (i = 0; i < count; i++) {
+		temperhum_device * d = devices[i];
+		if (d->interval) {
+			int64_t next = temperhum_next_deadline(now, d->interval);
+			if (next - d->next_sample > d->interval) {
+				temperhum_error(0, "Cycle took longer than the interval of device in port %s, skipping %lli cycles", d->port_path, (long long) ((next - d->next_sample) / d->interval - 1));
+			}
+			d->next_sample = next;
+		}
+		temperhum_schedule_push(schedule, d);
 	}
+}
+
+/**
+ * Reads devices on their schedule, runs in its own thread so that slow output
+ * never delays reading of devices
+ */
+void * temperhum_acquisition_thread(void * arg)
+{
+	int interval = *(int *) arg;
+	struct temperhum_schedule schedule = {NULL, 0, 0};
+	temperhum_device ** due = NULL;
+	temperhum_device * device;
+	unsigned int generation = temperhum_generation() - 1;
+	int64_t reinitialized = temperhum_realtime_ms();
+	sigset_t signals;
+
+	// signals go to the output thread, they would cut short waits for sensors here
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGUSR1);
+	sigaddset(&signals, SIGTERM);
+	sigaddset(&signals, SIGINT);
+	pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+	// waits are at most a second long, so termination is noticed within one
+	while (!termination_requested) {
+		int64_t now = temperhum_realtime_ms();
+
+		// force a reset every hour unless devices are tracked by hotplug events
+		if (now - reinitialized >= 3600000 && !temperhum_hotplug_enabled()) {
+			temperhum_debug("1 hour spent, forcing reinitialization of devices");
+			temperhum_reinit();
+			reinitialized = now;
+		}
 
-	if (cmd_args.out_given) {
-		out_file = fopen(cmd_args.out_arg, "w");
-		if (!out_file) {
-			temperhum_error(1, "Cannot open output file '%s' for writing (a)", cmd_args.out_arg);
+		// picks up devices which were plugged in or removed meanwhile
+		device = temperhum_find();
+		if (metrics_requested) {
+			metrics_requested = 0;
+			temperhum_take_metrics(device);
 		}
-		fputs(full_report, out_file);
-		fclose(out_file);
+		if (generation != temperhum_generation()) {
+			configure_devices(device, interval);
+			if (cmd_args.socket_given) {
+				temperhum_socket_attached(device);
+			}
+			if (temperhum_schedule_build(&schedule, device, now) < 0 || !(due = realloc(due, (schedule.size + 1) * sizeof(temperhum_device *)))) {
+				temperhum_error(1, "Cannot allocate memory for device schedule");
+			}
+			generation = temperhum_generation();
+		}
+
+		// socket clients asked for fresh values, all devices are read at once for all of them
+		unsigned int demand = cmd_args.socket_given ? temperhum_socket_demanded() : 0;
+		if (demand) {
+			int count = 0;
+			while (temperhum_schedule_top(&schedule)) {
+				due[count++] = temperhum_schedule_pop(&schedule);
+			}
+			temperhum_debug("Reading %i devices requested by socket clients", count);
+			temperhum_acquire_devices(due, count);
+			temperhum_socket_served(demand);
+			temperhum_reschedule(&schedule, due, count);
+			continue;
+		}
+
+		temperhum_device * top = temperhum_schedule_top(&schedule);
+		if (!top || top->next_sample > now) {
+			// wake up at least every second to notice plugged in devices
+			int64_t wakeup = temperhum_next_deadline(now, 1000);
+			if (top && top->next_sample < wakeup) {
+				wakeup = top->next_sample;
+			}
+			if (cmd_args.socket_given) {
+				temperhum_socket_wait(wakeup);
+			} else {
+				temperhum_sleep_until(wakeup);
+			}
+			continue;
+		}
+
+		temperhum_debug("Cycle scheduled at %lli ms started %lli ms late", (long long) top->next_sample, (long long) (now - top->next_sample));
+
+		// only devices which are due are read, slow ones cost nothing on fast ticks
+		int count = 0;
+		while ((top = temperhum_schedule_top(&schedule)) && top->next_sample <= now) {
+			due[count++] = temperhum_schedule_pop(&schedule);
+		}
+
+		// failing devices are reset one by one, the others keep being read
+		if (temperhum_acquire_devices(due, count) < 0) {
+			temperhum_debug("Failures occured during reading");
+		}
+
+		temperhum_reschedule(&schedule, due, count);
 	}
 
-	return print_result;
+	free(due);
+	temperhum_schedule_free(&schedule);
+
+	return NULL;
 }
 
 /**
@@ -191,47 +900,181 @@ int main(int argc, char *argv[])
 		temperhum_error(1, "Cannot parse command line arguments, error %i", result);
 	}
 
+	if (cmd_args.simulate_given) {
+		char spec[256];
+		snprintf(spec, sizeof(spec), "sim:%s", cmd_args.simulate_arg);
+		if (temperhum_set_transport(spec) < 0) {
+			temperhum_init(0, 0, "\0");
+			temperhum_error(1, "Wrong simulation options '%s'", cmd_args.simulate_arg);
+		}
+	} else if (cmd_args.replay_given) {
+		char spec[256];
+		snprintf(spec, sizeof(spec), "replay:file=%s,speed=%g", cmd_args.replay_arg, cmd_args.replay_speed_arg);
+		if (temperhum_set_transport(spec) < 0) {
+			temperhum_init(0, 0, "\0");
+			temperhum_error(1, "Cannot replay '%s'", cmd_args.replay_arg);
+		}
+	}
+
 	temperhum_init(cmd_args.verbose_given, cmd_args.syslog_given, cmd_args.verbose_arg);
+	if (cmd_args.fixed_wait_given) {
+		temperhum_set_wait_policy(TEMPERHUM_WAIT_FIXED);
+	}
+	if (cmd_args.capture_given && temperhum_capture_start(cmd_args.capture_arg) < 0) {
+		temperhum_error(1, "Cannot capture to '%s'", cmd_args.capture_arg);
+	}
+
+	if (cmd_args.client_given) {
+		if (!cmd_args.socket_given) {
+			temperhum_error(1, "Option --client needs --socket");
+		}
+		// a running daemon answers without touching usb, otherwise devices are read here
+		if (temperhum_socket_query(cmd_args.socket_arg, cmd_args.max_age_arg, cmd_args.machine_given) == 0) {
+			temperhum_close();
+			return 0;
+		}
+		temperhum_debug("No daemon answers on socket %s, reading devices", cmd_args.socket_arg);
+		cmd_args.socket_given = 0;
+	}
+
+	if (cmd_args.history_given) {
+		if (!cmd_args.store_given) {
+			temperhum_error(1, "Option --history needs --store");
+		}
+		result = temperhum_history(cmd_args.history_arg);
+		temperhum_close();
+		return result;
+	}
 
 	//temperhum_reset_devices();
 
-	temperhum_device * device;
-	device = temperhum_find();
 	open_log_file(1);
+	if (temperhum_ring_init(&sample_queue, TEMPERHUM_QUEUE_SIZE) < 0 || sem_init(&samples_ready, 0, 0) < 0) {
+		temperhum_error(1, "Cannot allocate memory for sample queue");
+	}
 
-	int spent = 0;
-	if (cmd_args.repeat_arg) {
-		while (1) {
-			// force a reset every hour
-			if (spent >= 3600) {
-				temperhum_debug("1 hour spent, forcing reinitialization of devices");
-				temperhum_close();
-				temperhum_init(cmd_args.verbose_given, cmd_args.syslog_given, cmd_args.verbose_arg);
-				device = temperhum_find();
-				spent = 0;
-			}
+	if (cmd_args.shm_given && !(latest_table = temperhum_table_create(cmd_args.shm_arg))) {
+		temperhum_error(1, "Cannot create shared memory table '%s'", cmd_args.shm_arg);
+	}
+
+	if (cmd_args.metrics_port_given) {
+		if (temperhum_http_start(cmd_args.metrics_address_arg, cmd_args.metrics_port_arg) < 0) {
+			temperhum_error(1, "Cannot serve metrics on %s:%i", cmd_args.metrics_address_arg, cmd_args.metrics_port_arg);
+		}
+		temperhum_render_metrics();
+	}
+
+	if (cmd_args.store_chunk_arg < 2) {
+		temperhum_error(1, "Store chunk of %i readings is too small", cmd_args.store_chunk_arg);
+	}
+	if (cmd_args.store_age_arg < 0) {
+		temperhum_error(1, "Store age of %i seconds is negative", cmd_args.store_age_arg);
+	}
 
-			int result = temperhum_print_devices(device);
-			if (result < 0) {
-				temperhum_debug("Failures occured during reading, reinitialize devices");
-				temperhum_close();
-				temperhum_init(cmd_args.verbose_given, cmd_args.syslog_given, cmd_args.verbose_arg);
-				device = temperhum_find();
+	int interval = cmd_args.repeat_arg * 1000;
+	if (cmd_args.interval_given) {
+		interval = cmd_args.interval_arg;
+	}
+
+	if (cmd_args.socket_given) {
+		if (temperhum_socket_start(cmd_args.socket_arg, temperhum_format_report) < 0) {
+			temperhum_error(1, "Cannot answer queries on socket '%s'", cmd_args.socket_arg);
+		}
+	}
+
+	// with a socket and no interval devices are read only when clients ask for it
+	if (interval > 0 || cmd_args.socket_given) {
+		pthread_t acquisition;
+		unsigned long dropped = 0;
+		struct sigaction action;
+
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = temperhum_request_metrics;
+		action.sa_flags = SA_RESTART;
+		sigemptyset(&action.sa_mask);
+		if (sigaction(SIGUSR1, &action, NULL) < 0) {
+			temperhum_error(1, "Cannot handle SIGUSR1");
+		}
+		action.sa_handler = temperhum_request_termination;
+		if (sigaction(SIGTERM, &action, NULL) < 0 || sigaction(SIGINT, &action, NULL) < 0) {
+			temperhum_error(1, "Cannot handle SIGTERM and SIGINT");
+		}
+
+		if (pthread_create(&acquisition, NULL, temperhum_acquisition_thread, &interval) != 0) {
+			temperhum_error(1, "Cannot start acquisition thread");
+		}
+
+		while (!termination_requested) {
+			int timeout = log_file ? temperhum_log_timeout(log_file) : -1;
+			if (timeout < 0) {
+				result = sem_wait(&samples_ready);
+			} else {
+				// wake up when buffered log lines have to be written
+				struct timespec wakeup;
+				clock_gettime(CLOCK_REALTIME, &wakeup);
+				wakeup.tv_sec += timeout / 1000;
+				wakeup.tv_nsec += (timeout % 1000) * 1000000;
+				if (wakeup.tv_nsec >= 1000000000) {
+					wakeup.tv_sec++;
+					wakeup.tv_nsec -= 1000000000;
+				}
+				result = sem_timedwait(&samples_ready, &wakeup);
+			}
+			if (result < 0 && errno != ETIMEDOUT) {
+				if (errno != EINTR) {
+					temperhum_error(1, "Cannot wait for samples, error %i", errno);
+				}
+				continue;
 			}
 
-			sleep(cmd_args.repeat_arg);
-			spent += cmd_args.repeat_arg;
+			int count = temperhum_output_samples();
+			temperhum_write_metrics();
+			if (count) {
+				temperhum_debug("Output %i samples, %u left in queue", count, temperhum_ring_occupancy(&sample_queue));
+			}
+			if (dropped != temperhum_ring_dropped(&sample_queue)) {
+				dropped = temperhum_ring_dropped(&sample_queue);
+				temperhum_error(0, "Output is too slow, %lu samples dropped so far", dropped);
+			}
 		}
+
+		// readings taken until the acquisition thread noticed it are written as well
+		temperhum_debug("Terminating, writing pending readings");
+		pthread_join(acquisition, NULL);
+		temperhum_output_samples();
 	} else {
-		temperhum_print_devices(device);
+		int count = 0;
+		temperhum_device * device, * d;
+		temperhum_device * devices[256];
+
+		device = temperhum_find();
+		configure_devices(device, 1);
+		for (d = device; d != NULL && count < 256; d = d->next) {
+			devices[count++] = d;
+		}
+		temperhum_acquire_devices(devices, count);
+		temperhum_output_samples();
 	}
 
+	temperhum_socket_stop();
 	if (log_file) {
-		fclose(log_file);
+		temperhum_log_close(log_file);
 	} else {
 		closelog();
 	}
 
+	if (latest_table) {
+		temperhum_table_close(latest_table);
+	}
+	int i;
+	for (i = 0; i < storage_count; i++) {
+		temperhum_archive_close(storages[i].archive);
+		if (temperhum_store_close(storages[i].store) < 0) {
+			temperhum_error(0, "Cannot write to store of device in port %s", storages[i].port_path);
+		}
+	}
+	temperhum_ring_free(&sample_queue);
+	temperhum_capture_stop();
 	temperhum_close();
 	return 0;
 }